@@ -0,0 +1,424 @@
+#include <Arduino.h>
+#include <SimBus.h>
+#include <chrono>
+#include <stdio.h>
+#include <string>
+#include "../src/config/GPIOConfig.h"
+#include "../src/core/TaskManager.h"
+#include "../src/network/TaskFeed.h"
+#include "../src/ui/DisplayManager.h"
+#include "../src/ui/RenderTask.h"
+#include "../src/utils/ConfigLoader.h"
+
+// ==============================================
+// Native benchmarks
+// ==============================================
+// Runs the real firmware (setup() and loop() from src/main.cpp) against
+// NativeSim and drives it through representative scenarios with scripted
+// input. Each scenario reports host CPU time spent in the firmware,
+// simulated time, SPI bus bytes, heap allocations and peak heap, and
+// everything comes out as one JSON document on stdout so runs can be diffed
+// between commits (tools/bench_compare.py).
+//
+// config_load reads the settings record the way every boot does, and
+// config_import parses the same settings from JSON, as boots did before
+// there was a record.
+//
+// The splash and the demo activation progress are the same on every panel
+// and go out as broadcasts; the run fails unless SimBus saw broadcast bytes
+// and all eight panels ended up with the same picture.
+//
+// demo_sparkle_frame is the demo screen at steady state; the run fails
+// unless every sparkle frame due in that time was shown.
+//
+// The task_feed scenarios push generated Home Assistant responses of a few
+// KB and of several hundred KB through TaskFeed; the run fails if the large
+// one needs more heap than the small one.
+//
+//   pio run -e bench && .pio/build/bench/program > bench.json
+//
+// Host times vary from machine to machine; bus bytes, simulated time and
+// allocation counts are deterministic.
+
+// From src/main.cpp
+void setup();
+void loop();
+extern bool isDemoMode;
+
+static const uint8_t TASK_PINS[] = TASK_BUTTON_PINS;
+static const uint8_t ROW_PINS[] = ROW_SELECT_PINS;
+
+// Quiet ticks (and no transition running) before a scenario counts as done
+static const int SETTLE_TICKS = 5;
+static const int MAX_SETTLE_TICKS = 2000;
+
+// Into the 5 s hold, with the progress screen up on every panel
+static const unsigned long DEMO_ACTIVATION_HALFWAY_MS = 2500;
+
+// ==============================================
+// Allocation counting
+// ==============================================
+// glibc lets a program replace malloc; operator new goes through it too.
+// Heap in use is only tracked there, from the size of each block.
+
+static uint32_t allocCount = 0;
+static uint64_t allocBytes = 0;
+static uint64_t heapInUse = 0;
+static uint64_t heapPeak = 0;
+
+#ifdef __GLIBC__
+#include <malloc.h>
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+void __libc_free(void* pointer);
+
+static void* track(void* pointer) {
+	if (pointer) heapInUse += malloc_usable_size(pointer);
+	if (heapInUse > heapPeak) heapPeak = heapInUse;
+	return pointer;
+}
+
+void* malloc(size_t size) {
+	allocCount++;
+	allocBytes += size;
+	return track(__libc_malloc(size));
+}
+
+void* calloc(size_t count, size_t size) {
+	allocCount++;
+	allocBytes += count * size;
+	return track(__libc_calloc(count, size));
+}
+
+void* realloc(void* pointer, size_t size) {
+	allocCount++;
+	allocBytes += size;
+	if (pointer) heapInUse -= malloc_usable_size(pointer);
+	return track(__libc_realloc(pointer, size));
+}
+
+void free(void* pointer) {
+	if (pointer) heapInUse -= malloc_usable_size(pointer);
+	__libc_free(pointer);
+}
+}
+#else
+void* operator new(size_t size) {
+	allocCount++;
+	allocBytes += size;
+	void* pointer = malloc(size);
+	if (!pointer) abort();
+	return pointer;
+}
+
+void operator delete(void* pointer) noexcept { free(pointer); }
+void operator delete(void* pointer, size_t) noexcept { free(pointer); }
+#endif
+
+// ==============================================
+// Measurement
+// ==============================================
+
+struct Sample {
+	uint64_t hostNanos;
+	uint64_t simMicros;
+	uint64_t busBytes;
+	uint64_t wireMicros;
+	uint32_t allocs;
+	uint64_t allocBytes;
+	uint64_t heapInUse;
+};
+
+struct Scenario {
+	const char* name;
+	int iterations;
+	Sample total;
+	uint64_t minHostNanos;
+	uint64_t maxHostNanos;
+	uint64_t heapPeakBytes;     // Most heap above the starting level, any iteration
+};
+
+static uint64_t hostNanos = 0;   // Time spent inside the firmware
+
+static void tick() {
+	auto start = std::chrono::steady_clock::now();
+	loop();
+	hostNanos += std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - start).count();
+}
+
+static Sample snapshot() {
+	heapPeak = heapInUse;
+	return {hostNanos, SimClock::nowMicros(), SimBus::totalBusBytes(),
+	        SimBus::estimatedWireMicros(), allocCount, allocBytes, heapInUse};
+}
+
+static void accumulate(Scenario& scenario, const Sample& before) {
+	Sample after = snapshot();
+	uint64_t host = after.hostNanos - before.hostNanos;
+	scenario.total.hostNanos += host;
+	scenario.total.simMicros += after.simMicros - before.simMicros;
+	scenario.total.busBytes += after.busBytes - before.busBytes;
+	scenario.total.wireMicros += after.wireMicros - before.wireMicros;
+	scenario.total.allocs += after.allocs - before.allocs;
+	scenario.total.allocBytes += after.allocBytes - before.allocBytes;
+	if (heapPeak - before.heapInUse > scenario.heapPeakBytes) scenario.heapPeakBytes = heapPeak - before.heapInUse;
+	if (scenario.iterations == 0 || host < scenario.minHostNanos) scenario.minHostNanos = host;
+	if (host > scenario.maxHostNanos) scenario.maxHostNanos = host;
+	scenario.iterations++;
+}
+
+// Ticks until the bus has been idle for a few ticks and no transition runs
+static void settle() {
+	int quiet = 0;
+	for (int i = 0; i < MAX_SETTLE_TICKS && quiet < SETTLE_TICKS; i++) {
+		uint64_t bytes = SimBus::totalBusBytes();
+		tick();
+		bool idle = SimBus::totalBusBytes() == bytes && !RenderTask::isAnimating();
+		quiet = idle ? quiet + 1 : 0;
+	}
+}
+
+// Ticks until the running transition is over. The demo screen that follows
+// never goes quiet - its sparkles keep moving - so settle() would not return.
+static void finishTransition() {
+	for (int i = 0; i < MAX_SETTLE_TICKS && RenderTask::isAnimating(); i++) tick();
+}
+
+static void runFor(unsigned long ms) {
+	unsigned long end = millis() + ms;
+	while (millis() < end) tick();
+}
+
+// ==============================================
+// Scenarios
+// ==============================================
+
+static bool broadcastSeen = true;
+
+// Every panel shows the same picture, and at least some of it was broadcast
+static void checkBroadcast(const char* what, uint64_t broadcastBefore) {
+	if (SimBus::broadcastBytes() > broadcastBefore && SimBus::panelsMatch(0xFF)) return;
+	fprintf(stderr, "%s: %s\n", what, SimBus::panelsMatch(0xFF) ? "nothing broadcast" : "panels differ");
+	broadcastSeen = false;
+}
+
+static void startupSplash(Scenario& scenario) {
+	Sample before = snapshot();
+	auto start = std::chrono::steady_clock::now();
+	setup();
+	hostNanos += std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - start).count();
+	checkBroadcast("startup splash", 0);
+	settle();
+	accumulate(scenario, before);
+}
+
+static void rowNavigation(Scenario& scenario) {
+	// Press, title shown, release; every column of both rows in turn
+	for (int row = 0; row < TOTAL_ROWS; row++) {
+		for (int column = 0; column < MAX_COLUMNS; column++) {
+			Sample before = snapshot();
+			SimGpio::setInput(ROW_PINS[row], LOW);
+			settle();
+			SimGpio::setInput(ROW_PINS[row], HIGH);
+			settle();
+			accumulate(scenario, before);
+			runFor(COLUMN_DISPLAY_TIME_MS);
+			settle();
+		}
+	}
+}
+
+static void taskToggle(Scenario& scenario) {
+	// Each switch on and back off again
+	for (int i = 0; i < TOTAL_TASK_BUTTONS; i++) {
+		for (int level = LOW; level <= HIGH; level++) {
+			Sample before = snapshot();
+			SimGpio::setInput(TASK_PINS[i], level == LOW ? LOW : HIGH);
+			settle();
+			accumulate(scenario, before);
+		}
+	}
+}
+
+static void demoActivation(Scenario& scenario) {
+	// Hold both row buttons until demo mode starts, then let the animation play out
+	Sample before = snapshot();
+	uint64_t broadcast = SimBus::broadcastBytes();
+	SimGpio::setInput(ROW_PINS[0], LOW);
+	SimGpio::setInput(ROW_PINS[1], LOW);
+	runFor(DEMO_ACTIVATION_HALFWAY_MS);
+	checkBroadcast("demo activation progress", broadcast);
+	for (int i = 0; i < 100000 && !isDemoMode; i++) tick();
+	SimGpio::setInput(ROW_PINS[0], HIGH);
+	SimGpio::setInput(ROW_PINS[1], HIGH);
+	finishTransition();
+	accumulate(scenario, before);
+}
+
+static bool animationSteady = true;
+
+static void demoSparkleFrame(Scenario& scenario) {
+	// Steady-state demo frames, one tick each
+	AnimationStats start = DisplayManager::getAnimationStats();
+	unsigned long startMs = millis();
+	for (int i = 0; i < 200; i++) {
+		Sample before = snapshot();
+		tick();
+		accumulate(scenario, before);
+	}
+	
+	// One frame per period, none passed over
+	AnimationStats end = DisplayManager::getAnimationStats();
+	uint32_t due = (millis() - startMs) / DemoAnimation::getFramePeriodMs();
+	uint32_t shown = end.frames - start.frames;
+	if (end.skipped != start.skipped || shown + 1 < due) {
+		fprintf(stderr, "demo animation: %u of %u frames shown, %u skipped\n", (unsigned)shown, (unsigned)due,
+		        (unsigned)(end.skipped - start.skipped));
+		animationSteady = false;
+	}
+}
+
+// HA responses are parsed from a Stream; this one reads a string in memory
+class PayloadStream : public Stream {
+public:
+	explicit PayloadStream(const std::string& text) : text(text), position(0) {}
+	int available() override { return text.size() - position; }
+	int read() override { return position < text.size() ? (uint8_t)text[position++] : -1; }
+	int peek() override { return position < text.size() ? (uint8_t)text[position] : -1; }
+	size_t write(uint8_t c) override { (void)c; return 0; }
+
+private:
+	const std::string& text;
+	size_t position;
+};
+
+// A task list as HA returns it: Task fields plus the calendar event's own,
+// which the filter has to skip
+static std::string taskPayload(int count) {
+	std::string description(480, 'x');
+	std::string payload = "[";
+	char task[1024];
+	for (int i = 0; i < count; i++) {
+		snprintf(task, sizeof(task),
+			"%s\n  {\"id\": \"task_%03d\", \"title\": \"Chore number %d\", \"person_id\": \"child%d\",\n"
+			"   \"state\": \"%s\", \"type\": \"%s\",\n"
+			"   \"start_time\": \"2024-01-15T%02d:00:00Z\", \"end_time\": %s,\n"
+			"   \"reward\": null, \"reward_time\": null, \"switch_id\": %d,\n"
+			"   \"description\": \"%s\",\n"
+			"   \"attendees\": [{\"name\": \"Parent\", \"response\": \"accepted\"}, {\"name\": \"Child\"}],\n"
+			"   \"attributes\": {\"location\": \"Home\", \"recurrence\": {\"freq\": \"DAILY\", \"count\": 30}}}",
+			i ? "," : "", i, i, i % 2 + 1, i % 5 ? "active" : "completed",
+			TaskManager::typeName((TaskType)(i % 3)), 6 + i % 12,
+			i % 3 ? "\"2024-01-15T22:30:00+01:00\"" : "null", i % TOTAL_TFT_DISPLAYS + 1,
+			description.c_str());
+		payload += task;
+	}
+	return payload + "\n]\n";
+}
+
+static bool feedComplete = true;
+
+static void taskFeed(Scenario& scenario, int count) {
+	std::string payload = taskPayload(count);
+	for (int i = 0; i < 20; i++) {
+		PayloadStream body(payload);
+		Sample before = snapshot();
+		auto start = std::chrono::steady_clock::now();
+		TaskFeedResult result = TaskFeed::sync(body);
+		hostNanos += std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - start).count();
+		accumulate(scenario, before);
+		if (!result.complete || result.received != count) feedComplete = false;
+	}
+}
+
+static void configLoad(Scenario& scenario) {
+	// setup() has already written the record
+	for (int i = 0; i < 20; i++) {
+		Sample before = snapshot();
+		auto start = std::chrono::steady_clock::now();
+		ConfigLoader::loadConfiguration();
+		hostNanos += std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - start).count();
+		accumulate(scenario, before);
+	}
+}
+
+static void configImport(Scenario& scenario) {
+	String json = ConfigLoader::generateConfigJSON(true);
+	for (int i = 0; i < 20; i++) {
+		Sample before = snapshot();
+		auto start = std::chrono::steady_clock::now();
+		ConfigLoader::parseConfigJSON(json);
+		hostNanos += std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - start).count();
+		accumulate(scenario, before);
+	}
+}
+
+static void taskFeedSmall(Scenario& scenario) {
+	taskFeed(scenario, 8);
+}
+
+static void taskFeedLarge(Scenario& scenario) {
+	taskFeed(scenario, 600);
+}
+
+// ==============================================
+// Report
+// ==============================================
+
+static void printScenario(const Scenario& scenario, bool last) {
+	double n = scenario.iterations ? scenario.iterations : 1;
+	printf("    {\"name\": \"%s\", \"iterations\": %d,\n", scenario.name, scenario.iterations);
+	printf("     \"host_us\": {\"mean\": %.1f, \"min\": %.1f, \"max\": %.1f},\n",
+	       scenario.total.hostNanos / n / 1000.0, scenario.minHostNanos / 1000.0,
+	       scenario.maxHostNanos / 1000.0);
+	printf("     \"sim_ms\": %.1f, \"bus_bytes\": %.0f, \"wire_us\": %.0f, \"allocs\": %.1f, \"alloc_bytes\": %.0f,\n",
+	       scenario.total.simMicros / n / 1000.0, scenario.total.busBytes / n,
+	       scenario.total.wireMicros / n, scenario.total.allocs / n, scenario.total.allocBytes / n);
+	printf("     \"heap_peak_bytes\": %llu}%s\n", (unsigned long long)scenario.heapPeakBytes, last ? "" : ",");
+}
+
+int main() {
+	Serial.setMuted(true);
+
+	Scenario scenarios[] = {
+		{"startup_splash", 0, {}, 0, 0, 0},
+		{"row_navigation", 0, {}, 0, 0, 0},
+		{"task_toggle", 0, {}, 0, 0, 0},
+		{"demo_activation", 0, {}, 0, 0, 0},
+		{"demo_sparkle_frame", 0, {}, 0, 0, 0},
+		{"config_load", 0, {}, 0, 0, 0},
+		{"config_import", 0, {}, 0, 0, 0},
+		{"task_feed_small", 0, {}, 0, 0, 0},
+		{"task_feed_large", 0, {}, 0, 0, 0}
+	};
+	void (*runs[])(Scenario&) = {startupSplash, rowNavigation, taskToggle, demoActivation, demoSparkleFrame,
+	                             configLoad, configImport, taskFeedSmall, taskFeedLarge};
+	const int count = sizeof(scenarios) / sizeof(scenarios[0]);
+
+	for (int i = 0; i < count; i++) {
+		runs[i](scenarios[i]);
+	}
+
+	printf("{\n  \"spi_hz\": %lu,\n  \"scenarios\": [\n", (unsigned long)SimBus::getClockHz());
+	for (int i = 0; i < count; i++) {
+		printScenario(scenarios[i], i == count - 1);
+	}
+	printf("  ]\n}\n");
+
+	// Feed RAM must not grow with the response
+	const Scenario& small = scenarios[count - 2];
+	const Scenario& large = scenarios[count - 1];
+	bool feedConstant = large.heapPeakBytes <= small.heapPeakBytes;
+	if (!feedComplete || !feedConstant) {
+		fprintf(stderr, "task feed: %s\n", feedComplete ? "heap grows with the response" : "sync incomplete");
+	}
+	return isDemoMode && broadcastSeen && animationSteady && feedComplete && feedConstant ? 0 : 1;
+}
@@ -0,0 +1,456 @@
+#include "Adafruit_GFX.h"
+#include "SimFont.h"
+
+#define SWAP_INT16(a, b) { int16_t t = a; a = b; b = t; }
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h)
+	: WIDTH(w), HEIGHT(h), _width(w), _height(h), cursor_x(0), cursor_y(0),
+	  textcolor(0xFFFF), textbgcolor(0xFFFF), textsize_x(1), textsize_y(1),
+	  rotation(0), wrap(true), _cp437(false) {
+}
+
+void Adafruit_GFX::setRotation(uint8_t r) {
+	rotation = r & 3;
+	switch (rotation) {
+		case 0:
+		case 2:
+			_width = WIDTH;
+			_height = HEIGHT;
+			break;
+		case 1:
+		case 3:
+			_width = HEIGHT;
+			_height = WIDTH;
+			break;
+	}
+}
+
+void Adafruit_GFX::writePixel(int16_t x, int16_t y, uint16_t colour) {
+	drawPixel(x, y, colour);
+}
+
+void Adafruit_GFX::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t colour) {
+	drawFastVLine(x, y, h, colour);
+}
+
+void Adafruit_GFX::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t colour) {
+	drawFastHLine(x, y, w, colour);
+}
+
+void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+	fillRect(x, y, w, h, colour);
+}
+
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour) {
+	int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+	if (steep) {
+		SWAP_INT16(x0, y0);
+		SWAP_INT16(x1, y1);
+	}
+	if (x0 > x1) {
+		SWAP_INT16(x0, x1);
+		SWAP_INT16(y0, y1);
+	}
+
+	int16_t dx = x1 - x0;
+	int16_t dy = abs(y1 - y0);
+	int16_t err = dx / 2;
+	int16_t ystep = (y0 < y1) ? 1 : -1;
+
+	for (; x0 <= x1; x0++) {
+		if (steep) {
+			writePixel(y0, x0, colour);
+		} else {
+			writePixel(x0, y0, colour);
+		}
+		err -= dy;
+		if (err < 0) {
+			y0 += ystep;
+			err += dx;
+		}
+	}
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t colour) {
+	startWrite();
+	writeLine(x, y, x, y + h - 1, colour);
+	endWrite();
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t colour) {
+	startWrite();
+	writeLine(x, y, x + w - 1, y, colour);
+	endWrite();
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+	startWrite();
+	for (int16_t i = x; i < x + w; i++) {
+		writeFastVLine(i, y, h, colour);
+	}
+	endWrite();
+}
+
+void Adafruit_GFX::fillScreen(uint16_t colour) {
+	fillRect(0, 0, _width, _height, colour);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour) {
+	if (x0 == x1) {
+		if (y0 > y1) SWAP_INT16(y0, y1);
+		drawFastVLine(x0, y0, y1 - y0 + 1, colour);
+	} else if (y0 == y1) {
+		if (x0 > x1) SWAP_INT16(x0, x1);
+		drawFastHLine(x0, y0, x1 - x0 + 1, colour);
+	} else {
+		startWrite();
+		writeLine(x0, y0, x1, y1, colour);
+		endWrite();
+	}
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+	startWrite();
+	writeFastHLine(x, y, w, colour);
+	writeFastHLine(x, y + h - 1, w, colour);
+	writeFastVLine(x, y, h, colour);
+	writeFastVLine(x + w - 1, y, h, colour);
+	endWrite();
+}
+
+void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t colour) {
+	int16_t f = 1 - r;
+	int16_t ddF_x = 1;
+	int16_t ddF_y = -2 * r;
+	int16_t x = 0;
+	int16_t y = r;
+
+	startWrite();
+	writePixel(x0, y0 + r, colour);
+	writePixel(x0, y0 - r, colour);
+	writePixel(x0 + r, y0, colour);
+	writePixel(x0 - r, y0, colour);
+
+	while (x < y) {
+		if (f >= 0) {
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+
+		writePixel(x0 + x, y0 + y, colour);
+		writePixel(x0 - x, y0 + y, colour);
+		writePixel(x0 + x, y0 - y, colour);
+		writePixel(x0 - x, y0 - y, colour);
+		writePixel(x0 + y, y0 + x, colour);
+		writePixel(x0 - y, y0 + x, colour);
+		writePixel(x0 + y, y0 - x, colour);
+		writePixel(x0 - y, y0 - x, colour);
+	}
+	endWrite();
+}
+
+void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t colour) {
+	int16_t f = 1 - r;
+	int16_t ddF_x = 1;
+	int16_t ddF_y = -2 * r;
+	int16_t x = 0;
+	int16_t y = r;
+
+	while (x < y) {
+		if (f >= 0) {
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+		if (cornername & 0x4) {
+			writePixel(x0 + x, y0 + y, colour);
+			writePixel(x0 + y, y0 + x, colour);
+		}
+		if (cornername & 0x2) {
+			writePixel(x0 + x, y0 - y, colour);
+			writePixel(x0 + y, y0 - x, colour);
+		}
+		if (cornername & 0x8) {
+			writePixel(x0 - y, y0 + x, colour);
+			writePixel(x0 - x, y0 + y, colour);
+		}
+		if (cornername & 0x1) {
+			writePixel(x0 - y, y0 - x, colour);
+			writePixel(x0 - x, y0 - y, colour);
+		}
+	}
+}
+
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t colour) {
+	startWrite();
+	writeFastVLine(x0, y0 - r, 2 * r + 1, colour);
+	fillCircleHelper(x0, y0, r, 3, 0, colour);
+	endWrite();
+}
+
+void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t colour) {
+	int16_t f = 1 - r;
+	int16_t ddF_x = 1;
+	int16_t ddF_y = -2 * r;
+	int16_t x = 0;
+	int16_t y = r;
+	int16_t px = x;
+	int16_t py = y;
+
+	delta++;  // Avoid some +1's in the loop
+
+	while (x < y) {
+		if (f >= 0) {
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+		// These checks avoid double-drawing certain lines
+		if (x < (y + 1)) {
+			if (corners & 1) writeFastVLine(x0 + x, y0 - y, 2 * y + delta, colour);
+			if (corners & 2) writeFastVLine(x0 - x, y0 - y, 2 * y + delta, colour);
+		}
+		if (y != py) {
+			if (corners & 1) writeFastVLine(x0 + py, y0 - px, 2 * px + delta, colour);
+			if (corners & 2) writeFastVLine(x0 - py, y0 - px, 2 * px + delta, colour);
+			py = y;
+		}
+		px = x;
+	}
+}
+
+void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t colour) {
+	drawLine(x0, y0, x1, y1, colour);
+	drawLine(x1, y1, x2, y2, colour);
+	drawLine(x2, y2, x0, y0, colour);
+}
+
+void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t colour) {
+	int16_t a, b, y, last;
+
+	// Sort coordinates by Y order (y2 >= y1 >= y0)
+	if (y0 > y1) {
+		SWAP_INT16(y0, y1);
+		SWAP_INT16(x0, x1);
+	}
+	if (y1 > y2) {
+		SWAP_INT16(y2, y1);
+		SWAP_INT16(x2, x1);
+	}
+	if (y0 > y1) {
+		SWAP_INT16(y0, y1);
+		SWAP_INT16(x0, x1);
+	}
+
+	startWrite();
+	if (y0 == y2) {
+		// All on the same line
+		a = b = x0;
+		if (x1 < a) a = x1;
+		else if (x1 > b) b = x1;
+		if (x2 < a) a = x2;
+		else if (x2 > b) b = x2;
+		writeFastHLine(a, y0, b - a + 1, colour);
+		endWrite();
+		return;
+	}
+
+	int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
+	        dx12 = x2 - x1, dy12 = y2 - y1;
+	int32_t sa = 0, sb = 0;
+
+	// Upper part: include y1 only if the lower part is flat
+	last = (y1 == y2) ? y1 : y1 - 1;
+
+	for (y = y0; y <= last; y++) {
+		a = x0 + sa / dy01;
+		b = x0 + sb / dy02;
+		sa += dx01;
+		sb += dx02;
+		if (a > b) SWAP_INT16(a, b);
+		writeFastHLine(a, y, b - a + 1, colour);
+	}
+
+	// Lower part
+	sa = (int32_t)dx12 * (y - y1);
+	sb = (int32_t)dx02 * (y - y0);
+	for (; y <= y2; y++) {
+		a = x1 + sa / dy12;
+		b = x0 + sb / dy02;
+		sa += dx12;
+		sb += dx02;
+		if (a > b) SWAP_INT16(a, b);
+		writeFastHLine(a, y, b - a + 1, colour);
+	}
+	endWrite();
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t colour) {
+	int16_t byteWidth = (w + 7) / 8;
+	uint8_t bits = 0;
+
+	startWrite();
+	for (int16_t j = 0; j < h; j++, y++) {
+		for (int16_t i = 0; i < w; i++) {
+			if (i & 7) {
+				bits <<= 1;
+			} else {
+				bits = bitmap[j * byteWidth + i / 8];
+			}
+			if (bits & 0x80) writePixel(x + i, y, colour);
+		}
+	}
+	endWrite();
+}
+
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) {
+	startWrite();
+	for (int16_t j = 0; j < h; j++, y++) {
+		for (int16_t i = 0; i < w; i++) {
+			writePixel(x + i, y, bitmap[j * w + i]);
+		}
+	}
+	endWrite();
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t colour, uint16_t bg, uint8_t size) {
+	drawChar(x, y, c, colour, bg, size, size);
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t colour, uint16_t bg, uint8_t size_x, uint8_t size_y) {
+	if ((x >= _width) || (y >= _height) || ((x + 6 * size_x - 1) < 0) || ((y + 8 * size_y - 1) < 0)) {
+		return;
+	}
+
+	// Same code page quirk as the library's built-in font
+	if (!_cp437 && (c >= 176)) c++;
+
+	startWrite();
+	for (int8_t i = 0; i < 5; i++) {
+		uint8_t line = simFontColumn(c, i);
+		for (int8_t j = 0; j < 8; j++, line >>= 1) {
+			if (line & 1) {
+				if (size_x == 1 && size_y == 1) {
+					writePixel(x + i, y + j, colour);
+				} else {
+					writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, colour);
+				}
+			} else if (bg != colour) {
+				if (size_x == 1 && size_y == 1) {
+					writePixel(x + i, y + j, bg);
+				} else {
+					writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, bg);
+				}
+			}
+		}
+	}
+	if (bg != colour) {
+		// Spacing column
+		if (size_x == 1 && size_y == 1) {
+			writeFastVLine(x + 5, y, 8, bg);
+		} else {
+			writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
+		}
+	}
+	endWrite();
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+	if (c == '\n') {
+		cursor_x = 0;
+		cursor_y += textsize_y * 8;
+	} else if (c != '\r') {
+		if (wrap && ((cursor_x + textsize_x * 6) > _width)) {
+			cursor_x = 0;
+			cursor_y += textsize_y * 8;
+		}
+		drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+		cursor_x += textsize_x * 6;
+	}
+	return 1;
+}
+
+void Adafruit_GFX::charBounds(unsigned char c, int16_t* x, int16_t* y, int16_t* minx, int16_t* miny, int16_t* maxx, int16_t* maxy) {
+	if (c == '\n') {
+		*x = 0;
+		*y += textsize_y * 8;
+	} else if (c != '\r') {
+		if (wrap && ((*x + textsize_x * 6) > _width)) {
+			*x = 0;
+			*y += textsize_y * 8;
+		}
+		int16_t x2 = *x + textsize_x * 6 - 1;
+		int16_t y2 = *y + textsize_y * 8 - 1;
+		if (x2 > *maxx) *maxx = x2;
+		if (y2 > *maxy) *maxy = y2;
+		if (*x < *minx) *minx = *x;
+		if (*y < *miny) *miny = *y;
+		*x += textsize_x * 6;
+	}
+}
+
+void Adafruit_GFX::getTextBounds(const char* str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+	int16_t minx = _width, miny = _height, maxx = -1, maxy = -1;
+	*x1 = x;
+	*y1 = y;
+	*w = *h = 0;
+
+	unsigned char c;
+	while ((c = *str++)) {
+		charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+	}
+
+	if (maxx >= minx) {
+		*x1 = minx;
+		*w = maxx - minx + 1;
+	}
+	if (maxy >= miny) {
+		*y1 = miny;
+		*h = maxy - miny + 1;
+	}
+}
+
+void Adafruit_GFX::getTextBounds(const String& str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+	getTextBounds(str.c_str(), x, y, x1, y1, w, h);
+}
+
+// ==============================================
+// GFXcanvas1
+// ==============================================
+
+GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+	buffer = (uint8_t*)calloc((w + 7) / 8 * h, 1);
+}
+
+GFXcanvas1::~GFXcanvas1() {
+	free(buffer);
+}
+
+void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t colour) {
+	if (!buffer || x < 0 || y < 0 || x >= _width || y >= _height) return;
+	uint8_t* ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+	if (colour) {
+		*ptr |= 0x80 >> (x & 7);
+	} else {
+		*ptr &= ~(0x80 >> (x & 7));
+	}
+}
+
+void GFXcanvas1::fillScreen(uint16_t colour) {
+	if (buffer) memset(buffer, colour ? 0xFF : 0x00, (WIDTH + 7) / 8 * HEIGHT);
+}
+
+bool GFXcanvas1::getPixel(int16_t x, int16_t y) const {
+	if (!buffer || x < 0 || y < 0 || x >= _width || y >= _height) return false;
+	return (buffer[(x / 8) + y * ((WIDTH + 7) / 8)] & (0x80 >> (x & 7))) != 0;
+}
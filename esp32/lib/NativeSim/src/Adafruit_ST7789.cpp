@@ -0,0 +1,305 @@
+#include "Adafruit_ST7789.h"
+
+// ==============================================
+// Adafruit_SPITFT
+// ==============================================
+
+Adafruit_SPITFT::Adafruit_SPITFT(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t rst)
+	: Adafruit_GFX(w, h), _cs(cs), _dc(dc), _rst(rst), _xstart(0), _ystart(0), _freq(0) {
+	// Panels constructed with cs = -1 have their CS driven externally; whoever
+	// drives it registers the pin with SimBus
+	if (cs >= 0) {
+		SimBus::addPanel(cs);
+	}
+}
+
+void Adafruit_SPITFT::initSPI(uint32_t freq, uint8_t spiMode) {
+	(void)spiMode;
+	_freq = freq;
+	if (_cs >= 0) {
+		pinMode(_cs, OUTPUT);
+		digitalWrite(_cs, HIGH);
+	}
+	pinMode(_dc, OUTPUT);
+	if (_rst >= 0) {
+		pinMode(_rst, OUTPUT);
+		digitalWrite(_rst, HIGH);
+		delay(100);
+		digitalWrite(_rst, LOW);
+		delay(100);
+		digitalWrite(_rst, HIGH);
+		delay(200);
+	}
+}
+
+void Adafruit_SPITFT::SPI_CS_LOW() {
+	if (_cs >= 0) digitalWrite(_cs, LOW);
+}
+
+void Adafruit_SPITFT::SPI_CS_HIGH() {
+	if (_cs >= 0) digitalWrite(_cs, HIGH);
+}
+
+void Adafruit_SPITFT::startWrite() {
+	SPI_CS_LOW();
+}
+
+void Adafruit_SPITFT::endWrite() {
+	SPI_CS_HIGH();
+}
+
+void Adafruit_SPITFT::writeCommand(uint8_t cmd) {
+	SimBus::writeCommand(cmd);
+}
+
+void Adafruit_SPITFT::spiWrite(uint8_t b) {
+	SimBus::writeData(&b, 1);
+}
+
+void Adafruit_SPITFT::SPI_WRITE16(uint16_t w) {
+	uint8_t bytes[2] = { (uint8_t)(w >> 8), (uint8_t)w };
+	SimBus::writeData(bytes, 2);
+}
+
+void Adafruit_SPITFT::SPI_WRITE32(uint32_t l) {
+	uint8_t bytes[4] = { (uint8_t)(l >> 24), (uint8_t)(l >> 16), (uint8_t)(l >> 8), (uint8_t)l };
+	SimBus::writeData(bytes, 4);
+}
+
+void Adafruit_SPITFT::sendCommand(uint8_t commandByte, const uint8_t* dataBytes, uint8_t numDataBytes) {
+	SPI_CS_LOW();
+	writeCommand(commandByte);
+	if (numDataBytes > 0) {
+		SimBus::writeData(dataBytes, numDataBytes);
+	}
+	SPI_CS_HIGH();
+}
+
+void Adafruit_SPITFT::writePixels(uint16_t* colours, uint32_t len, bool block, bool bigEndian) {
+	(void)block;
+	if (!bigEndian) {
+		SimBus::writePixels(colours, len);
+		return;
+	}
+	// Caller already byte-swapped the buffer; undo it so the model sees RGB565
+	for (uint32_t i = 0; i < len; i++) {
+		uint16_t c = (uint16_t)((colours[i] << 8) | (colours[i] >> 8));
+		SimBus::writePixels(&c, 1);
+	}
+}
+
+void Adafruit_SPITFT::writeColor(uint16_t colour, uint32_t len) {
+	SimBus::writeColour(colour, len);
+}
+
+void Adafruit_SPITFT::writePixel(int16_t x, int16_t y, uint16_t colour) {
+	if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
+		setAddrWindow(x, y, 1, 1);
+		SPI_WRITE16(colour);
+	}
+}
+
+void Adafruit_SPITFT::writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+	setAddrWindow(x, y, w, h);
+	writeColor(colour, (uint32_t)w * h);
+}
+
+void Adafruit_SPITFT::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+	if (w && h) {
+		if (w < 0) {
+			x += w + 1;
+			w = -w;
+		}
+		if (x < _width) {
+			if (h < 0) {
+				y += h + 1;
+				h = -h;
+			}
+			if (y < _height) {
+				int16_t x2 = x + w - 1;
+				if (x2 >= 0) {
+					int16_t y2 = y + h - 1;
+					if (y2 >= 0) {
+						if (x < 0) {
+							x = 0;
+							w = x2 + 1;
+						}
+						if (y < 0) {
+							y = 0;
+							h = y2 + 1;
+						}
+						if (x2 >= _width) w = _width - x;
+						if (y2 >= _height) h = _height - y;
+						writeFillRectPreclipped(x, y, w, h, colour);
+					}
+				}
+			}
+		}
+	}
+}
+
+void Adafruit_SPITFT::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t colour) {
+	writeFillRect(x, y, w, 1, colour);
+}
+
+void Adafruit_SPITFT::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t colour) {
+	writeFillRect(x, y, 1, h, colour);
+}
+
+void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t colour) {
+	if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
+		startWrite();
+		setAddrWindow(x, y, 1, 1);
+		SPI_WRITE16(colour);
+		endWrite();
+	}
+}
+
+void Adafruit_SPITFT::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+	startWrite();
+	writeFillRect(x, y, w, h, colour);
+	endWrite();
+}
+
+void Adafruit_SPITFT::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t colour) {
+	startWrite();
+	writeFillRect(x, y, w, 1, colour);
+	endWrite();
+}
+
+void Adafruit_SPITFT::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t colour) {
+	startWrite();
+	writeFillRect(x, y, 1, h, colour);
+	endWrite();
+}
+
+void Adafruit_SPITFT::invertDisplay(bool i) {
+	sendCommand(i ? ST77XX_INVON : ST77XX_INVOFF);
+}
+
+// ==============================================
+// Adafruit_ST77xx
+// ==============================================
+
+void Adafruit_ST77xx::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+	x += _xstart;
+	y += _ystart;
+	uint32_t xa = ((uint32_t)x << 16) | (x + w - 1);
+	uint32_t ya = ((uint32_t)y << 16) | (y + h - 1);
+
+	writeCommand(ST77XX_CASET);
+	SPI_WRITE32(xa);
+	writeCommand(ST77XX_RASET);
+	SPI_WRITE32(ya);
+	writeCommand(ST77XX_RAMWR);
+}
+
+void Adafruit_ST77xx::setRotation(uint8_t r) {
+	Adafruit_GFX::setRotation(r);
+}
+
+void Adafruit_ST77xx::enableDisplay(bool enable) {
+	sendCommand(enable ? ST77XX_DISPON : ST77XX_DISPOFF);
+}
+
+void Adafruit_ST77xx::enableSleep(bool enable) {
+	sendCommand(enable ? ST77XX_SLPIN : ST77XX_SLPOUT);
+}
+
+void Adafruit_ST77xx::begin(uint32_t freq) {
+	initSPI(freq);
+}
+
+void Adafruit_ST77xx::commonInit(const uint8_t* cmdList) {
+	begin();
+	if (cmdList) {
+		displayInit(cmdList);
+	}
+}
+
+// Same encoding as the library: count, then per command: cmd, args|delay flag,
+// args..., optional delay byte (255 = 500 ms)
+void Adafruit_ST77xx::displayInit(const uint8_t* addr) {
+	uint8_t numCommands = *addr++;
+	while (numCommands--) {
+		uint8_t cmd = *addr++;
+		uint8_t numArgs = *addr++;
+		uint16_t ms = numArgs & 0x80;
+		numArgs &= 0x7F;
+		sendCommand(cmd, addr, numArgs);
+		addr += numArgs;
+		if (ms) {
+			ms = *addr++;
+			if (ms == 255) ms = 500;
+			delay(ms);
+		}
+	}
+}
+
+// ==============================================
+// Adafruit_ST7789
+// ==============================================
+
+static const uint8_t generic_st7789[] = {
+	9,
+	ST77XX_SWRESET, 0x80, 150,
+	ST77XX_SLPOUT, 0x80, 10,
+	ST77XX_COLMOD, 1 | 0x80, 0x55, 10,
+	ST77XX_MADCTL, 1, 0x08,
+	ST77XX_CASET, 4, 0, 0, 0, 240,
+	ST77XX_RASET, 4, 0, 0, 320 >> 8, 320 & 0xFF,
+	ST77XX_INVON, 0x80, 10,
+	ST77XX_NORON, 0x80, 10,
+	ST77XX_DISPON, 0x80, 10,
+};
+
+Adafruit_ST7789::Adafruit_ST7789(int8_t cs, int8_t dc, int8_t rst)
+	: Adafruit_ST77xx(240, 320, cs, dc, rst) {
+}
+
+void Adafruit_ST7789::init(uint16_t width, uint16_t height, uint8_t spiMode) {
+	(void)spiMode;
+	windowWidth = width;
+	windowHeight = height;
+	commonInit(nullptr);
+	displayInit(generic_st7789);
+
+	// Tell the panel models the native size of whichever panels were listening
+	startWrite();
+	SimBus::setSelectedGeometry(width, height);
+	endWrite();
+
+	setRotation(0);
+}
+
+void Adafruit_ST7789::setRotation(uint8_t m) {
+	uint8_t madctl = 0;
+	rotation = m & 3;
+
+	switch (rotation) {
+		case 0:
+			madctl = ST77XX_MADCTL_MX | ST77XX_MADCTL_MY | ST77XX_MADCTL_RGB;
+			_width = windowWidth;
+			_height = windowHeight;
+			break;
+		case 1:
+			madctl = ST77XX_MADCTL_MY | ST77XX_MADCTL_MV | ST77XX_MADCTL_RGB;
+			_width = windowHeight;
+			_height = windowWidth;
+			break;
+		case 2:
+			madctl = ST77XX_MADCTL_RGB;
+			_width = windowWidth;
+			_height = windowHeight;
+			break;
+		case 3:
+			madctl = ST77XX_MADCTL_MX | ST77XX_MADCTL_MV | ST77XX_MADCTL_RGB;
+			_width = windowHeight;
+			_height = windowWidth;
+			break;
+	}
+	_xstart = _colstart;
+	_ystart = _rowstart;
+
+	sendCommand(ST77XX_MADCTL, &madctl, 1);
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include "Adafruit_GFX.h"
+#include "SimBus.h"
+
+// ==============================================
+// Native stand-in for Adafruit_SPITFT / ST77xx / ST7789
+// ==============================================
+// Same public API and the same byte stream as the real driver (CASET/RASET/
+// RAMWR windows, big-endian pixels), but every byte goes to SimBus instead of
+// a SPI peripheral. Panel column/row offsets are left at zero so the recorded
+// panel RAM lines up with the drawing coordinates.
+
+#define ST77XX_NOP 0x00
+#define ST77XX_SWRESET 0x01
+#define ST77XX_SLPIN 0x10
+#define ST77XX_SLPOUT 0x11
+#define ST77XX_NORON 0x13
+#define ST77XX_INVOFF 0x20
+#define ST77XX_INVON 0x21
+#define ST77XX_DISPOFF 0x28
+#define ST77XX_DISPON 0x29
+#define ST77XX_CASET 0x2A
+#define ST77XX_RASET 0x2B
+#define ST77XX_RAMWR 0x2C
+#define ST77XX_MADCTL 0x36
+#define ST77XX_COLMOD 0x3A
+
+#define ST77XX_MADCTL_MY 0x80
+#define ST77XX_MADCTL_MX 0x40
+#define ST77XX_MADCTL_MV 0x20
+#define ST77XX_MADCTL_RGB 0x00
+
+#define ST77XX_BLACK 0x0000
+#define ST77XX_WHITE 0xFFFF
+#define ST77XX_RED 0xF800
+#define ST77XX_GREEN 0x07E0
+#define ST77XX_BLUE 0x001F
+#define ST77XX_CYAN 0x07FF
+#define ST77XX_MAGENTA 0xF81F
+#define ST77XX_YELLOW 0xFFE0
+#define ST77XX_ORANGE 0xFC00
+
+#define SPI_MODE0 0x00
+
+class Adafruit_SPITFT : public Adafruit_GFX {
+public:
+	Adafruit_SPITFT(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t rst);
+
+	virtual void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) = 0;
+
+	void startWrite() override;
+	void endWrite() override;
+	void writePixel(int16_t x, int16_t y, uint16_t colour) override;
+	void writePixels(uint16_t* colours, uint32_t len, bool block = true, bool bigEndian = false);
+	void writeColor(uint16_t colour, uint32_t len);
+	void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) override;
+	void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t colour) override;
+	void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t colour) override;
+	void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+	void dmaWait() {}
+	bool dmaBusy() const { return false; }
+
+	void drawPixel(int16_t x, int16_t y, uint16_t colour) override;
+	void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) override;
+	void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t colour) override;
+	void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t colour) override;
+	void invertDisplay(bool i) override;
+	uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+		return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+	}
+
+	void sendCommand(uint8_t commandByte, const uint8_t* dataBytes = nullptr, uint8_t numDataBytes = 0);
+	void writeCommand(uint8_t cmd);
+	void spiWrite(uint8_t b);
+	void SPI_WRITE16(uint16_t w);
+	void SPI_WRITE32(uint32_t l);
+
+protected:
+	void initSPI(uint32_t freq = 0, uint8_t spiMode = SPI_MODE0);
+	void SPI_CS_LOW();
+	void SPI_CS_HIGH();
+
+	int8_t _cs;
+	int8_t _dc;
+	int8_t _rst;
+	int16_t _xstart;
+	int16_t _ystart;
+	uint32_t _freq;
+};
+
+class Adafruit_ST77xx : public Adafruit_SPITFT {
+public:
+	Adafruit_ST77xx(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t rst)
+		: Adafruit_SPITFT(w, h, cs, dc, rst) {}
+
+	void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override;
+	void setRotation(uint8_t r) override;
+	void enableDisplay(bool enable);
+	void enableSleep(bool enable);
+
+protected:
+	void begin(uint32_t freq = 0);
+	void commonInit(const uint8_t* cmdList);
+	void displayInit(const uint8_t* addr);
+
+	uint8_t _colstart = 0;
+	uint8_t _rowstart = 0;
+};
+
+class Adafruit_ST7789 : public Adafruit_ST77xx {
+public:
+	Adafruit_ST7789(int8_t cs, int8_t dc, int8_t rst);
+
+	void init(uint16_t width = 240, uint16_t height = 240, uint8_t spiMode = SPI_MODE0);
+	void setRotation(uint8_t m) override;
+
+private:
+	uint16_t windowWidth = 240;
+	uint16_t windowHeight = 320;
+};
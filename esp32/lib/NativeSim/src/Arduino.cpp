@@ -0,0 +1,282 @@
+#include "Arduino.h"
+#include "SimBus.h"
+#include <stdio.h>
+#include <ctype.h>
+#include <string>
+
+HardwareSerial Serial;
+
+// ==============================================
+// Print
+// ==============================================
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+	size_t n = 0;
+	while (size--) {
+		n += write(*buffer++);
+	}
+	return n;
+}
+
+size_t Print::write(const char* str) {
+	return str ? write((const uint8_t*)str, strlen(str)) : 0;
+}
+
+size_t Print::print(const char* str) { return write(str); }
+size_t Print::print(const String& str) { return write(str.c_str()); }
+size_t Print::print(char c) { return write((uint8_t)c); }
+
+size_t Print::print(int value, int base) { return print((long)value, base); }
+size_t Print::print(unsigned int value, int base) { return print((unsigned long)value, base); }
+
+size_t Print::print(long value, int base) {
+	if (base == 10) return printf("%ld", value);
+	return print((unsigned long)value, base);
+}
+
+size_t Print::print(unsigned long value, int base) {
+	if (base == 16) return printf("%lX", value);
+	if (base == 8) return printf("%lo", value);
+	return printf("%lu", value);
+}
+
+size_t Print::print(double value, int digits) { return printf("%.*f", digits, value); }
+size_t Print::println() { return write("\r\n"); }
+
+size_t Print::printf(const char* format, ...) {
+	va_list args;
+	va_start(args, format);
+	size_t n = vprintf(format, args);
+	va_end(args);
+	return n;
+}
+
+size_t Print::vprintf(const char* format, va_list args) {
+	char buffer[256];
+	va_list copy;
+	va_copy(copy, args);
+	int len = vsnprintf(buffer, sizeof(buffer), format, copy);
+	va_end(copy);
+	if (len < 0) return 0;
+	if ((size_t)len < sizeof(buffer)) {
+		return write((const uint8_t*)buffer, len);
+	}
+
+	std::string large(len + 1, '\0');
+	vsnprintf(&large[0], large.size(), format, args);
+	return write((const uint8_t*)large.data(), len);
+}
+
+// ==============================================
+// String
+// ==============================================
+
+String::String(float v, unsigned int decimals) : String((double)v, decimals) {}
+
+String::String(double v, unsigned int decimals) {
+	char buffer[32];
+	snprintf(buffer, sizeof(buffer), "%.*f", decimals, v);
+	value = buffer;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+	size_t pos = value.find(c, from);
+	return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String& str, unsigned int from) const {
+	size_t pos = value.find(str.value, from);
+	return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int from) const {
+	return from >= value.size() ? String() : String(value.substr(from));
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+	if (from > to) std::swap(from, to);
+	if (from >= value.size()) return String();
+	return String(value.substr(from, to - from));
+}
+
+bool String::startsWith(const String& prefix) const {
+	return value.compare(0, prefix.value.size(), prefix.value) == 0;
+}
+
+bool String::endsWith(const String& suffix) const {
+	return value.size() >= suffix.value.size() &&
+	       value.compare(value.size() - suffix.value.size(), suffix.value.size(), suffix.value) == 0;
+}
+
+void String::trim() {
+	size_t start = 0;
+	while (start < value.size() && isspace((unsigned char)value[start])) start++;
+	size_t end = value.size();
+	while (end > start && isspace((unsigned char)value[end - 1])) end--;
+	value = value.substr(start, end - start);
+}
+
+void String::toLowerCase() {
+	for (char& c : value) c = tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+	for (char& c : value) c = toupper((unsigned char)c);
+}
+
+long String::toInt() const { return strtol(value.c_str(), nullptr, 10); }
+float String::toFloat() const { return strtof(value.c_str(), nullptr); }
+
+// ==============================================
+// Serial
+// ==============================================
+
+size_t HardwareSerial::write(uint8_t c) {
+	if (!muted) fputc(c, stdout);
+	return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+	if (!muted) fwrite(buffer, 1, size, stdout);
+	return size;
+}
+
+int HardwareSerial::available() {
+	return inputHead - inputTail;
+}
+
+int HardwareSerial::read() {
+	if (inputTail == inputHead) return -1;
+	return (uint8_t)input[inputTail++ % sizeof(input)];
+}
+
+int HardwareSerial::peek() {
+	if (inputTail == inputHead) return -1;
+	return (uint8_t)input[inputTail % sizeof(input)];
+}
+
+void HardwareSerial::feed(const char* text) {
+	// Like a UART FIFO, input beyond the buffer is lost
+	for (; *text && inputHead - inputTail < sizeof(input); text++) {
+		input[inputHead++ % sizeof(input)] = *text;
+	}
+}
+
+// ==============================================
+// Stream
+// ==============================================
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+	size_t n = 0;
+	while (n < length) {
+		int c = read();
+		if (c < 0) break;
+		buffer[n++] = (char)c;
+	}
+	return n;
+}
+
+// ==============================================
+// Simulated clock
+// ==============================================
+
+static uint64_t simMicros = 0;
+
+void SimClock::advanceMicros(uint64_t us) { simMicros += us; }
+uint64_t SimClock::nowMicros() { return simMicros; }
+void SimClock::reset() { simMicros = 0; }
+
+unsigned long millis() { return (unsigned long)(simMicros / 1000); }
+unsigned long micros() { return (unsigned long)simMicros; }
+void delay(unsigned long ms) { simMicros += (uint64_t)ms * 1000; }
+void delayMicroseconds(unsigned int us) { simMicros += us; }
+void yield() {}
+
+// ==============================================
+// GPIO
+// ==============================================
+
+struct SimPin {
+	uint8_t mode;
+	uint8_t level;
+	uint32_t writes;
+	void (*handler)();
+	int interruptMode;
+};
+
+static SimPin pins[SimGpio::PIN_COUNT];
+
+void pinMode(uint8_t pin, uint8_t mode) {
+	if (pin >= SimGpio::PIN_COUNT) return;
+	pins[pin].mode = mode;
+	if (mode == INPUT_PULLUP) pins[pin].level = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+	if (pin >= SimGpio::PIN_COUNT) return;
+	pins[pin].level = level ? HIGH : LOW;
+	pins[pin].writes++;
+	SimBus::pinChanged(pin, pins[pin].level);
+}
+
+int digitalRead(uint8_t pin) {
+	return pin < SimGpio::PIN_COUNT ? pins[pin].level : LOW;
+}
+
+void attachInterrupt(uint8_t interrupt, void (*handler)(), int mode) {
+	if (interrupt >= SimGpio::PIN_COUNT) return;
+	pins[interrupt].handler = handler;
+	pins[interrupt].interruptMode = mode;
+}
+
+void detachInterrupt(uint8_t interrupt) {
+	if (interrupt < SimGpio::PIN_COUNT) pins[interrupt].handler = nullptr;
+}
+
+void SimGpio::setInput(uint8_t pin, uint8_t level) {
+	if (pin >= PIN_COUNT) return;
+	uint8_t previous = pins[pin].level;
+	pins[pin].level = level ? HIGH : LOW;
+	if (previous == pins[pin].level || !pins[pin].handler) return;
+
+	bool rising = pins[pin].level == HIGH;
+	int mode = pins[pin].interruptMode;
+	if (mode == CHANGE || (mode == RISING && rising) || (mode == FALLING && !rising)) {
+		pins[pin].handler();
+	}
+}
+
+uint8_t SimGpio::getOutput(uint8_t pin) {
+	return pin < PIN_COUNT ? pins[pin].level : LOW;
+}
+
+uint32_t SimGpio::getWriteCount(uint8_t pin) {
+	return pin < PIN_COUNT ? pins[pin].writes : 0;
+}
+
+void SimGpio::resetCounters() {
+	for (int i = 0; i < PIN_COUNT; i++) pins[i].writes = 0;
+}
+
+// ==============================================
+// Random
+// ==============================================
+
+static uint32_t randomState = 0x12345678;
+
+void randomSeed(unsigned long seed) {
+	randomState = seed ? (uint32_t)seed : 0x12345678;
+}
+
+long random(long max) {
+	if (max <= 0) return 0;
+	// xorshift32 - deterministic across hosts
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return (long)(randomState % (uint32_t)max);
+}
+
+long random(long min, long max) {
+	return max <= min ? min : min + random(max - min);
+}
@@ -0,0 +1,102 @@
+#pragma once
+// ==============================================
+// Native stand-in for the Arduino core
+// ==============================================
+// Just enough of the ESP32 Arduino API for the firmware sources to build
+// and run on a Linux host. Time is simulated: delay() advances the clock
+// instead of sleeping, so a 10 s demo runs in milliseconds.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include "Print.h"
+#include "Stream.h"
+#include "WString.h"
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#define IRAM_ATTR
+#define F(str) (str)
+
+using std::min;
+using std::max;
+
+template <typename T, typename L, typename H>
+T constrain(T value, L low, H high) {
+	return value < low ? low : (value > high ? high : value);
+}
+
+// Serial port writing to stdout (or nowhere when muted); input is whatever
+// the host has fed in
+class HardwareSerial : public Stream {
+public:
+	void begin(unsigned long baud) { (void)baud; }
+	int available() override;
+	int read() override;
+	int peek() override;
+	void flush() {}
+	size_t write(uint8_t c) override;
+	size_t write(const uint8_t* buffer, size_t size) override;
+	using Print::write;
+
+	void setMuted(bool muted) { this->muted = muted; }
+	void feed(const char* text);
+
+private:
+	bool muted = false;
+	char input[256];
+	size_t inputHead = 0;
+	size_t inputTail = 0;
+};
+
+extern HardwareSerial Serial;
+
+// Timing (simulated)
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// GPIO
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+void attachInterrupt(uint8_t interrupt, void (*handler)(), int mode);
+void detachInterrupt(uint8_t interrupt);
+#define digitalPinToInterrupt(pin) (pin)
+
+// Random numbers (deterministic unless reseeded)
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+// Host-side controls for the simulated clock and inputs
+namespace SimClock {
+	void advanceMicros(uint64_t us);
+	uint64_t nowMicros();
+	void reset();
+}
+
+namespace SimGpio {
+	static const int PIN_COUNT = 40;
+	void setInput(uint8_t pin, uint8_t level);   // Fires attached interrupts on edges
+	uint8_t getOutput(uint8_t pin);
+	uint32_t getWriteCount(uint8_t pin);
+	void resetCounters();
+}
@@ -0,0 +1,90 @@
+#include "HTTPClient.h"
+#include <stdio.h>
+#include <strings.h>
+
+bool HTTPClient::begin(const String& url) {
+	end();
+	String rest = url;
+	if (!rest.startsWith("http://")) return false;
+	rest = rest.substring(7);
+
+	int slash = rest.indexOf('/');
+	String authority = slash < 0 ? rest : rest.substring(0, slash);
+	path = slash < 0 ? String("/") : rest.substring(slash);
+
+	int colon = authority.indexOf(':');
+	host = colon < 0 ? authority : authority.substring(0, colon);
+	port = colon < 0 ? 80 : authority.substring(colon + 1).toInt();
+	requestHeaders = String();
+	size = -1;
+	return host.length() > 0;
+}
+
+void HTTPClient::end() {
+	client.stop();
+}
+
+void HTTPClient::addHeader(const String& name, const String& value) {
+	requestHeaders += name + ": " + value + "\r\n";
+}
+
+void HTTPClient::collectHeaders(const char* headerKeys[], const size_t headerKeysCount) {
+	keyCount = headerKeysCount < MAX_HEADERS ? headerKeysCount : MAX_HEADERS;
+	for (size_t i = 0; i < keyCount; i++) {
+		keys[i] = headerKeys[i];
+		values[i] = String();
+	}
+}
+
+bool HTTPClient::readLine(String& line) {
+	line = String();
+	for (;;) {
+		int c = client.read();
+		if (c < 0) return false;
+		if (c == '\n') return true;
+		if (c != '\r') line += (char)c;
+	}
+}
+
+int HTTPClient::GET() {
+	client.setTimeout(timeoutMs);
+	if (!client.connect(host.c_str(), port)) return HTTPC_ERROR_CONNECTION_REFUSED;
+
+	String request = String("GET ") + path + " HTTP/1.0\r\nHost: " + host + "\r\nConnection: close\r\n" +
+	                 requestHeaders + "\r\n";
+	if (client.write((const uint8_t*)request.c_str(), request.length()) != request.length()) {
+		return HTTPC_ERROR_SEND_HEADER_FAILED;
+	}
+
+	String line;
+	int status = 0;
+	if (!readLine(line) || sscanf(line.c_str(), "HTTP/%*d.%*d %d", &status) != 1) {
+		return HTTPC_ERROR_READ_TIMEOUT;
+	}
+	for (size_t i = 0; i < keyCount; i++) values[i] = String();
+
+	// Headers up to the blank line; the body is left on the stream
+	while (readLine(line) && line.length() > 0) {
+		int colon = line.indexOf(':');
+		if (colon < 0) continue;
+		String name = line.substring(0, colon);
+		String value = line.substring(colon + 1);
+		value.trim();
+		if (strcasecmp(name.c_str(), "Content-Length") == 0) size = value.toInt();
+		for (size_t i = 0; i < keyCount; i++) {
+			if (strcasecmp(name.c_str(), keys[i]) == 0) values[i] = value;
+		}
+	}
+	return status;
+}
+
+String HTTPClient::header(const char* name) {
+	for (size_t i = 0; i < keyCount; i++) {
+		if (strcasecmp(name, keys[i]) == 0) return values[i];
+	}
+	return String();
+}
+
+bool HTTPClient::hasHeader(const char* name) {
+	return header(name).length() > 0;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "WiFi.h"
+
+// ==============================================
+// Native stand-in for the ESP32 HTTPClient
+// ==============================================
+// Plain http:// over WiFiClient, one request per connection, always
+// HTTP/1.0 so the body is never chunked. Connections are routed by
+// SIM_NET_HOST like any other WiFiClient.
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_NOT_MODIFIED 304
+#define HTTP_CODE_NOT_FOUND 404
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+class HTTPClient {
+public:
+	bool begin(const String& url);
+	void end();
+
+	void useHTTP10(bool use) { (void)use; }
+	void setTimeout(uint16_t timeout) { timeoutMs = timeout; }
+	void addHeader(const String& name, const String& value);
+	void collectHeaders(const char* headerKeys[], const size_t headerKeysCount);
+
+	int GET();
+	String header(const char* name);
+	bool hasHeader(const char* name);
+	int getSize() { return size; }
+	WiFiClient& getStream() { return client; }
+
+private:
+	static const int MAX_HEADERS = 8;
+
+	bool readLine(String& line);
+
+	WiFiClient client;
+	String host;
+	uint16_t port = 80;
+	String path;
+	String requestHeaders;
+	uint16_t timeoutMs = 5000;
+	const char* keys[MAX_HEADERS] = {};
+	String values[MAX_HEADERS];
+	size_t keyCount = 0;
+	int size = -1;
+};
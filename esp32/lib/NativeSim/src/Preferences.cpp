@@ -0,0 +1,169 @@
+#include "Preferences.h"
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// NVS limits namespace and key names to 15 characters
+static const size_t NVS_KEY_NAME_MAX = 15;
+
+struct NvsEntry {
+	char type;                // 'b'ool, 'i'nt, 'u'int, 's'tring, 'B'ytes
+	std::string value;
+};
+
+typedef std::map<std::string, std::map<std::string, NvsEntry>> NvsStore;
+
+static NvsStore store;
+static bool loaded = false;
+
+// One entry per line: namespace, key, type and the value in hex
+static void loadStore() {
+	loaded = true;
+	const char* path = getenv("SIM_NVS");
+	FILE* file = path && *path ? fopen(path, "r") : nullptr;
+	if (!file) return;
+	char space[32], key[32], type;
+	char hex[8192];
+	while (fscanf(file, "%31s %31s %c %8191s", space, key, &type, hex) == 4) {
+		NvsEntry& entry = store[space][key];
+		entry.type = type;
+		entry.value.clear();
+		for (size_t i = 1; hex[i] && hex[i + 1]; i += 2) {
+			char byte[3] = {hex[i], hex[i + 1], 0};
+			entry.value += (char)strtol(byte, nullptr, 16);
+		}
+	}
+	fclose(file);
+}
+
+static void saveStore() {
+	const char* path = getenv("SIM_NVS");
+	FILE* file = path && *path ? fopen(path, "w") : nullptr;
+	if (!file) return;
+	for (const auto& space : store) {
+		for (const auto& key : space.second) {
+			// A leading '=' keeps empty values a field of their own
+			fprintf(file, "%s %s %c =", space.first.c_str(), key.first.c_str(), key.second.type);
+			for (unsigned char c : key.second.value) fprintf(file, "%02x", c);
+			fprintf(file, "\n");
+		}
+	}
+	fclose(file);
+}
+
+static bool validName(const char* name) {
+	return name && *name && strlen(name) <= NVS_KEY_NAME_MAX;
+}
+
+bool Preferences::begin(const char* name, bool readOnly, const char* partitionLabel) {
+	(void)partitionLabel;
+	if (!validName(name)) return false;
+	if (!loaded) loadStore();
+	space = name;
+	this->readOnly = readOnly;
+	return true;
+}
+
+void Preferences::end() {
+	space.clear();
+}
+
+bool Preferences::clear() {
+	if (space.empty() || readOnly) return false;
+	store[space].clear();
+	saveStore();
+	return true;
+}
+
+bool Preferences::remove(const char* key) {
+	if (space.empty() || readOnly) return false;
+	if (store[space].erase(key ? key : "") == 0) return false;
+	saveStore();
+	return true;
+}
+
+bool Preferences::isKey(const char* key) {
+	return !space.empty() && key && store[space].count(key) > 0;
+}
+
+size_t Preferences::put(const char* key, char type, const void* value, size_t length) {
+	if (space.empty() || readOnly || !validName(key)) return 0;
+	NvsEntry& entry = store[space][key];
+	entry.type = type;
+	entry.value.assign((const char*)value, length);
+	saveStore();
+	return length;
+}
+
+const std::string* Preferences::find(const char* key, char type) {
+	if (space.empty() || !key) return nullptr;
+	auto& entries = store[space];
+	auto it = entries.find(key);
+	return it != entries.end() && it->second.type == type ? &it->second.value : nullptr;
+}
+
+size_t Preferences::putBool(const char* key, bool value) {
+	uint8_t byte = value ? 1 : 0;
+	return put(key, 'b', &byte, 1);
+}
+
+size_t Preferences::putInt(const char* key, int32_t value) {
+	return put(key, 'i', &value, sizeof(value));
+}
+
+size_t Preferences::putUInt(const char* key, uint32_t value) {
+	return put(key, 'u', &value, sizeof(value));
+}
+
+size_t Preferences::putString(const char* key, const char* value) {
+	return put(key, 's', value ? value : "", value ? strlen(value) : 0);
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+	return value && length ? put(key, 'B', value, length) : 0;
+}
+
+bool Preferences::getBool(const char* key, bool defaultValue) {
+	const std::string* value = find(key, 'b');
+	return value && value->size() == 1 ? (*value)[0] != 0 : defaultValue;
+}
+
+int32_t Preferences::getInt(const char* key, int32_t defaultValue) {
+	const std::string* value = find(key, 'i');
+	int32_t result = defaultValue;
+	if (value && value->size() == sizeof(result)) memcpy(&result, value->data(), sizeof(result));
+	return result;
+}
+
+uint32_t Preferences::getUInt(const char* key, uint32_t defaultValue) {
+	const std::string* value = find(key, 'u');
+	uint32_t result = defaultValue;
+	if (value && value->size() == sizeof(result)) memcpy(&result, value->data(), sizeof(result));
+	return result;
+}
+
+size_t Preferences::getString(const char* key, char* value, size_t maxLength) {
+	const std::string* stored = find(key, 's');
+	if (!stored || !value || stored->size() + 1 > maxLength) return 0;
+	memcpy(value, stored->c_str(), stored->size() + 1);
+	return stored->size() + 1;
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) {
+	const std::string* stored = find(key, 's');
+	return stored ? String(stored->c_str()) : defaultValue;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+	const std::string* stored = find(key, 'B');
+	return stored ? stored->size() : 0;
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t maxLength) {
+	// As on the ESP32, a buffer too small gets nothing
+	const std::string* stored = find(key, 'B');
+	if (!stored || !buffer || stored->size() > maxLength) return 0;
+	memcpy(buffer, stored->data(), stored->size());
+	return stored->size();
+}
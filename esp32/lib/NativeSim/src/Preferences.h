@@ -0,0 +1,43 @@
+#pragma once
+#include "Arduino.h"
+
+// ==============================================
+// Native stand-in for the ESP32 Preferences (NVS) library
+// ==============================================
+// Namespaces of typed key/value entries, as on the ESP32: a value read back
+// as a different type than it was written is not found. Entries live in
+// memory for the run; with SIM_NVS set to a file path they are loaded from
+// it on the first begin() and written back on every change, so settings
+// survive from one run to the next like a reboot.
+
+class Preferences {
+public:
+	bool begin(const char* name, bool readOnly = false, const char* partitionLabel = nullptr);
+	void end();
+
+	bool clear();
+	bool remove(const char* key);
+	bool isKey(const char* key);
+
+	size_t putBool(const char* key, bool value);
+	size_t putInt(const char* key, int32_t value);
+	size_t putUInt(const char* key, uint32_t value);
+	size_t putString(const char* key, const char* value);
+	size_t putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+	size_t putBytes(const char* key, const void* value, size_t length);
+
+	bool getBool(const char* key, bool defaultValue = false);
+	int32_t getInt(const char* key, int32_t defaultValue = 0);
+	uint32_t getUInt(const char* key, uint32_t defaultValue = 0);
+	size_t getString(const char* key, char* value, size_t maxLength);
+	String getString(const char* key, const String& defaultValue = String());
+	size_t getBytesLength(const char* key);
+	size_t getBytes(const char* key, void* buffer, size_t maxLength);
+
+private:
+	size_t put(const char* key, char type, const void* value, size_t length);
+	const std::string* find(const char* key, char type);
+
+	std::string space;        // Namespace; empty until begin()
+	bool readOnly = false;
+};
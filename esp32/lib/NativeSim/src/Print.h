@@ -0,0 +1,34 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+
+class String;
+
+// Minimal stand-in for the Arduino Print class
+class Print {
+public:
+	virtual ~Print() {}
+	virtual size_t write(uint8_t c) = 0;
+	virtual size_t write(const uint8_t* buffer, size_t size);
+	size_t write(const char* str);
+
+	size_t print(const char* str);
+	size_t print(const String& str);
+	size_t print(char c);
+	size_t print(int value, int base = 10);
+	size_t print(unsigned int value, int base = 10);
+	size_t print(long value, int base = 10);
+	size_t print(unsigned long value, int base = 10);
+	size_t print(double value, int digits = 2);
+
+	size_t println();
+	template <typename T>
+	size_t println(const T& value) {
+		size_t n = print(value);
+		return n + println();
+	}
+
+	size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+	size_t vprintf(const char* format, va_list args);
+};
@@ -0,0 +1,463 @@
+#include "SimBus.h"
+#include "Arduino.h"
+#include <string.h>
+#include <string>
+
+// ST7789 commands the panel model understands
+static const uint8_t CMD_CASET = 0x2A;
+static const uint8_t CMD_RASET = 0x2B;
+static const uint8_t CMD_RAMWR = 0x2C;
+static const uint8_t CMD_MADCTL = 0x36;
+static const uint8_t MADCTL_MV = 0x20;
+
+struct PanelModel {
+	int csPin;
+	bool selected;
+	int16_t nativeWidth;
+	int16_t nativeHeight;
+	uint8_t madctl;
+
+	// Controller state
+	uint8_t command;
+	uint8_t paramCount;
+	uint8_t params[4];
+	bool writingRam;
+	bool pendingHighByte;
+	uint8_t highByte;
+	uint16_t xs, xe, ys, ye;
+	uint16_t cx, cy;
+
+	SimPanelStats stats;
+	std::vector<uint16_t> ram;   // Logical (post-rotation) coordinates
+};
+
+static PanelModel panels[SimBus::MAX_PANELS];
+static int registeredPanels = 0;
+static uint32_t clockHz = 40000000;
+static uint64_t busBytes = 0;
+static uint64_t orphans = 0;
+static uint64_t broadcasts = 0;
+static size_t eventLimit = 0;
+static std::vector<SimBusEvent> eventLog;
+
+static void resetPanel(PanelModel& panel) {
+	int csPin = panel.csPin;
+	bool selected = panel.selected;
+	panel = PanelModel();
+	panel.csPin = csPin;
+	panel.selected = selected;
+	panel.nativeWidth = 240;
+	panel.nativeHeight = 320;
+	panel.ram.assign(SimBus::PANEL_RAM_SIZE * SimBus::PANEL_RAM_SIZE, 0);
+}
+
+int SimBus::addPanel(int csPin) {
+	int existing = panelForPin(csPin);
+	if (existing >= 0) return existing;
+	if (registeredPanels >= MAX_PANELS) return -1;
+
+	PanelModel& panel = panels[registeredPanels];
+	panel.csPin = csPin;
+	panel.selected = false;
+	resetPanel(panel);
+	return registeredPanels++;
+}
+
+int SimBus::panelForPin(int csPin) {
+	for (int i = 0; i < registeredPanels; i++) {
+		if (panels[i].csPin == csPin) return i;
+	}
+	return -1;
+}
+
+int SimBus::panelCount() { return registeredPanels; }
+void SimBus::setClockHz(uint32_t hz) { clockHz = hz ? hz : 1; }
+uint32_t SimBus::getClockHz() { return clockHz; }
+
+void SimBus::reset() {
+	for (int i = 0; i < registeredPanels; i++) {
+		resetPanel(panels[i]);
+	}
+	busBytes = 0;
+	orphans = 0;
+	broadcasts = 0;
+	eventLog.clear();
+}
+
+uint16_t SimBus::selectedMask() {
+	uint16_t mask = 0;
+	for (int i = 0; i < registeredPanels; i++) {
+		if (panels[i].selected) mask |= (1u << i);
+	}
+	return mask;
+}
+
+void SimBus::pinChanged(int pin, int level) {
+	int index = panelForPin(pin);
+	if (index < 0) return;
+
+	PanelModel& panel = panels[index];
+	bool selected = (level == LOW);
+	if (selected && !panel.selected) {
+		panel.stats.selects++;
+	}
+	panel.selected = selected;
+}
+
+void SimBus::countBusBytes(size_t bytes) {
+	busBytes += bytes;
+	uint16_t mask = selectedMask();
+	if (mask == 0) {
+		orphans += bytes;
+	} else if (mask & (mask - 1)) {
+		broadcasts += bytes;
+	}
+	// The wire time is charged to the simulated clock as well. Keep the
+	// remainder, or single-byte commands would never cost anything.
+	static uint64_t wireRemainder = 0;
+	uint64_t scaled = (uint64_t)bytes * 8 * 1000000 + wireRemainder;
+	SimClock::advanceMicros(scaled / clockHz);
+	wireRemainder = scaled % clockHz;
+}
+
+void SimBus::logEvent(const SimBusEvent& event) {
+	if (eventLog.size() >= eventLimit) return;
+
+	if (event.type == SimBusEvent::PIXELS && !eventLog.empty()) {
+		SimBusEvent& last = eventLog.back();
+		if (last.type == SimBusEvent::PIXELS && last.csMask == event.csMask) {
+			last.bytes += event.bytes;
+			return;
+		}
+	}
+	eventLog.push_back(event);
+}
+
+void SimBus::writeCommand(uint8_t command) {
+	countBusBytes(1);
+	uint16_t mask = selectedMask();
+
+	SimBusEvent event = {};
+	event.type = SimBusEvent::COMMAND;
+	event.command = command;
+	event.csMask = mask;
+	event.timeMicros = SimClock::nowMicros();
+
+	for (int i = 0; i < registeredPanels; i++) {
+		PanelModel& panel = panels[i];
+		if (!panel.selected) continue;
+
+		panel.stats.commands++;
+		panel.command = command;
+		panel.paramCount = 0;
+		panel.pendingHighByte = false;
+		panel.writingRam = (command == CMD_RAMWR);
+
+		if (panel.writingRam) {
+			panel.stats.addrWindows++;
+			panel.cx = panel.xs;
+			panel.cy = panel.ys;
+			event.type = SimBusEvent::ADDR_WINDOW;
+			event.x = panel.xs;
+			event.y = panel.ys;
+			event.w = panel.xe - panel.xs + 1;
+			event.h = panel.ye - panel.ys + 1;
+		}
+	}
+	logEvent(event);
+}
+
+void SimBus::panelPixel(int index, uint16_t colour) {
+	PanelModel& panel = panels[index];
+	if (panel.cx < PANEL_RAM_SIZE && panel.cy < PANEL_RAM_SIZE) {
+		panel.ram[panel.cy * PANEL_RAM_SIZE + panel.cx] = colour;
+	}
+
+	// Auto-increment within the address window, wrapping like the controller
+	if (++panel.cx > panel.xe) {
+		panel.cx = panel.xs;
+		if (++panel.cy > panel.ye) {
+			panel.cy = panel.ys;
+		}
+	}
+}
+
+void SimBus::writeData(const uint8_t* data, size_t length) {
+	countBusBytes(length);
+
+	for (int i = 0; i < registeredPanels; i++) {
+		PanelModel& panel = panels[i];
+		if (!panel.selected) continue;
+
+		if (panel.writingRam) {
+			panel.stats.pixelBytes += length;
+			for (size_t b = 0; b < length; b++) {
+				if (!panel.pendingHighByte) {
+					panel.highByte = data[b];
+					panel.pendingHighByte = true;
+				} else {
+					panelPixel(i, (uint16_t)((panel.highByte << 8) | data[b]));
+					panel.pendingHighByte = false;
+				}
+			}
+			continue;
+		}
+
+		panel.stats.dataBytes += length;
+		for (size_t b = 0; b < length; b++) {
+			if (panel.paramCount < sizeof(panel.params)) {
+				panel.params[panel.paramCount++] = data[b];
+			}
+		}
+
+		if (panel.command == CMD_CASET && panel.paramCount == 4) {
+			panel.xs = (panel.params[0] << 8) | panel.params[1];
+			panel.xe = (panel.params[2] << 8) | panel.params[3];
+		} else if (panel.command == CMD_RASET && panel.paramCount == 4) {
+			panel.ys = (panel.params[0] << 8) | panel.params[1];
+			panel.ye = (panel.params[2] << 8) | panel.params[3];
+		} else if (panel.command == CMD_MADCTL && panel.paramCount >= 1) {
+			panel.madctl = panel.params[0];
+		}
+	}
+}
+
+void SimBus::writePixels(const uint16_t* pixels, size_t count) {
+	countBusBytes(count * 2);
+	uint16_t mask = selectedMask();
+
+	for (int i = 0; i < registeredPanels; i++) {
+		PanelModel& panel = panels[i];
+		if (!panel.selected || !panel.writingRam) continue;
+		panel.stats.pixelBytes += count * 2;
+		for (size_t p = 0; p < count; p++) {
+			panelPixel(i, pixels[p]);
+		}
+	}
+
+	SimBusEvent event = {};
+	event.type = SimBusEvent::PIXELS;
+	event.csMask = mask;
+	event.bytes = count * 2;
+	event.timeMicros = SimClock::nowMicros();
+	logEvent(event);
+}
+
+void SimBus::writeColour(uint16_t colour, size_t count) {
+	countBusBytes(count * 2);
+	uint16_t mask = selectedMask();
+
+	for (int i = 0; i < registeredPanels; i++) {
+		PanelModel& panel = panels[i];
+		if (!panel.selected || !panel.writingRam) continue;
+		panel.stats.pixelBytes += count * 2;
+		for (size_t p = 0; p < count; p++) {
+			panelPixel(i, colour);
+		}
+	}
+
+	SimBusEvent event = {};
+	event.type = SimBusEvent::PIXELS;
+	event.csMask = mask;
+	event.bytes = count * 2;
+	event.timeMicros = SimClock::nowMicros();
+	logEvent(event);
+}
+
+void SimBus::setSelectedGeometry(int16_t width, int16_t height) {
+	for (int i = 0; i < registeredPanels; i++) {
+		if (panels[i].selected) {
+			panels[i].nativeWidth = width;
+			panels[i].nativeHeight = height;
+		}
+	}
+}
+
+SimPanelStats SimBus::getPanelStats(int panel) {
+	if (panel < 0 || panel >= registeredPanels) return SimPanelStats();
+	return panels[panel].stats;
+}
+
+uint64_t SimBus::totalBusBytes() { return busBytes; }
+uint64_t SimBus::orphanBytes() { return orphans; }
+uint64_t SimBus::broadcastBytes() { return broadcasts; }
+
+uint64_t SimBus::estimatedWireMicros() {
+	return busBytes * 8 * 1000000 / clockHz;
+}
+
+int16_t SimBus::panelWidth(int panel) {
+	if (panel < 0 || panel >= registeredPanels) return 0;
+	const PanelModel& model = panels[panel];
+	return (model.madctl & MADCTL_MV) ? model.nativeHeight : model.nativeWidth;
+}
+
+int16_t SimBus::panelHeight(int panel) {
+	if (panel < 0 || panel >= registeredPanels) return 0;
+	const PanelModel& model = panels[panel];
+	return (model.madctl & MADCTL_MV) ? model.nativeWidth : model.nativeHeight;
+}
+
+bool SimBus::panelsMatch(uint16_t panelMask) {
+	int first = -1;
+	for (int i = 0; i < registeredPanels; i++) {
+		if (!(panelMask & (1u << i))) continue;
+		if (first < 0) {
+			first = i;
+			continue;
+		}
+		if (panelWidth(i) != panelWidth(first) || panelHeight(i) != panelHeight(first)) return false;
+		for (int16_t y = 0; y < panelHeight(i); y++) {
+			for (int16_t x = 0; x < panelWidth(i); x++) {
+				if (getPixel(i, x, y) != getPixel(first, x, y)) return false;
+			}
+		}
+	}
+	return true;
+}
+
+uint16_t SimBus::getPixel(int panel, int16_t x, int16_t y) {
+	if (panel < 0 || panel >= registeredPanels) return 0;
+	if (x < 0 || y < 0 || x >= PANEL_RAM_SIZE || y >= PANEL_RAM_SIZE) return 0;
+	return panels[panel].ram[y * PANEL_RAM_SIZE + x];
+}
+
+void SimBus::setEventLogLimit(size_t limit) {
+	eventLimit = limit;
+	if (eventLog.size() > limit) eventLog.resize(limit);
+}
+
+const std::vector<SimBusEvent>& SimBus::events() {
+	return eventLog;
+}
+
+// ==============================================
+// PNG output (uncompressed deflate, no dependencies)
+// ==============================================
+
+static uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length) {
+	static uint32_t table[256];
+	static bool tableReady = false;
+	if (!tableReady) {
+		for (uint32_t n = 0; n < 256; n++) {
+			uint32_t c = n;
+			for (int k = 0; k < 8; k++) {
+				c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			}
+			table[n] = c;
+		}
+		tableReady = true;
+	}
+
+	crc = ~crc;
+	for (size_t i = 0; i < length; i++) {
+		crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+static void putBigEndian32(std::string& out, uint32_t value) {
+	out.push_back((char)(value >> 24));
+	out.push_back((char)(value >> 16));
+	out.push_back((char)(value >> 8));
+	out.push_back((char)value);
+}
+
+static void writeChunk(FILE* file, const char* type, const std::string& data) {
+	std::string chunk;
+	putBigEndian32(chunk, data.size());
+	chunk.append(type, 4);
+	chunk.append(data);
+	uint32_t crc = crc32Update(0, (const uint8_t*)chunk.data() + 4, chunk.size() - 4);
+	putBigEndian32(chunk, crc);
+	fwrite(chunk.data(), 1, chunk.size(), file);
+}
+
+bool SimBus::writePng(int panel, const char* path) {
+	if (panel < 0 || panel >= registeredPanels) return false;
+	int16_t width = panelWidth(panel);
+	int16_t height = panelHeight(panel);
+
+	// Raw scanlines: filter byte 0 then RGB888
+	std::string raw;
+	raw.reserve((size_t)height * (width * 3 + 1));
+	for (int16_t y = 0; y < height; y++) {
+		raw.push_back(0);
+		for (int16_t x = 0; x < width; x++) {
+			uint16_t c = getPixel(panel, x, y);
+			uint8_t r = (c >> 11) & 0x1F;
+			uint8_t g = (c >> 5) & 0x3F;
+			uint8_t b = c & 0x1F;
+			raw.push_back((char)((r << 3) | (r >> 2)));
+			raw.push_back((char)((g << 2) | (g >> 4)));
+			raw.push_back((char)((b << 3) | (b >> 2)));
+		}
+	}
+
+	// zlib stream made of stored blocks
+	std::string zlib;
+	zlib.push_back(0x78);
+	zlib.push_back(0x01);
+	size_t offset = 0;
+	do {
+		size_t blockSize = std::min<size_t>(raw.size() - offset, 65535);
+		bool last = (offset + blockSize == raw.size());
+		zlib.push_back(last ? 1 : 0);
+		zlib.push_back((char)(blockSize & 0xFF));
+		zlib.push_back((char)(blockSize >> 8));
+		zlib.push_back((char)(~blockSize & 0xFF));
+		zlib.push_back((char)((~blockSize >> 8) & 0xFF));
+		zlib.append(raw, offset, blockSize);
+		offset += blockSize;
+	} while (offset < raw.size());
+
+	uint32_t a = 1, b = 0;
+	for (unsigned char c : raw) {
+		a = (a + c) % 65521;
+		b = (b + a) % 65521;
+	}
+	putBigEndian32(zlib, (b << 16) | a);
+
+	FILE* file = fopen(path, "wb");
+	if (!file) return false;
+
+	static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+	fwrite(signature, 1, sizeof(signature), file);
+
+	std::string header;
+	putBigEndian32(header, width);
+	putBigEndian32(header, height);
+	header.push_back(8);   // Bit depth
+	header.push_back(2);   // Truecolour
+	header.push_back(0);
+	header.push_back(0);
+	header.push_back(0);
+	writeChunk(file, "IHDR", header);
+	writeChunk(file, "IDAT", zlib);
+	writeChunk(file, "IEND", std::string());
+
+	fclose(file);
+	return true;
+}
+
+int SimBus::writeAllPngs(const char* directory, const char* prefix) {
+	int written = 0;
+	for (int i = 0; i < registeredPanels; i++) {
+		std::string path = std::string(directory) + "/" + prefix + std::to_string(i) + ".png";
+		if (writePng(i, path.c_str())) written++;
+	}
+	return written;
+}
+
+void SimBus::printReport(FILE* out) {
+	fprintf(out, "SPI bus @ %.1f MHz\n", clockHz / 1e6);
+	fprintf(out, "panel  cs  selects  commands  windows  data_bytes  pixel_bytes\n");
+	for (int i = 0; i < registeredPanels; i++) {
+		const SimPanelStats& s = panels[i].stats;
+		fprintf(out, "%5d  %2d  %7u  %8u  %7u  %10u  %11u\n", i, panels[i].csPin,
+		        s.selects, s.commands, s.addrWindows, s.dataBytes, s.pixelBytes);
+	}
+	fprintf(out, "bus bytes: %llu (orphaned %llu, broadcast %llu), est. wire time %.1f ms\n",
+	        (unsigned long long)busBytes, (unsigned long long)orphans, (unsigned long long)broadcasts,
+	        estimatedWireMicros() / 1000.0);
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <vector>
+
+// ==============================================
+// Simulated shared SPI bus with ST7789 panel models
+// ==============================================
+// Every byte the firmware sends through the Adafruit_ST7789 stand-in lands
+// here. Chip-select state is taken from digitalWrite() on registered CS pins,
+// so the recorder sees exactly which panels were listening to each byte.
+// Bytes sent with several CS lines low reach all of those panels.
+
+struct SimPanelStats {
+	uint32_t selects;        // CS falling edges
+	uint32_t commands;       // Command bytes (DC low)
+	uint32_t addrWindows;    // RAMWR after CASET/RASET
+	uint32_t dataBytes;      // Command parameter bytes
+	uint32_t pixelBytes;     // Bytes written to panel RAM
+};
+
+struct SimBusEvent {
+	enum Type : uint8_t { COMMAND, ADDR_WINDOW, PIXELS };
+	Type type;
+	uint8_t command;
+	uint16_t csMask;         // Panels selected when the event happened
+	int16_t x, y, w, h;      // ADDR_WINDOW only
+	uint32_t bytes;          // PIXELS: consecutive pixel bytes coalesced
+	uint64_t timeMicros;
+};
+
+class SimBus {
+public:
+	static const int MAX_PANELS = 16;
+	static const int PANEL_RAM_SIZE = 320;
+
+	// Setup
+	static int addPanel(int csPin);          // Returns the panel index (reuses existing)
+	static int panelForPin(int csPin);
+	static int panelCount();
+	static void setClockHz(uint32_t hz);
+	static uint32_t getClockHz();
+	static void reset();                     // Clear counters, events and panel RAM
+
+	// Called by the stand-ins
+	static void pinChanged(int pin, int level);
+	static void writeCommand(uint8_t command);
+	static void writeData(const uint8_t* data, size_t length);
+	static void writePixels(const uint16_t* pixels, size_t count);
+	static void writeColour(uint16_t colour, size_t count);
+	static void setSelectedGeometry(int16_t width, int16_t height);
+
+	// Results
+	static uint16_t selectedMask();
+	static SimPanelStats getPanelStats(int panel);
+	static uint64_t totalBusBytes();         // Bytes clocked out, counted once per transfer
+	static uint64_t orphanBytes();           // Bytes sent with no panel selected
+	static uint64_t broadcastBytes();        // Bytes that reached more than one panel
+	static uint64_t estimatedWireMicros();   // totalBusBytes at the configured SPI clock
+	static uint16_t getPixel(int panel, int16_t x, int16_t y);
+	static int16_t panelWidth(int panel);
+	static int16_t panelHeight(int panel);
+	static bool panelsMatch(uint16_t panelMask);  // Same geometry and picture on all of them
+
+	// Event log (disabled by default; limit 0 = off)
+	static void setEventLogLimit(size_t limit);
+	static const std::vector<SimBusEvent>& events();
+
+	// Output
+	static bool writePng(int panel, const char* path);
+	static int writeAllPngs(const char* directory, const char* prefix = "display");
+	static void printReport(FILE* out);
+
+private:
+	static void countBusBytes(size_t bytes);
+	static void logEvent(const SimBusEvent& event);
+	static void panelPixel(int panel, uint16_t colour);
+};
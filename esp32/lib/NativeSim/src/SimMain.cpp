@@ -0,0 +1,148 @@
+#include "Arduino.h"
+#include "SimBus.h"
+#include <stdio.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+// ==============================================
+// Host entry point for the native env
+// ==============================================
+// Runs the firmware's setup()/loop() against the simulated bus for a fixed
+// amount of simulated time, then prints the SPI traffic report and writes one
+// PNG per panel. Unit tests provide their own main(), which wins over this
+// weak one; setup()/loop() are weak too so test builds without src/ link.
+//
+// Environment variables:
+//   SIM_RUN_MS   simulated run time in ms (default 15000)
+//   SIM_SPI_HZ   SPI clock used for wire-time estimates (default 40 MHz)
+//   SIM_OUT      PNG output directory (default "sim_out", "" to skip)
+//   SIM_QUIET    set to mute Serial output
+//   SIM_INPUT    scripted input edges, "ms:pin=level,..."
+//                e.g. "500:17=0,500:22=0,9000:17=1,9000:22=1" holds both row
+//                select buttons long enough to enter demo mode
+//   SIM_SERIAL   scripted serial input lines, "ms:line;..."
+//                e.g. "15000:metrics;15000:metrics json"
+//   SIM_NET_HOST where network connections go, "host:port" or per port
+//                "8123=host:port,1883=host:port" (see WiFi.h); unset, the
+//                firmware stays offline
+//   SIM_NVS      file holding Preferences (NVS) between runs (see
+//                Preferences.h); unset, every run starts with empty NVS
+//   SIM_SPEED    run no faster than this many times real time, so servers
+//                on the host can keep up with asynchronous traffic such as
+//                MQTT (default: as fast as possible)
+
+void setup() __attribute__((weak));
+void loop() __attribute__((weak));
+
+struct SimInputEdge {
+	unsigned long atMs;
+	int pin;
+	int level;
+};
+
+static int parseInputScript(const char* script, SimInputEdge* edges, int maxEdges) {
+	int count = 0;
+	while (script && *script && count < maxEdges) {
+		SimInputEdge edge;
+		int consumed = 0;
+		if (sscanf(script, "%lu:%d=%d%n", &edge.atMs, &edge.pin, &edge.level, &consumed) != 3) {
+			fprintf(stderr, "SimMain: bad SIM_INPUT entry at \"%s\"\n", script);
+			break;
+		}
+		edges[count++] = edge;
+		script += consumed;
+		if (*script == ',') script++;
+	}
+	return count;
+}
+
+struct SimSerialLine {
+	unsigned long atMs;
+	char text[64];
+};
+
+static int parseSerialScript(const char* script, SimSerialLine* lines, int maxLines) {
+	int count = 0;
+	while (script && *script && count < maxLines) {
+		SimSerialLine line;
+		int consumed = 0;
+		if (sscanf(script, "%lu:%62[^;]%n", &line.atMs, line.text, &consumed) != 2) {
+			fprintf(stderr, "SimMain: bad SIM_SERIAL entry at \"%s\"\n", script);
+			break;
+		}
+		strcat(line.text, "\n");
+		lines[count++] = line;
+		script += consumed;
+		if (*script == ';') script++;
+	}
+	return count;
+}
+
+__attribute__((weak)) int main() {
+	if (!setup || !loop) {
+		fprintf(stderr, "SimMain: no setup()/loop() linked\n");
+		return 1;
+	}
+
+	const char* runEnv = getenv("SIM_RUN_MS");
+	const char* clockEnv = getenv("SIM_SPI_HZ");
+	const char* outEnv = getenv("SIM_OUT");
+	const char* speedEnv = getenv("SIM_SPEED");
+	double speed = speedEnv ? atof(speedEnv) : 0;
+	unsigned long runMs = runEnv ? strtoul(runEnv, nullptr, 10) : 15000;
+	const char* outDir = outEnv ? outEnv : "sim_out";
+
+	if (clockEnv) SimBus::setClockHz(strtoul(clockEnv, nullptr, 10));
+	if (getenv("SIM_QUIET")) Serial.setMuted(true);
+
+	static SimInputEdge edges[64];
+	int edgeCount = parseInputScript(getenv("SIM_INPUT"), edges, 64);
+	int nextEdge = 0;
+
+	static SimSerialLine serialLines[16];
+	int serialCount = parseSerialScript(getenv("SIM_SERIAL"), serialLines, 16);
+	int nextLine = 0;
+
+	setup();
+
+	timespec started;
+	clock_gettime(CLOCK_MONOTONIC, &started);
+
+	unsigned long loops = 0;
+	while (millis() < runMs) {
+		while (nextEdge < edgeCount && edges[nextEdge].atMs <= millis()) {
+			SimGpio::setInput(edges[nextEdge].pin, edges[nextEdge].level);
+			nextEdge++;
+		}
+		while (nextLine < serialCount && serialLines[nextLine].atMs <= millis()) {
+			Serial.feed(serialLines[nextLine].text);
+			nextLine++;
+		}
+
+		unsigned long before = micros();
+		loop();
+		loops++;
+
+		// Guard against a loop() that never waits
+		if (micros() == before) delay(1);
+
+		if (speed > 0) {
+			timespec now;
+			clock_gettime(CLOCK_MONOTONIC, &now);
+			double wallMicros = (now.tv_sec - started.tv_sec) * 1e6 + (now.tv_nsec - started.tv_nsec) / 1e3;
+			double ahead = SimClock::nowMicros() / speed - wallMicros;
+			if (ahead > 0) usleep((useconds_t)ahead);
+		}
+	}
+
+	fprintf(stderr, "\nSimulated %lu ms, %lu loop() calls\n", millis(), loops);
+	SimBus::printReport(stderr);
+
+	if (*outDir) {
+		mkdir(outDir, 0755);
+		int written = SimBus::writeAllPngs(outDir);
+		fprintf(stderr, "Wrote %d panel snapshots to %s/\n", written, outDir);
+	}
+	return 0;
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include "Print.h"
+
+// Minimal stand-in for the Arduino Stream class. read() returns -1 once
+// nothing is left; the simulation has nothing to wait for, so there is no
+// timeout.
+class Stream : public Print {
+public:
+	virtual int available() = 0;
+	virtual int read() = 0;
+	virtual int peek() = 0;
+
+	size_t readBytes(char* buffer, size_t length);
+	size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+	void setTimeout(unsigned long timeout) { (void)timeout; }
+};
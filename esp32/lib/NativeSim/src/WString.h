@@ -0,0 +1,53 @@
+#pragma once
+#include <string>
+#include <stdint.h>
+
+// Minimal stand-in for the Arduino String class, backed by std::string
+class String {
+public:
+	String() {}
+	String(const char* str) : value(str ? str : "") {}
+	String(const std::string& str) : value(str) {}
+	explicit String(char c) : value(1, c) {}
+	String(int v) : value(std::to_string(v)) {}
+	String(unsigned int v) : value(std::to_string(v)) {}
+	String(long v) : value(std::to_string(v)) {}
+	String(unsigned long v) : value(std::to_string(v)) {}
+	explicit String(float v, unsigned int decimals = 2);
+	explicit String(double v, unsigned int decimals = 2);
+
+	unsigned int length() const { return value.size(); }
+	const char* c_str() const { return value.c_str(); }
+	char charAt(unsigned int index) const { return index < value.size() ? value[index] : 0; }
+	char operator[](unsigned int index) const { return charAt(index); }
+	bool isEmpty() const { return value.empty(); }
+
+	String& operator+=(const String& rhs) { value += rhs.value; return *this; }
+	String& operator+=(const char* rhs) { value += rhs; return *this; }
+	String& operator+=(char rhs) { value += rhs; return *this; }
+	bool concat(const String& rhs) { value += rhs.value; return true; }
+
+	bool operator==(const String& rhs) const { return value == rhs.value; }
+	bool operator==(const char* rhs) const { return value == rhs; }
+	bool operator!=(const String& rhs) const { return value != rhs.value; }
+	bool equals(const String& rhs) const { return value == rhs.value; }
+
+	int indexOf(char c, unsigned int from = 0) const;
+	int indexOf(const String& str, unsigned int from = 0) const;
+	String substring(unsigned int from) const;
+	String substring(unsigned int from, unsigned int to) const;
+	bool startsWith(const String& prefix) const;
+	bool endsWith(const String& suffix) const;
+	void trim();
+	void toLowerCase();
+	void toUpperCase();
+	long toInt() const;
+	float toFloat() const;
+
+	friend String operator+(const String& lhs, const String& rhs) { return String(lhs.value + rhs.value); }
+	friend String operator+(const String& lhs, const char* rhs) { return String(lhs.value + rhs); }
+	friend String operator+(const char* lhs, const String& rhs) { return String(lhs + rhs.value); }
+
+private:
+	std::string value;
+};
@@ -0,0 +1,256 @@
+#include "WiFi.h"
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+
+static const char* simNetHost() {
+	const char* host = getenv("SIM_NET_HOST");
+	return host && *host ? host : nullptr;
+}
+
+bool simNetRoute(const char* host, uint16_t port, char* routedHost, size_t size, uint16_t& routedPort) {
+	const char* routes = simNetHost();
+	if (!routes) return false;
+	snprintf(routedHost, size, "%s", host);
+	routedPort = port;
+
+	// A route for this port wins over the catch-all, wherever it comes
+	bool exact = false;
+	for (const char* entry = routes; entry; ) {
+		const char* next = strchr(entry, ',');
+		unsigned int fromPort = 0;
+		unsigned int toPort = 0;
+		char toHost[64];
+		bool use = false;
+		if (sscanf(entry, "%u=%63[^:,]:%u", &fromPort, toHost, &toPort) == 3) {
+			use = fromPort == port;
+			exact = exact || use;
+		} else if (!exact && sscanf(entry, "%63[^:,]:%u", toHost, &toPort) == 2) {
+			use = true;
+		}
+		if (use) {
+			snprintf(routedHost, size, "%s", toHost);
+			routedPort = toPort;
+		}
+		entry = next ? next + 1 : nullptr;
+	}
+	return true;
+}
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* password) {
+	(void)ssid;
+	(void)password;
+	started = true;
+	return status();
+}
+
+wl_status_t WiFiClass::status() {
+	if (!started) return WL_IDLE_STATUS;
+	return simNetHost() ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+// ==============================================
+// WiFiClient
+// ==============================================
+
+WiFiClient::Connection::~Connection() {
+	if (socket >= 0) close(socket);
+}
+
+WiFiClient::WiFiClient(int socket) {
+	if (socket < 0) return;
+	connection = std::make_shared<Connection>();
+	connection->socket = socket;
+	applyTimeout();
+}
+
+int WiFiClient::connect(const char* host, uint16_t port) {
+	stop();
+
+	char routedHost[64];
+	uint16_t routedPort = port;
+	if (simNetRoute(host, port, routedHost, sizeof(routedHost), routedPort)) host = routedHost;
+	char service[8];
+	snprintf(service, sizeof(service), "%u", routedPort);
+	addrinfo hints = {};
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	addrinfo* found = nullptr;
+	if (getaddrinfo(host, service, &hints, &found) != 0) return 0;
+
+	int socket = -1;
+	for (addrinfo* address = found; address && socket < 0; address = address->ai_next) {
+		socket = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+		if (socket < 0) continue;
+		if (::connect(socket, address->ai_addr, address->ai_addrlen) != 0) {
+			close(socket);
+			socket = -1;
+		}
+	}
+	freeaddrinfo(found);
+	if (socket < 0) return 0;
+
+	connection = std::make_shared<Connection>();
+	connection->socket = socket;
+	applyTimeout();
+	return 1;
+}
+
+int WiFiClient::setNoDelay(bool noDelay) {
+	if (!connection) return -1;
+	int flag = noDelay ? 1 : 0;
+	return setsockopt(connection->socket, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+}
+
+void WiFiClient::applyTimeout() {
+	if (!connection) return;
+	timeval timeout = {(time_t)(timeoutMs / 1000), (suseconds_t)(timeoutMs % 1000) * 1000};
+	setsockopt(connection->socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+}
+
+void WiFiClient::stop() {
+	// Closes the connection for every copy, as on the ESP32
+	if (connection && connection->socket >= 0) {
+		close(connection->socket);
+		connection->socket = -1;
+		connection->bufferLength = 0;
+	}
+	connection.reset();
+}
+
+uint8_t WiFiClient::connected() {
+	if (!connection || connection->socket < 0) return 0;
+	Connection& c = *connection;
+
+	// Like the ESP32 client, a peek notices a peer that has gone away
+	if (c.bufferLength == 0 && !c.closed) {
+		char probe;
+		if (recv(c.socket, &probe, 1, MSG_PEEK | MSG_DONTWAIT) == 0) c.closed = true;
+	}
+	return c.bufferLength > 0 || !c.closed;
+}
+
+bool WiFiClient::fill() {
+	// Blocks for up to the timeout; the simulated clock does not move
+	if (!connection) return false;
+	Connection& c = *connection;
+	if (c.bufferLength > 0) return true;
+	if (c.socket < 0 || c.closed) return false;
+	ssize_t n = recv(c.socket, c.buffer, sizeof(c.buffer), 0);
+	if (n <= 0) {
+		if (n == 0) c.closed = true;
+		return false;
+	}
+	c.bufferHead = 0;
+	c.bufferLength = n;
+	return true;
+}
+
+int WiFiClient::available() {
+	if (!connection || connection->socket < 0) return 0;
+	if (connection->bufferLength > 0) return connection->bufferLength;
+	int waiting = 0;
+	ioctl(connection->socket, FIONREAD, &waiting);
+	return waiting;
+}
+
+int WiFiClient::read() {
+	if (!fill()) return -1;
+	connection->bufferLength--;
+	return connection->buffer[connection->bufferHead++];
+}
+
+int WiFiClient::read(uint8_t* buffer, size_t size) {
+	// Whatever is buffered or waiting, up to size; waits only when nothing is
+	size_t n = 0;
+	while (n < size && (n == 0 || available() > 0)) {
+		int c = read();
+		if (c < 0) break;
+		buffer[n++] = c;
+	}
+	return n ? (int)n : -1;
+}
+
+int WiFiClient::peek() {
+	return fill() ? connection->buffer[connection->bufferHead] : -1;
+}
+
+size_t WiFiClient::write(uint8_t c) {
+	return write(&c, 1);
+}
+
+size_t WiFiClient::write(const uint8_t* data, size_t size) {
+	if (!connection || connection->socket < 0) return 0;
+	size_t sent = 0;
+	while (sent < size) {
+		ssize_t n = send(connection->socket, data + sent, size - sent, MSG_NOSIGNAL);
+		if (n <= 0) break;
+		sent += n;
+	}
+	return sent;
+}
+
+// ==============================================
+// WiFiServer
+// ==============================================
+
+// Host port for a port the firmware listens on, from SIM_NET_LISTEN
+static uint16_t simListenPort(uint16_t port) {
+	const char* mappings = getenv("SIM_NET_LISTEN");
+	for (const char* entry = mappings; entry && *entry; ) {
+		unsigned int fromPort = 0;
+		unsigned int toPort = 0;
+		if (sscanf(entry, "%u=%u", &fromPort, &toPort) == 2 && fromPort == port) return toPort;
+		entry = strchr(entry, ',');
+		if (entry) entry++;
+	}
+	return port;
+}
+
+void WiFiServer::begin(uint16_t port) {
+	end();
+	if (port) this->port = port;
+
+	listener = ::socket(AF_INET, SOCK_STREAM, 0);
+	if (listener < 0) return;
+	int reuse = 1;
+	setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+	sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons(simListenPort(this->port));
+	if (bind(listener, (sockaddr*)&address, sizeof(address)) != 0 || listen(listener, maxClients) != 0) {
+		fprintf(stderr, "WiFiServer: cannot listen on port %u\n", simListenPort(this->port));
+		end();
+		return;
+	}
+	fcntl(listener, F_SETFL, O_NONBLOCK);
+}
+
+void WiFiServer::end() {
+	if (listener >= 0) close(listener);
+	listener = -1;
+}
+
+WiFiClient WiFiServer::available() {
+	if (listener < 0) return WiFiClient();
+	int socket = ::accept(listener, nullptr, nullptr);
+	if (socket < 0) return WiFiClient();
+	// lwIP's send buffer on the ESP32 is 5744 bytes (Linux doubles what it
+	// is given), so a long response fills it here too
+	int sendBuffer = 5744 / 2;
+	setsockopt(socket, SOL_SOCKET, SO_SNDBUF, &sendBuffer, sizeof(sendBuffer));
+	WiFiClient client(socket);
+	if (noDelay) client.setNoDelay(true);
+	return client;
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include "Arduino.h"
+#include <memory>
+
+// ==============================================
+// Native stand-in for the ESP32 WiFi library
+// ==============================================
+// The station is "connected" once begin() has been called, if SIM_NET_HOST
+// is set; otherwise it never connects, and the firmware runs offline as it
+// always has. WiFiClient is a plain blocking TCP socket, so the firmware can
+// talk to real servers on the host (tools/ha_standin.py, mqtt_standin.py).
+//
+// SIM_NET_HOST says where connections go instead of where the firmware
+// asked: comma-separated "port=host:port" entries for connections to that
+// port, and at most one plain "host:port" for everything else, e.g.
+// "1883=127.0.0.1:41883,127.0.0.1:48123".
+//
+// WiFiServer listens on 127.0.0.1, with the ESP32's send buffer size on
+// the connections it accepts. SIM_NET_LISTEN maps the port the
+// firmware asks for to the one used on the host, "80=18080,..."; unmapped
+// ports are used as they are. Copies of a WiFiClient share one connection,
+// as on the ESP32, so a server can hand accepted clients around by value.
+
+typedef enum {
+	WL_IDLE_STATUS = 0,
+	WL_CONNECTED = 3,
+	WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+	WIFI_OFF = 0,
+	WIFI_STA = 1
+} wifi_mode_t;
+
+class WiFiClient : public Stream {
+public:
+	WiFiClient() {}
+	explicit WiFiClient(int socket);
+
+	int connect(const char* host, uint16_t port);
+	int connect(const char* host, uint16_t port, int32_t timeout) { (void)timeout; return connect(host, port); }
+	int setNoDelay(bool noDelay);
+	void stop();
+	uint8_t connected();
+	explicit operator bool() { return connected(); }
+	int fd() const { return connection ? connection->socket : -1; }
+
+	int available() override;
+	int read() override;
+	int read(uint8_t* buffer, size_t size);
+	int peek() override;
+	size_t write(uint8_t c) override;
+	size_t write(const uint8_t* buffer, size_t size) override;
+	using Print::write;
+
+	void setTimeout(unsigned long timeout) { timeoutMs = timeout; applyTimeout(); }
+
+private:
+	struct Connection {
+		int socket = -1;
+		uint8_t buffer[512];
+		size_t bufferHead = 0;
+		size_t bufferLength = 0;
+		bool closed = false;  // Peer finished sending
+		~Connection();
+	};
+
+	bool fill();
+	void applyTimeout();
+
+	std::shared_ptr<Connection> connection;
+	unsigned long timeoutMs = 1000;
+};
+
+class WiFiServer {
+public:
+	explicit WiFiServer(uint16_t port = 80, uint8_t maxClients = 4) : port(port), maxClients(maxClients) {}
+	~WiFiServer() { end(); }
+
+	void begin(uint16_t port = 0);
+	void end();
+	void stop() { end(); }
+	void setNoDelay(bool noDelay) { this->noDelay = noDelay; }
+
+	// The next waiting connection, or a client that is not connected
+	WiFiClient available();
+	WiFiClient accept() { return available(); }
+	explicit operator bool() { return listener >= 0; }
+
+private:
+	uint16_t port;
+	uint8_t maxClients;
+	int listener = -1;
+	bool noDelay = false;
+};
+
+class WiFiClass {
+public:
+	bool mode(wifi_mode_t mode) { (void)mode; return true; }
+	bool setHostname(const char* name) { (void)name; return true; }
+	wl_status_t begin(const char* ssid, const char* password);
+	wl_status_t status();
+	int8_t RSSI() { return status() == WL_CONNECTED ? -50 : 0; }
+
+private:
+	bool started = false;
+};
+
+extern WiFiClass WiFi;
+
+// Where a connection to host:port goes under SIM_NET_HOST; false when
+// the simulation is offline
+bool simNetRoute(const char* host, uint16_t port, char* routedHost, size_t size, uint16_t& routedPort);
@@ -7,6 +7,27 @@
 // Home Assistant Configuration
 #define HA_SERVER "http://homeassistant.local:8123"
 #define HA_TOKEN "YOUR_LONG_LIVED_ACCESS_TOKEN"
+#define HA_TASKS_PATH "/api/choretracker/tasks"  // JSON array of Task (shared/api)
+#define HA_HTTP_TIMEOUT_MS 5000
+
+// Clock: SNTP, and the Date on HA's responses (task times are Unix times)
+#define NTP_SERVER "pool.ntp.org"
+#define CLOCK_SLACK_S 2           // Drift from HA's clock that is left alone
+
+// MQTT Configuration (task completions out, task list and config in)
+#define MQTT_ENABLED true
+#define MQTT_SERVER "homeassistant.local"
+#define MQTT_PORT 1883
+#define MQTT_USERNAME ""
+#define MQTT_PASSWORD ""
+#define MQTT_TOPIC_PREFIX "choretracker"
+#define MQTT_KEEPALIVE_S 30
+#define MQTT_BACKOFF_MIN_MS 1000    // Reconnect delay doubles from here...
+#define MQTT_BACKOFF_MAX_MS 60000   // ...up to here
+
+// Local HTTP API (shared/api/choretracker_api.yaml)
+#define API_ENABLED true
+#define API_PORT 80
 
 // OpenWeatherMap Configuration (optional)
 #define WEATHER_API_KEY "YOUR_OPENWEATHER_API_KEY"
@@ -14,7 +35,9 @@
 
 // Device Configuration
 #define DEVICE_NAME "ChoreTracker"
+#define FIRMWARE_VERSION "1.0.0"
 #define UPDATE_INTERVAL_MS 60000  // 1 minute
+#define MIN_UPDATE_INTERVAL_MS 5000  // Shortest update_interval accepted, from anywhere
 
 // Debug Configuration
 #define DEBUG_MODE true
@@ -26,6 +49,10 @@
 #define DISPLAY_HEIGHT 320
 #define DISPLAY_ROTATION 1
 
+// Rendering Configuration
+#define DUAL_CORE_RENDERING true  // ESP32: displays and SPI get their own core
+#define RENDER_CORE 0             // loop() (input, navigation, networking) stays on core 1
+
 // Task Configuration
 #define MAX_TASKS_PER_PERSON 6
 #define MAX_PERSONS 4
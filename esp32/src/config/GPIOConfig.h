@@ -36,6 +36,8 @@
 // Row mapping for displays
 #define ROW_1_DISPLAYS {0, 1, 2, 3}  // Screen indices for row 1
 #define ROW_2_DISPLAYS {4, 5, 6, 7}  // Screen indices for row 2
+#define DISPLAYS_PER_ROW 4
+#define TOTAL_ROWS 2
 
 // TFT Shared Pins (all displays)
 #define TFT_SCK 18       // SPI Clock (connect to TFT SCL pins)
@@ -43,6 +45,8 @@
 #define TFT_DC 19        // Data/Command (connect to TFT DC pins)
 #define TFT_RST -1       // Connected to ESP32 reset pin (connect to TFT RES pins)
 #define TFT_BL 8         // Backlight control (connect to TFT BLK pins)
+#define TFT_SPI_FREQUENCY 40000000  // Shared bus clock (Adafruit ESP32 default)
+#define DISPLAY_BROADCAST_INIT true  // Init all panels at once, every CS asserted
 
 // ==============================================
 // Navigation Logic Configuration
@@ -69,6 +73,11 @@
 #define LED_STATE_TASK_INCOMPLETE HIGH   // LED ON = task not done
 #define LED_STATE_TASK_COMPLETE LOW      // LED OFF = task complete
 
+// LEDC PWM mode (ESP32): dimmable LEDs with timer-driven blink/breathe
+#define LED_PWM_ENABLED true
+#define LED_BRIGHTNESS 160               // Duty for a lit LED, 0-255
+#define LED_PATTERN_PERIOD_MS 2000       // Default blink/breathe cycle
+
 // ==============================================
 // Spare GPIO for Future Expansion
 // ==============================================
@@ -112,61 +121,3 @@ static_assert(TOTAL_ROW_SELECT_BUTTONS == 2,
 // Button state tracking
 #define TASK_BUTTON_ACTIVE_STATE LOW   // Buttons are active low with pullup
 #define ROW_SELECT_ACTIVE_STATE LOW    // Momentary buttons active low
-
-// ==============================================
-// Navigation State Configuration
-// ==============================================
-enum NavigationState {
-	NAV_SHOWING_CONTENT,     // Normal content display
-	NAV_SHOWING_COLUMN_TITLE // Showing column title after select press
-};
-
-struct RowState {
-	int currentColumn;       // 0-3, which column is currently selected
-	unsigned long titleStartTime;  // When column title started showing
-	NavigationState navState;       // Current navigation state
-};
-
-// ==============================================
-// Hardware Interface Class Declaration
-// ==============================================
-class GPIOManager {
-public:
-	static void initialize();
-	static void setupPins();
-	
-	// Task button handling (non-momentary) - 8 buttons total
-	static bool hasTaskButtonChanged(int buttonIndex);
-	static bool getTaskButtonState(int buttonIndex);
-	static void updateTaskButtonStates();
-	
-	// LED control - INVERTED LOGIC: ON = incomplete, OFF = complete
-	static void setTaskLED(int ledIndex, bool taskComplete);
-	static void setTaskIncomplete(int ledIndex);  // Turn LED ON
-	static void setTaskComplete(int ledIndex);    // Turn LED OFF
-	static void setAllTasksIncomplete();          // All LEDs ON
-	static void setAllTasksComplete();            // All LEDs OFF
-	
-	// Row select button handling (momentary)
-	static bool isRowSelectPressed(int rowIndex);
-	static void updateRowSelectStates();
-	
-	// Display control
-	static void setDisplayBacklight(bool state);
-	static int getDisplayForPosition(int row, int col);
-	
-	// Navigation helpers
-	static int getRowFromDisplay(int displayIndex);
-	static int getColFromDisplay(int displayIndex);
-	
-	// Task button to display mapping
-	static int getDisplayForButton(int buttonIndex);
-	static int getButtonForDisplay(int displayIndex);
-	
-private:
-	static bool taskButtonStates[TOTAL_TASK_BUTTONS];
-	static bool taskButtonPreviousStates[TOTAL_TASK_BUTTONS];
-	static bool rowSelectStates[TOTAL_ROW_SELECT_BUTTONS];
-	static bool rowSelectPreviousStates[TOTAL_ROW_SELECT_BUTTONS];
-	static unsigned long lastDebounceTime[TOTAL_TASK_BUTTONS + TOTAL_ROW_SELECT_BUTTONS];
-};
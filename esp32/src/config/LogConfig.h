@@ -0,0 +1,18 @@
+#pragma once
+
+// ==============================================
+// Logging Configuration
+// ==============================================
+// Per-module levels: messages above a module's level compile out entirely.
+// 0 = off, 1 = error, 2 = warn, 3 = info, 4 = debug
+#define LOG_LEVEL_SYSTEM 3
+#define LOG_LEVEL_GPIO 3
+#define LOG_LEVEL_NAV 3
+#define LOG_LEVEL_DISPLAY 3
+#define LOG_LEVEL_DEMO 3
+#define LOG_LEVEL_SCHED 3
+#define LOG_LEVEL_NET 3
+
+// Records wait in RAM until the drain task writes them out
+#define LOG_BUFFER_BYTES 4096        // Power of two
+#define LOG_BINARY_OUTPUT false      // true: raw records for tools/log_decode.py
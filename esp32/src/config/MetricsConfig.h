@@ -0,0 +1,8 @@
+#pragma once
+
+// ==============================================
+// Metrics Configuration
+// ==============================================
+// Section timers (METRIC_SCOPE) and their histograms. When false the
+// timers compile out and every section reports zero samples.
+#define METRICS_ENABLED true
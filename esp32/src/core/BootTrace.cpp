@@ -0,0 +1,80 @@
+#include "BootTrace.h"
+#include "../utils/Log.h"
+
+// Static member definitions
+BootPhase BootTrace::phases[MAX_PHASES];
+int BootTrace::phaseCount = 0;
+uint32_t BootTrace::startMicros = 0;
+bool BootTrace::finished = false;
+
+void BootTrace::begin() {
+	startMicros = micros();
+	phaseCount = 0;
+	finished = false;
+}
+
+void BootTrace::mark(const char* phase) {
+	if (finished || phaseCount >= MAX_PHASES) return;
+	phases[phaseCount++] = {phase, (uint32_t)micros()};
+}
+
+void BootTrace::finish() {
+	if (finished) return;
+	mark("ready");
+	finished = true;
+
+	// The longest phase is usually the one worth looking at
+	int longest = 0;
+	for (int i = 1; i < phaseCount; i++) {
+		if (getPhaseMicros(i) > getPhaseMicros(longest)) longest = i;
+	}
+	LOG_INFO(MODULE_SYSTEM, "Boot: ready %lu ms after reset, setup() %lu ms, longest %s %lu ms\n",
+	         (unsigned long)(getReadyMicros() / 1000), (unsigned long)((getReadyMicros() - startMicros) / 1000),
+	         getPhaseName(longest), (unsigned long)(getPhaseMicros(longest) / 1000));
+}
+
+bool BootTrace::isFinished() {
+	return finished;
+}
+
+uint32_t BootTrace::getStartMicros() {
+	return startMicros;
+}
+
+uint32_t BootTrace::getReadyMicros() {
+	return finished ? phases[phaseCount - 1].endMicros : 0;
+}
+
+int BootTrace::getPhaseCount() {
+	return phaseCount;
+}
+
+uint32_t BootTrace::getPhaseMicros(int index) {
+	if (index < 0 || index >= phaseCount) return 0;
+	uint32_t from = index ? phases[index - 1].endMicros : startMicros;
+	return phases[index].endMicros - from;
+}
+
+const char* BootTrace::getPhaseName(int index) {
+	return index >= 0 && index < phaseCount ? phases[index].name : "";
+}
+
+void BootTrace::printReport(Print& out) {
+	out.printf("Boot: setup() at %.1f ms, %s %.1f ms after reset\n", startMicros / 1000.0,
+	           finished ? "ready at" : "not ready yet;", (finished ? getReadyMicros() : micros()) / 1000.0);
+	out.printf("  %-12s %9s %9s\n", "phase", "took ms", "at ms");
+	for (int i = 0; i < phaseCount; i++) {
+		out.printf("  %-12s %9.1f %9.1f\n", phases[i].name, getPhaseMicros(i) / 1000.0,
+		           phases[i].endMicros / 1000.0);
+	}
+}
+
+void BootTrace::writeJson(Print& out) {
+	out.printf("{\"start_us\":%lu,\"ready_us\":%lu,\"phases\":[", (unsigned long)startMicros,
+	           (unsigned long)getReadyMicros());
+	for (int i = 0; i < phaseCount; i++) {
+		out.printf("%s{\"name\":\"%s\",\"us\":%lu}", i ? "," : "", phases[i].name,
+		           (unsigned long)getPhaseMicros(i));
+	}
+	out.print("]}");
+}
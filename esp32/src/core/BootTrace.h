@@ -0,0 +1,43 @@
+#pragma once
+#include <Arduino.h>
+
+// ==============================================
+// Boot phase tracer
+// ==============================================
+// setup() calls mark() as each stage of bring-up finishes; a phase's time is
+// from the mark before it (or from begin()) to its own. Times are micros()
+// since reset, so begin() also shows what the bootloader and core took
+// before setup() ran. finish() closes the last phase at "ready" - inputs
+// are live and the first screen is on its way - and logs one summary line.
+// The table is on the serial console ("boot") and in GET /api/metrics.
+// Marks after finish() are ignored, as are those past MAX_PHASES.
+
+struct BootPhase {
+	const char* name;         // A literal; kept by pointer
+	uint32_t endMicros;
+};
+
+class BootTrace {
+public:
+	static const int MAX_PHASES = 16;
+
+	static void begin();
+	static void mark(const char* phase);
+	static void finish();
+
+	static bool isFinished();
+	static uint32_t getStartMicros();
+	static uint32_t getReadyMicros();     // 0 until finish()
+	static int getPhaseCount();
+	static uint32_t getPhaseMicros(int index);
+	static const char* getPhaseName(int index);
+
+	static void printReport(Print& out);
+	static void writeJson(Print& out);    // Object for GET /api/metrics
+
+private:
+	static BootPhase phases[MAX_PHASES];
+	static int phaseCount;
+	static uint32_t startMicros;
+	static bool finished;
+};
@@ -0,0 +1,145 @@
+#include "DemoAnimation.h"
+#include "DemoManager.h"
+#include "../config/Config.h"
+
+// One frame per DEMO_ANIMATION_FPS tick of the loop
+static const int FRAME_COUNT = DemoAnimation::LOOP_MS * DEMO_ANIMATION_FPS / 1000;
+static_assert(FRAME_COUNT > 0, "DEMO_ANIMATION_FPS too low for the loop");
+
+// Time each theme colour takes to blend into the next
+static const uint16_t THEME_BLEND_MS = 300;
+
+#define TRACK(keys, kind) {keys, sizeof(keys) / sizeof(keys[0]), kind}
+
+// Sparkle tracks; positions are for a 170x320 portrait screen
+struct SpriteTracks {
+	uint8_t pattern;
+	uint8_t size;           // Base size, at scale 256
+	KeyframeTrack x;
+	KeyframeTrack y;
+	KeyframeTrack scale;
+	KeyframeTrack colour;
+};
+
+// Upper left, looping down and back while it twinkles
+static const Keyframe SPARKLE0_X[] = {{0, 25}, {1000, 60}, {2000, 40}, {3000, 15}, {4000, 25}};
+static const Keyframe SPARKLE0_Y[] = {{0, 40}, {2000, 110}, {4000, 40}};
+static const Keyframe SPARKLE0_SCALE[] = {{0, 64}, {500, 256}, {1000, 96}, {1500, 256}, {2000, 64},
+                                          {2500, 256}, {3000, 96}, {3500, 256}, {4000, 64}};
+static const Keyframe SPARKLE0_COLOUR[] = {{0, DemoColours::YELLOW}, {1000, DemoColours::CYAN},
+                                           {2000, DemoColours::PINK}, {3000, DemoColours::LIME},
+                                           {4000, DemoColours::YELLOW}};
+
+// Right, below the text
+static const Keyframe SPARKLE1_X[] = {{0, 140}, {1333, 110}, {2666, 150}, {4000, 140}};
+static const Keyframe SPARKLE1_Y[] = {{0, 250}, {2000, 215}, {4000, 250}};
+static const Keyframe SPARKLE1_SCALE[] = {{0, 256}, {700, 64}, {1400, 256}, {2000, 128}, {2700, 256},
+                                          {3300, 64}, {4000, 256}};
+static const Keyframe SPARKLE1_COLOUR[] = {{0, DemoColours::WHITE}, {2000, DemoColours::GOLD},
+                                           {4000, DemoColours::WHITE}};
+
+// Across the bottom and back
+static const Keyframe SPARKLE2_X[] = {{0, 20}, {2000, 150}, {4000, 20}};
+static const Keyframe SPARKLE2_Y[] = {{0, 290}, {1000, 280}, {2000, 300}, {3000, 280}, {4000, 290}};
+static const Keyframe SPARKLE2_SCALE[] = {{0, 128}, {1000, 256}, {2000, 64}, {3000, 256}, {4000, 128}};
+static const Keyframe SPARKLE2_COLOUR[] = {{0, DemoColours::MAGENTA}, {1300, DemoColours::ORANGE},
+                                           {2600, DemoColours::CYAN}, {4000, DemoColours::MAGENTA}};
+
+static const SpriteTracks SPARKLES[DemoAnimation::SPRITE_COUNT] = {
+	{DemoPatterns::CIRCLE, 8, TRACK(SPARKLE0_X, TRACK_LINEAR), TRACK(SPARKLE0_Y, TRACK_LINEAR),
+	 TRACK(SPARKLE0_SCALE, TRACK_LINEAR), TRACK(SPARKLE0_COLOUR, TRACK_COLOUR)},
+	{DemoPatterns::DIAMOND, 10, TRACK(SPARKLE1_X, TRACK_LINEAR), TRACK(SPARKLE1_Y, TRACK_LINEAR),
+	 TRACK(SPARKLE1_SCALE, TRACK_LINEAR), TRACK(SPARKLE1_COLOUR, TRACK_COLOUR)},
+	{DemoPatterns::CIRCLE, 6, TRACK(SPARKLE2_X, TRACK_LINEAR), TRACK(SPARKLE2_Y, TRACK_LINEAR),
+	 TRACK(SPARKLE2_SCALE, TRACK_LINEAR), TRACK(SPARKLE2_COLOUR, TRACK_COLOUR)},
+};
+
+// Baked by initialize()
+static SpriteFrame frames[FRAME_COUNT][DemoAnimation::SPRITE_COUNT];
+
+// Static member definitions
+Keyframe DemoAnimation::themeKeys[MAX_THEME_KEYS];
+KeyframeTrack DemoAnimation::themeTrack = {themeKeys, 0, TRACK_COLOUR};
+
+void DemoAnimation::initialize() {
+	for (int frame = 0; frame < FRAME_COUNT; frame++) {
+		uint32_t t = frame * 1000 / DEMO_ANIMATION_FPS;
+		for (int i = 0; i < SPRITE_COUNT; i++) {
+			const SpriteTracks& tracks = SPARKLES[i];
+			int32_t size = (tracks.size * evaluate(tracks.scale, t) + 128) >> 8;
+			frames[frame][i] = {(int16_t)evaluate(tracks.x, t), (int16_t)evaluate(tracks.y, t),
+			                    (uint8_t)constrain(size, 1, 255), (uint16_t)evaluate(tracks.colour, t)};
+		}
+	}
+
+	// Each palette colour held, then blended into the next; key times are
+	// 16-bit, so a slow cycle drops colours off the end
+	int keys = 0;
+	int colours = min(DemoManager::DEMO_COLOUR_COUNT, (MAX_THEME_KEYS - 1) / 2);
+	colours = min(colours, (int)(65535 / DEMO_COLOUR_CYCLE_MS));
+	for (int i = 0; i < colours; i++) {
+		uint16_t start = i * DEMO_COLOUR_CYCLE_MS;
+		themeKeys[keys++] = {start, DemoManager::DEMO_COLOURS[i]};
+		themeKeys[keys++] = {(uint16_t)(start + DEMO_COLOUR_CYCLE_MS - THEME_BLEND_MS), DemoManager::DEMO_COLOURS[i]};
+	}
+	themeKeys[keys++] = {(uint16_t)(colours * DEMO_COLOUR_CYCLE_MS), DemoManager::DEMO_COLOURS[0]};
+	themeTrack.count = keys;
+}
+
+int DemoAnimation::getFrameCount() {
+	return FRAME_COUNT;
+}
+
+uint32_t DemoAnimation::getFramePeriodMs() {
+	return 1000 / DEMO_ANIMATION_FPS;
+}
+
+int DemoAnimation::frameAt(uint32_t elapsedMs) {
+	return ((uint64_t)elapsedMs * DEMO_ANIMATION_FPS / 1000) % FRAME_COUNT;
+}
+
+const SpriteFrame& DemoAnimation::sprite(int frame, int index) {
+	return frames[frame % FRAME_COUNT][index % SPRITE_COUNT];
+}
+
+uint8_t DemoAnimation::spritePattern(int index) {
+	return SPARKLES[index % SPRITE_COUNT].pattern;
+}
+
+uint16_t DemoAnimation::themeColour(uint32_t elapsedMs) {
+	return evaluate(themeTrack, elapsedMs);
+}
+
+int32_t DemoAnimation::evaluate(const KeyframeTrack& track, uint32_t timeMs) {
+	if (track.count == 0) return 0;
+	const Keyframe* keys = track.keys;
+	uint32_t loop = keys[track.count - 1].at;
+	if (track.count == 1 || loop == 0) return keys[0].value;
+
+	timeMs %= loop;
+	int next = 1;
+	while (next < track.count - 1 && keys[next].at <= timeMs) next++;
+	const Keyframe& from = keys[next - 1];
+	const Keyframe& to = keys[next];
+	if (to.at <= from.at) return to.value;
+
+	uint32_t fraction = ((timeMs - from.at) << 16) / (to.at - from.at);
+	if (track.kind == TRACK_COLOUR) {
+		return blendColour(from.value, to.value, fraction);
+	}
+	return from.value + (int32_t)(((int64_t)(to.value - from.value) * fraction) >> 16);
+}
+
+uint16_t DemoAnimation::blendColour(uint16_t from, uint16_t to, uint32_t fraction) {
+	// Red, green and blue fields of RGB565, each blended on its own
+	static const uint8_t SHIFTS[] = {11, 5, 0};
+	static const uint16_t MASKS[] = {0x1F, 0x3F, 0x1F};
+	uint16_t colour = 0;
+	for (int i = 0; i < 3; i++) {
+		int32_t a = (from >> SHIFTS[i]) & MASKS[i];
+		int32_t b = (to >> SHIFTS[i]) & MASKS[i];
+		int32_t channel = a + (((b - a) * (int32_t)fraction) >> 16);
+		colour |= (channel & MASKS[i]) << SHIFTS[i];
+	}
+	return colour;
+}
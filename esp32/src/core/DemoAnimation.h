@@ -0,0 +1,69 @@
+#pragma once
+#include <Arduino.h>
+
+// ==============================================
+// Demo mode keyframe animation
+// ==============================================
+// Sparkles drift over the demo screen along keyframe tracks for position,
+// scale and colour, evaluated in fixed point: a segment's progress is a Q16
+// fraction, scale is Q8.8 of the sprite's base size and colours blend per
+// RGB565 channel. initialize() bakes the tracks into a table holding one
+// frame per DEMO_ANIMATION_FPS tick of a LOOP_MS loop, so showing a frame
+// is a lookup. Frames follow the clock rather than the tick count: a late
+// tick moves on to the frame due instead of slowing the loop down.
+//
+// The theme colour is a track as well. It steps through the demo palette
+// every DEMO_COLOUR_CYCLE_MS with a short blend, and is evaluated on demand.
+
+struct Keyframe {
+	uint16_t at;            // ms into the loop
+	int32_t value;          // Pixels, Q8.8 scale or RGB565
+};
+
+enum TrackKind : uint8_t {
+	TRACK_LINEAR = 0,
+	TRACK_COLOUR            // Blended per RGB565 channel
+};
+
+struct KeyframeTrack {
+	const Keyframe* keys;   // By time; the last key's time is the loop length
+	uint8_t count;
+	TrackKind kind;
+};
+
+// A sprite as drawn in one frame
+struct SpriteFrame {
+	int16_t x;              // Centre
+	int16_t y;
+	uint8_t size;           // Pixels, never 0
+	uint16_t colour;
+};
+
+class DemoAnimation {
+public:
+	static const int SPRITE_COUNT = 3;
+	static const uint32_t LOOP_MS = 4000;
+
+	// Bakes the sprite frames; call once, before anything renders
+	static void initialize();
+
+	static int getFrameCount();
+	static uint32_t getFramePeriodMs();
+
+	// Loop frame due elapsedMs after the demo started
+	static int frameAt(uint32_t elapsedMs);
+	static const SpriteFrame& sprite(int frame, int index);
+	static uint8_t spritePattern(int index);
+
+	static uint16_t themeColour(uint32_t elapsedMs);
+
+	// Value of a track at timeMs, wrapped into its loop
+	static int32_t evaluate(const KeyframeTrack& track, uint32_t timeMs);
+	static uint16_t blendColour(uint16_t from, uint16_t to, uint32_t fraction);   // Q16
+
+private:
+	static const int MAX_THEME_KEYS = 32;
+
+	static Keyframe themeKeys[MAX_THEME_KEYS];
+	static KeyframeTrack themeTrack;
+};
@@ -1,22 +1,21 @@
 #include "DemoManager.h"
+#include "DemoAnimation.h"
 #include "../hardware/GPIOManager.h"
+#include "../utils/Log.h"
 #include <Arduino.h>
 
 // Static member definitions
 bool DemoManager::demoActive = false;
 unsigned long DemoManager::demoStartTime = 0;
-unsigned long DemoManager::lastAnimationUpdate = 0;
-int DemoManager::animationPhase = 0;
-uint16_t DemoManager::currentThemeColour = DemoColours::BLUE;
+unsigned long DemoManager::lastStatsReport = 0;
 
 DemoPerson DemoManager::demoPersons[2];
 DemoWeather DemoManager::demoWeather;
 DemoFamily DemoManager::demoFamilyEvents[4];
 int DemoManager::familyEventCount = 0;
 
-unsigned long DemoManager::lastColourCycle = 0;
-int DemoManager::colourPhase = 0;
-bool DemoManager::animationDirection = true;
+StateSnapshot<DemoSnapshot> DemoManager::snapshot;
+uint32_t DemoManager::snapshotVersion = 0;
 
 // Demo colour palette
 const uint16_t DemoManager::DEMO_COLOURS[] = {
@@ -45,27 +44,23 @@ void DemoManager::initialize() {
 	
 	demoActive = false;
 	demoStartTime = 0;
-	lastAnimationUpdate = 0;
-	animationPhase = 0;
-	currentThemeColour = DemoColours::BLUE;
 	
-	lastColourCycle = 0;
-	colourPhase = 0;
-	animationDirection = true;
+	// Sparkle frames are baked once, before anything renders
+	DemoAnimation::initialize();
 	
 	// Initialize demo content
 	initializeDemoContent();
+	publishSnapshot();
 	
 	Serial.println("DemoManager: Demo system ready");
 }
 
 void DemoManager::startDemo() {
-	Serial.println("🎮 DemoManager: Starting demo mode with colourful content!");
+	LOG_INFO(MODULE_DEMO, "🎮 DemoManager: Starting demo mode with colourful content!\n");
 	
 	demoActive = true;
 	demoStartTime = millis();
-	lastAnimationUpdate = millis();
-	animationPhase = 0;
+	lastStatsReport = millis();
 	
 	// Reset demo content to initial state
 	initializeDemoContent();
@@ -74,52 +69,45 @@ void DemoManager::startDemo() {
 	completeDemoTask(0, 0);  // Emma: Make Bed (completed)
 	completeDemoTask(0, 2);  // Emma: Feed Pet (completed)
 	completeDemoTask(1, 1);  // Jack: Brush Teeth (completed)
+	publishSnapshot();
 	
-	// Set initial LED pattern
-	GPIOManager::setTaskLED(0, true);   // LED 0 OFF (task complete)
-	GPIOManager::setTaskLED(1, false);  // LED 1 ON (task incomplete)
-	GPIOManager::setTaskLED(2, true);   // LED 2 OFF (task complete)
-	GPIOManager::setTaskLED(3, false);  // LED 3 ON (task incomplete)
-	GPIOManager::setTaskLED(4, false);  // LED 4 ON (task incomplete)
-	GPIOManager::setTaskLED(5, true);   // LED 5 OFF (task complete)
-	GPIOManager::setTaskLED(6, false);  // LED 6 ON (task incomplete)
-	GPIOManager::setTaskLED(7, false);  // LED 7 ON (task incomplete)
+	// Set initial LED pattern: LEDs 0, 2 and 5 OFF (complete), the rest ON
+	GPIOManager::setLedFrame(0b11011010);
 	
-	Serial.println("Demo mode started with sample completed tasks!");
+	// Incomplete tasks breathe while the demo runs (LEDC mode)
+	for (int i = 0; i < 8; i++) {
+		GPIOManager::setLedPattern(i, LED_PATTERN_BREATHE);
+	}
+	
+	LOG_INFO(MODULE_DEMO, "Demo mode started with sample completed tasks!\n");
 }
 
 void DemoManager::stopDemo() {
-	Serial.println("DemoManager: Stopping demo mode");
+	LOG_INFO(MODULE_DEMO, "DemoManager: Stopping demo mode\n");
 	
 	demoActive = false;
 	demoStartTime = 0;
+	publishSnapshot();
 	
 	// Reset all LEDs
+	for (int i = 0; i < 8; i++) {
+		GPIOManager::setLedPattern(i, LED_PATTERN_STEADY);
+	}
 	GPIOManager::setAllTasksIncomplete();
 	
-	Serial.println("Demo mode stopped - returned to normal operation");
+	LOG_INFO(MODULE_DEMO, "Demo mode stopped - returned to normal operation\n");
 }
 
 void DemoManager::update() {
 	if (!demoActive) return;
 	
+	// Animation is played on the render side, timed from the snapshot's startTime
 	unsigned long now = millis();
 	
-	// Update animations every 100ms
-	if (now - lastAnimationUpdate >= 100) {
-		updateAnimations();
-		lastAnimationUpdate = now;
-	}
-	
-	// Cycle colours every 3 seconds
-	if (now - lastColourCycle >= 3000) {
-		cycleDemoColours();
-		lastColourCycle = now;
-	}
-	
 	// Show periodic demo stats
-	if ((now - demoStartTime) % 10000 < 100) {  // Every 10 seconds
+	if (now - lastStatsReport >= 10000) {  // Every 10 seconds
 		showDemoStats();
+		lastStatsReport = now;
 	}
 }
 
@@ -128,7 +116,7 @@ void DemoManager::initializeDemoContent() {
 	setupDemoWeather();
 	setupDemoFamily();
 	
-	Serial.println("Demo content initialized with colourful tasks and data");
+	LOG_INFO(MODULE_DEMO, "Demo content initialized with colourful tasks and data\n");
 }
 
 void DemoManager::setupDemoPersons() {
@@ -186,13 +174,14 @@ void DemoManager::toggleDemoTask(int personIndex, int taskIndex) {
 	
 	if (task.isCompleted) {
 		task.completedTime = millis();
-		Serial.printf("Demo: %s completed '%s' - great job! ⭐\n", 
+		LOG_INFO(MODULE_DEMO, "Demo: %s completed '%s' - great job! ⭐\n", 
 		              demoPersons[personIndex].name.c_str(), task.name.c_str());
 	} else {
 		task.completedTime = 0;
-		Serial.printf("Demo: %s reset '%s'\n", 
+		LOG_INFO(MODULE_DEMO, "Demo: %s reset '%s'\n", 
 		              demoPersons[personIndex].name.c_str(), task.name.c_str());
 	}
+	publishSnapshot();
 }
 
 void DemoManager::completeDemoTask(int personIndex, int taskIndex) {
@@ -202,8 +191,9 @@ void DemoManager::completeDemoTask(int personIndex, int taskIndex) {
 	if (!task.isCompleted) {
 		task.isCompleted = true;
 		task.completedTime = millis();
-		Serial.printf("Demo: %s completed '%s'! 🎉\n", 
+		LOG_INFO(MODULE_DEMO, "Demo: %s completed '%s'! 🎉\n", 
 		              demoPersons[personIndex].name.c_str(), task.name.c_str());
+		if (demoActive) publishSnapshot();
 	}
 }
 
@@ -213,33 +203,9 @@ void DemoManager::resetDemoTask(int personIndex, int taskIndex) {
 	DemoTask& task = demoPersons[personIndex].tasks[taskIndex];
 	task.isCompleted = false;
 	task.completedTime = 0;
-	Serial.printf("Demo: %s reset '%s'\n", 
+	LOG_INFO(MODULE_DEMO, "Demo: %s reset '%s'\n", 
 	              demoPersons[personIndex].name.c_str(), task.name.c_str());
-}
-
-void DemoManager::updateAnimations() {
-	animationPhase = (animationPhase + 1) % 100;  // 0-99 cycle
-	
-	// Update theme colour with smooth transitions
-	currentThemeColour = getNextAnimationColour();
-}
-
-void DemoManager::cycleDemoColours() {
-	if (animationDirection) {
-		colourPhase = (colourPhase + 1) % DEMO_COLOUR_COUNT;
-	} else {
-		colourPhase = (colourPhase - 1 + DEMO_COLOUR_COUNT) % DEMO_COLOUR_COUNT;
-	}
-	
-	// Change direction occasionally for variety
-	if (random(100) < 10) {  // 10% chance to change direction
-		animationDirection = !animationDirection;
-	}
-}
-
-uint16_t DemoManager::getNextAnimationColour() {
-	// Smoothly cycle through demo colours
-	return DEMO_COLOURS[colourPhase];
+	publishSnapshot();
 }
 
 void DemoManager::showDemoStats() {
@@ -321,10 +287,32 @@ float DemoManager::getCompletionPercentage(int personIndex) {
 }
 
 uint16_t DemoManager::getCurrentThemeColour() {
-	return currentThemeColour;
+	return demoActive ? DemoAnimation::themeColour(millis() - demoStartTime) : DemoColours::BLUE;
 }
 
 void DemoManager::resetDemo() {
-	Serial.println("Resetting demo content to initial state");
+	LOG_INFO(MODULE_DEMO, "Resetting demo content to initial state\n");
 	initializeDemoContent();
+	publishSnapshot();
+}
+
+void DemoManager::publishSnapshot() {
+	// Copied here, on the writer's side, so the render side never sees
+	// the Strings mid-update
+	DemoSnapshot state;
+	state.version = ++snapshotVersion;
+	state.active = demoActive;
+	state.startTime = demoStartTime;
+	for (int i = 0; i < 2; i++) state.persons[i] = demoPersons[i];
+	state.weather = demoWeather;
+	for (int i = 0; i < 4; i++) state.family[i] = demoFamilyEvents[i];
+	snapshot.publish(state);
+}
+
+bool DemoManager::refreshSnapshot() {
+	return snapshot.refresh();
+}
+
+const DemoSnapshot& DemoManager::readSnapshot() {
+	return snapshot.current();
 } 
\ No newline at end of file
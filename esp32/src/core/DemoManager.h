@@ -1,5 +1,6 @@
 #pragma once
 #include <Arduino.h>
+#include "../utils/StateSnapshot.h"
 
 // Demo task structure for fixed demo content
 struct DemoTask {
@@ -39,6 +40,16 @@ struct DemoFamily {
 	bool isActive;
 };
 
+// Everything the demo screens draw, as published for the render side
+struct DemoSnapshot {
+	uint32_t version;       // Bumped on every publish
+	bool active;
+	uint32_t startTime;     // millis() when the demo started; the animation clock
+	DemoPerson persons[2];
+	DemoWeather weather;
+	DemoFamily family[4];
+};
+
 class DemoManager {
 public:
 	// Initialisation and control
@@ -65,7 +76,11 @@ public:
 	// Visual effects and animations
 	static void runDemoAnimation();
 	static void showDemoStats();
-	static uint16_t getCurrentThemeColour();
+	static uint16_t getCurrentThemeColour();   // Off the DemoAnimation theme track
+	
+	// Demo colour palette (shared with DisplayManager)
+	static const uint16_t DEMO_COLOURS[];
+	static const int DEMO_COLOUR_COUNT;
 	
 	// Demo content helpers
 	static String getPersonTaskSummary(int personIndex);
@@ -73,12 +88,17 @@ public:
 	static int getTotalTaskCount(int personIndex);
 	static float getCompletionPercentage(int personIndex);
 	
+	// Render side: refreshSnapshot() takes the last published demo state,
+	// once per frame; readSnapshot() returns it unchanged until the next
+	// refresh. Only the render side may call these - the snapshot has a
+	// single reader.
+	static bool refreshSnapshot();
+	static const DemoSnapshot& readSnapshot();
+	
 private:
 	static bool demoActive;
 	static unsigned long demoStartTime;
-	static unsigned long lastAnimationUpdate;
-	static int animationPhase;
-	static uint16_t currentThemeColour;
+	static unsigned long lastStatsReport;
 	
 	// Demo data storage
 	static DemoPerson demoPersons[2];    // Emma and Jack
@@ -86,23 +106,18 @@ private:
 	static DemoFamily demoFamilyEvents[4];  // Up to 4 family events
 	static int familyEventCount;
 	
-	// Animation and visual state
-	static unsigned long lastColourCycle;
-	static int colourPhase;
-	static bool animationDirection;
+	// Hand-over to the render side; published after every change
+	static StateSnapshot<DemoSnapshot> snapshot;
+	static uint32_t snapshotVersion;
 	
 	// Private helper methods
 	static void initializeDemoContent();
+	static void publishSnapshot();
 	static void setupDemoPersons();
 	static void setupDemoWeather();
 	static void setupDemoFamily();
-	static void updateAnimations();
-	static void cycleDemoColours();
-	static uint16_t getNextAnimationColour();
 	
 	// Demo content constants
-	static const uint16_t DEMO_COLOURS[];
-	static const int DEMO_COLOUR_COUNT;
 	static const String DEMO_TASK_NAMES[];
 	static const String DEMO_TASK_DESCRIPTIONS[];
 	static const int DEMO_TASK_COUNT;
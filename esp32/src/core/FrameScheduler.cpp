@@ -0,0 +1,147 @@
+#include "FrameScheduler.h"
+#include "Metrics.h"
+#include "../utils/Log.h"
+#ifdef ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+// Static member definitions
+FrameScheduler::Job FrameScheduler::jobs[MAX_JOBS];
+int FrameScheduler::jobCount = 0;
+uint32_t FrameScheduler::tickPeriod = 10000;
+uint32_t FrameScheduler::budget = 8000;
+uint32_t FrameScheduler::tickStart = 0;
+bool FrameScheduler::inTick = false;
+void* FrameScheduler::tickTask = nullptr;
+FrameSchedulerStats FrameScheduler::stats = {0, 0, 0, 0};
+uint32_t FrameScheduler::reportedOverruns = 0;
+unsigned long FrameScheduler::lastReport = 0;
+
+// Overruns are summarised at most this often
+static const unsigned long OVERRUN_REPORT_MS = 10000;
+
+void FrameScheduler::initialize(uint32_t tickPeriodMicros, uint32_t budgetMicros) {
+	tickPeriod = tickPeriodMicros;
+	budget = min(budgetMicros, tickPeriodMicros);
+	jobCount = 0;
+	resetStats();
+
+	Serial.printf("FrameScheduler: %lu us ticks, %lu us budget\n",
+	              (unsigned long)tickPeriod, (unsigned long)budget);
+}
+
+bool FrameScheduler::addJob(const char* name, FramePriority priority, FrameJobFunction job, bool essential) {
+	if (jobCount >= MAX_JOBS || !job) return false;
+
+	// Keep the table in priority order; equal priorities run in the order added
+	int slot = jobCount;
+	while (slot > 0 && jobs[slot - 1].priority > priority) {
+		jobs[slot] = jobs[slot - 1];
+		slot--;
+	}
+	jobs[slot] = {job, priority, essential, {name, 0, 0, 0, 0}};
+	jobCount++;
+	return true;
+}
+
+void FrameScheduler::tick() {
+	tickStart = micros();
+#ifdef ESP32
+	tickTask = xTaskGetCurrentTaskHandle();
+#endif
+	inTick = true;
+
+	for (int i = 0; i < jobCount; i++) {
+		Job& job = jobs[i];
+		if (!job.essential && !hasBudget()) {
+			job.stats.skips++;
+			continue;
+		}
+
+		uint32_t start = micros();
+		job.function();
+		uint32_t elapsed = micros() - start;
+
+		job.stats.runs++;
+		job.stats.totalMicros += elapsed;
+		if (elapsed > job.stats.maxMicros) job.stats.maxMicros = elapsed;
+	}
+
+	inTick = false;
+	uint32_t elapsed = micros() - tickStart;
+	stats.ticks++;
+	stats.lastTickMicros = elapsed;
+	if (elapsed > stats.worstTickMicros) stats.worstTickMicros = elapsed;
+	if (elapsed > budget) stats.overruns++;
+	METRIC_RECORD(METRIC_FRAME_TICK, elapsed * 1000);
+
+	unsigned long now = millis();
+	if (stats.overruns != reportedOverruns && now - lastReport >= OVERRUN_REPORT_MS) {
+		LOG_WARN(MODULE_SCHED, "FrameScheduler: %lu overruns since last report (worst tick %lu us)\n",
+		              (unsigned long)(stats.overruns - reportedOverruns), (unsigned long)stats.worstTickMicros);
+		reportedOverruns = stats.overruns;
+		lastReport = now;
+	}
+
+	// Sleep out the rest of the period so the idle task (and WiFi) get the core
+	elapsed = micros() - tickStart;
+	if (elapsed < tickPeriod) {
+		uint32_t idle = tickPeriod - elapsed;
+		if (idle >= 1000) delay(idle / 1000);
+		if (idle % 1000) delayMicroseconds(idle % 1000);
+	} else {
+		yield();
+	}
+}
+
+bool FrameScheduler::hasBudget() {
+	return !inTick || !onTickTask() || (micros() - tickStart) < budget;
+}
+
+uint32_t FrameScheduler::remainingMicros() {
+	if (!inTick || !onTickTask()) return budget;
+	uint32_t elapsed = micros() - tickStart;
+	return elapsed < budget ? budget - elapsed : 0;
+}
+
+bool FrameScheduler::onTickTask() {
+#ifdef ESP32
+	return xTaskGetCurrentTaskHandle() == tickTask;
+#else
+	return true;
+#endif
+}
+
+FrameSchedulerStats FrameScheduler::getStats() {
+	return stats;
+}
+
+const FrameJobStats& FrameScheduler::getJobStats(int index) {
+	return jobs[constrain(index, 0, MAX_JOBS - 1)].stats;
+}
+
+int FrameScheduler::getJobCount() {
+	return jobCount;
+}
+
+void FrameScheduler::resetStats() {
+	stats = {0, 0, 0, 0};
+	reportedOverruns = 0;
+	for (int i = 0; i < jobCount; i++) {
+		jobs[i].stats = {jobs[i].stats.name, 0, 0, 0, 0};
+	}
+}
+
+void FrameScheduler::printStats() {
+	Serial.printf("FrameScheduler: %lu ticks, %lu overruns, worst %lu us\n",
+	              (unsigned long)stats.ticks, (unsigned long)stats.overruns,
+	              (unsigned long)stats.worstTickMicros);
+	for (int i = 0; i < jobCount; i++) {
+		const FrameJobStats& job = jobs[i].stats;
+		Serial.printf("  %-10s runs %lu skips %lu avg %lu us max %lu us\n", job.name,
+		              (unsigned long)job.runs, (unsigned long)job.skips,
+		              (unsigned long)(job.runs ? job.totalMicros / job.runs : 0),
+		              (unsigned long)job.maxMicros);
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <Arduino.h>
+
+// ==============================================
+// Cooperative frame scheduler
+// ==============================================
+// loop() runs one tick: every job in priority order, inside a fixed
+// microsecond budget, then sleeps out the rest of the tick period. Essential
+// jobs (input, rendering) run every tick; the others are skipped once the
+// budget is spent. Long work checks hasBudget() and carries on next tick,
+// so input is never more than one tick plus one render step late.
+
+typedef void (*FrameJobFunction)();
+
+enum FramePriority : uint8_t {
+	PRIORITY_INPUT = 0,
+	PRIORITY_NAVIGATION,
+	PRIORITY_LOGIC,
+	PRIORITY_RENDER,
+	PRIORITY_BACKGROUND
+};
+
+struct FrameJobStats {
+	const char* name;
+	uint32_t runs;
+	uint32_t skips;           // Ticks where the budget ran out first
+	uint32_t totalMicros;
+	uint32_t maxMicros;
+};
+
+struct FrameSchedulerStats {
+	uint32_t ticks;
+	uint32_t overruns;        // Ticks that went over budget
+	uint32_t lastTickMicros;
+	uint32_t worstTickMicros;
+};
+
+class FrameScheduler {
+public:
+	static const int MAX_JOBS = 8;
+
+	static void initialize(uint32_t tickPeriodMicros, uint32_t budgetMicros);
+	static bool addJob(const char* name, FramePriority priority, FrameJobFunction job, bool essential);
+
+	// Runs one tick and waits for the next one to start
+	static void tick();
+
+	// Outside a tick, or on another task (the render core), there is no
+	// budget to exhaust
+	static bool hasBudget();
+	static uint32_t remainingMicros();
+
+	static FrameSchedulerStats getStats();
+	static const FrameJobStats& getJobStats(int index);
+	static int getJobCount();
+	static void resetStats();
+	static void printStats();
+
+private:
+	struct Job {
+		FrameJobFunction function;
+		FramePriority priority;
+		bool essential;
+		FrameJobStats stats;
+	};
+
+	static Job jobs[MAX_JOBS];
+	static int jobCount;
+	static uint32_t tickPeriod;
+	static uint32_t budget;
+	static uint32_t tickStart;
+	static bool inTick;
+	static void* tickTask;          // Task running the tick (ESP32 only)
+	static FrameSchedulerStats stats;
+	static uint32_t reportedOverruns;
+	static unsigned long lastReport;
+
+	static bool onTickTask();
+};
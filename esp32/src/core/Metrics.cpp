@@ -0,0 +1,129 @@
+#include "Metrics.h"
+#include "BootTrace.h"
+#include "FrameScheduler.h"
+#include "../hardware/GPIOManager.h"
+#include "../utils/Log.h"
+#ifndef ESP32
+#include <chrono>
+#endif
+
+// Static member definitions
+Metrics::Histogram Metrics::histograms[METRIC_COUNT];
+uint32_t Metrics::cyclesPerMicro = 240;
+
+static const char* const METRIC_NAMES[METRIC_COUNT] = {
+	"display_update", "navigation_update", "row_display",
+	"draw_pattern", "frame_tick", "input_latency", "api_update"
+};
+
+void Metrics::initialize() {
+#ifdef ESP32
+	cyclesPerMicro = getCpuFrequencyMhz();
+#endif
+	reset();
+}
+
+uint32_t Metrics::now() {
+#ifdef ESP32
+	return ESP.getCycleCount();
+#else
+	return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void Metrics::recordSince(MetricId id, uint32_t start) {
+	uint32_t elapsed = now() - start;
+#ifdef ESP32
+	elapsed = (uint32_t)((uint64_t)elapsed * 1000 / cyclesPerMicro);
+#endif
+	record(id, elapsed);
+}
+
+void Metrics::record(MetricId id, uint32_t nanos) {
+	Histogram& histogram = histograms[id];
+	histogram.buckets[bucketFor(nanos)]++;
+	histogram.count++;
+	histogram.totalNanos += nanos;
+	if (nanos > histogram.maxNanos) histogram.maxNanos = nanos;
+}
+
+int Metrics::bucketFor(uint32_t nanos) {
+	// 64 ns steps up to 256 ns, then four steps per power of two
+	if (nanos < 256) return nanos >> 6;
+	int msb = 31 - __builtin_clz(nanos);
+	return (msb - 7) * 4 + ((nanos >> (msb - 2)) & 3);
+}
+
+uint32_t Metrics::bucketLimit(int bucket) {
+	if (bucket < 4) return (bucket + 1) * 64 - 1;
+	int msb = bucket / 4 + 7;
+	uint64_t limit = (1ull << msb) + (uint64_t)(bucket % 4 + 1) * (1ull << (msb - 2));
+	return (uint32_t)min<uint64_t>(limit - 1, UINT32_MAX);
+}
+
+uint32_t Metrics::percentile(const Histogram& histogram, uint32_t perMille) {
+	if (histogram.count == 0) return 0;
+	uint32_t rank = max<uint32_t>(1, (uint32_t)(((uint64_t)histogram.count * perMille + 999) / 1000));
+	uint32_t seen = 0;
+	for (int i = 0; i < BUCKETS; i++) {
+		seen += histogram.buckets[i];
+		if (seen >= rank) return min(bucketLimit(i), histogram.maxNanos);
+	}
+	return histogram.maxNanos;
+}
+
+MetricSummary Metrics::summarise(MetricId id) {
+	const Histogram& histogram = histograms[id];
+	return {METRIC_NAMES[id], histogram.count, percentile(histogram, 500),
+	        percentile(histogram, 990), histogram.maxNanos, histogram.totalNanos};
+}
+
+void Metrics::reset() {
+	memset(histograms, 0, sizeof(histograms));
+}
+
+void Metrics::printReport(Print& out) {
+	out.printf("Metrics (%s, us):\n", METRICS_ENABLED ? "enabled" : "disabled");
+	out.printf("  %-18s %8s %9s %9s %9s %9s\n", "section", "count", "mean", "p50", "p99", "max");
+	for (int i = 0; i < METRIC_COUNT; i++) {
+		MetricSummary summary = summarise((MetricId)i);
+		out.printf("  %-18s %8lu %9.1f %9.1f %9.1f %9.1f\n", summary.name, (unsigned long)summary.count,
+		           summary.count ? summary.totalNanos / 1000.0 / summary.count : 0.0,
+		           summary.p50Nanos / 1000.0, summary.p99Nanos / 1000.0, summary.maxNanos / 1000.0);
+	}
+
+	LogStats log = Log::getStats();
+	InputLatencyStats input = GPIOManager::getLatencyStats();
+	out.printf("  input: %lu edges dropped; log: %lu records, %lu dropped, %lu bytes high water\n",
+	           (unsigned long)input.droppedEdges, (unsigned long)log.records,
+	           (unsigned long)log.dropped, (unsigned long)log.highWater);
+}
+
+void Metrics::writeJson(Print& out) {
+	// Written straight to the output; nothing is built up in RAM
+	out.printf("{\"uptime_ms\":%lu,\"enabled\":%s,\"sections\":[",
+	           (unsigned long)millis(), METRICS_ENABLED ? "true" : "false");
+	for (int i = 0; i < METRIC_COUNT; i++) {
+		MetricSummary summary = summarise((MetricId)i);
+		out.printf("%s{\"name\":\"%s\",\"count\":%lu,\"mean_us\":%.3f,\"p50_us\":%.3f,\"p99_us\":%.3f,\"max_us\":%.3f}",
+		           i ? "," : "", summary.name, (unsigned long)summary.count,
+		           summary.count ? summary.totalNanos / 1000.0 / summary.count : 0.0,
+		           summary.p50Nanos / 1000.0, summary.p99Nanos / 1000.0, summary.maxNanos / 1000.0);
+	}
+
+	FrameSchedulerStats scheduler = FrameScheduler::getStats();
+	InputLatencyStats input = GPIOManager::getLatencyStats();
+	LogStats log = Log::getStats();
+	out.printf("],\"scheduler\":{\"ticks\":%lu,\"overruns\":%lu,\"worst_tick_us\":%lu}",
+	           (unsigned long)scheduler.ticks, (unsigned long)scheduler.overruns,
+	           (unsigned long)scheduler.worstTickMicros);
+	out.printf(",\"input\":{\"samples\":%lu,\"max_latency_us\":%lu,\"dropped_edges\":%lu}",
+	           (unsigned long)input.samples, (unsigned long)input.maxMicros,
+	           (unsigned long)input.droppedEdges);
+	out.printf(",\"log\":{\"records\":%lu,\"dropped\":%lu,\"high_water\":%lu}",
+	           (unsigned long)log.records, (unsigned long)log.dropped, (unsigned long)log.highWater);
+	out.print(",\"boot\":");
+	BootTrace::writeJson(out);
+	out.print("}\n");
+}
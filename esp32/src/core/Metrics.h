@@ -0,0 +1,91 @@
+#pragma once
+#include <Arduino.h>
+#include "../config/MetricsConfig.h"
+
+// ==============================================
+// Hot-path section timing
+// ==============================================
+// METRIC_SCOPE(METRIC_DISPLAY_UPDATE) times the rest of the enclosing block
+// with the CPU cycle counter (steady_clock on the host) and adds the result
+// to that section's histogram. Buckets are log-linear, four per power of
+// two from 256 ns, so p50/p99 are within a quarter of the true value from a
+// fixed 400 bytes per section. Nothing allocates. With METRICS_ENABLED false
+// the macros are empty.
+// Each section has one writer. A report read from another task can catch a
+// sample half-added, which skews only that report.
+
+enum MetricId : uint8_t {
+	METRIC_DISPLAY_UPDATE = 0,
+	METRIC_NAVIGATION_UPDATE,
+	METRIC_ROW_DISPLAY,
+	METRIC_DRAW_PATTERN,
+	METRIC_FRAME_TICK,
+	METRIC_INPUT_LATENCY,     // Edge to debounced event, from GPIOManager
+	METRIC_API_UPDATE,        // One APIServer::update(), answers included
+	METRIC_COUNT
+};
+
+struct MetricSummary {
+	const char* name;
+	uint32_t count;
+	uint32_t p50Nanos;        // Bucket upper bounds
+	uint32_t p99Nanos;
+	uint32_t maxNanos;        // Exact
+	uint64_t totalNanos;
+};
+
+class Metrics {
+public:
+	static const int BUCKETS = 100;
+
+	static void initialize();
+
+	// Timestamp in counter units: CPU cycles on target, ns on the host
+	static uint32_t now();
+	static void recordSince(MetricId id, uint32_t start);
+	static void record(MetricId id, uint32_t nanos);
+
+	static MetricSummary summarise(MetricId id);
+	static void reset();
+
+	// Table for the serial console; JSON body of GET /api/metrics
+	static void printReport(Print& out);
+	static void writeJson(Print& out);
+
+	static int bucketFor(uint32_t nanos);
+	static uint32_t bucketLimit(int bucket);
+
+private:
+	struct Histogram {
+		uint32_t buckets[BUCKETS];
+		uint32_t count;
+		uint32_t maxNanos;
+		uint64_t totalNanos;
+	};
+
+	static uint32_t percentile(const Histogram& histogram, uint32_t perMille);
+
+	static Histogram histograms[METRIC_COUNT];
+	static uint32_t cyclesPerMicro;
+};
+
+// Times from construction to the end of the enclosing scope
+class MetricScope {
+public:
+	explicit MetricScope(MetricId id) : id(id), start(Metrics::now()) {}
+	~MetricScope() { Metrics::recordSince(id, start); }
+
+private:
+	MetricId id;
+	uint32_t start;
+};
+
+#if METRICS_ENABLED
+#define METRIC_JOIN_(a, b) a##b
+#define METRIC_JOIN(a, b) METRIC_JOIN_(a, b)
+#define METRIC_SCOPE(id) MetricScope METRIC_JOIN(metricScope, __LINE__)(id)
+#define METRIC_RECORD(id, nanos) Metrics::record(id, nanos)
+#else
+#define METRIC_SCOPE(id) do {} while (0)
+#define METRIC_RECORD(id, nanos) do {} while (0)
+#endif
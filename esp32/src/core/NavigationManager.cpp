@@ -1,6 +1,8 @@
 #include "NavigationManager.h"
 #include "../config/GPIOConfig.h"
 #include "../hardware/GPIOManager.h"
+#include "Metrics.h"
+#include "../utils/Log.h"
 #include <Arduino.h>
 
 // Static member definitions
@@ -31,11 +33,10 @@ void NavigationManager::initialize() {
 }
 
 void NavigationManager::update() {
-	// Check for row select button presses
+	METRIC_SCOPE(METRIC_NAVIGATION_UPDATE);
+	
+	// Row select presses arrive as GPIOManager events, via handleRowSelect()
 	for (int row = 0; row < TOTAL_ROWS; row++) {
-		if (GPIOManager::isRowSelectPressed(row)) {
-			handleRowSelect(row);
-		}
 		updateRowState(row);
 	}
 }
@@ -45,7 +46,7 @@ void NavigationManager::handleRowSelect(int rowIndex) {
 		return;
 	}
 	
-	Serial.printf("NavigationManager: Row %d select button pressed\n", rowIndex);
+	LOG_INFO(MODULE_NAV, "NavigationManager: Row %d select button pressed\n", rowIndex);
 	
 	// Cycle to next column
 	cycleColumn(rowIndex);
@@ -55,7 +56,7 @@ void NavigationManager::handleRowSelect(int rowIndex) {
 	rowStates[rowIndex].titleStartTime = millis();
 	rowStates[rowIndex].needsUpdate = true;
 	
-	Serial.printf("NavigationManager: Row %d now showing column %d (\"%s\")\n", 
+	LOG_INFO(MODULE_NAV, "NavigationManager: Row %d now showing column %d (\"%s\")\n", 
 	              rowIndex, rowStates[rowIndex].currentColumn, 
 	              columnTitles[rowStates[rowIndex].currentColumn].c_str());
 }
@@ -92,7 +93,7 @@ void NavigationManager::transitionToContent(int rowIndex) {
 	rowStates[rowIndex].navState = NAV_SHOWING_CONTENT;
 	rowStates[rowIndex].needsUpdate = true;
 	
-	Serial.printf("NavigationManager: Row %d transitioning to content for column %d\n", 
+	LOG_INFO(MODULE_NAV, "NavigationManager: Row %d transitioning to content for column %d\n", 
 	              rowIndex, rowStates[rowIndex].currentColumn);
 }
 
@@ -133,7 +134,7 @@ String NavigationManager::getColumnTitle(int columnIndex) {
 void NavigationManager::setColumnTitle(int columnIndex, const String& title) {
 	if (columnIndex >= 0 && columnIndex < MAX_COLUMNS) {
 		columnTitles[columnIndex] = title;
-		Serial.printf("NavigationManager: Column %d title set to \"%s\"\n", 
+		LOG_INFO(MODULE_NAV, "NavigationManager: Column %d title set to \"%s\"\n", 
 		              columnIndex, title.c_str());
 	}
 }
@@ -158,7 +159,7 @@ int NavigationManager::getDisplayIndexForRowColumn(int rowIndex, int columnIndex
 
 void NavigationManager::setColumnDisplayTime(unsigned long timeMs) {
 	columnDisplayTimeMs = timeMs;
-	Serial.printf("NavigationManager: Column display time set to %lu ms\n", timeMs);
+	LOG_INFO(MODULE_NAV, "NavigationManager: Column display time set to %lu ms\n", timeMs);
 }
 
 void NavigationManager::resetToColumn(int rowIndex, int columnIndex) {
@@ -171,12 +172,12 @@ void NavigationManager::resetToColumn(int rowIndex, int columnIndex) {
 	rowStates[rowIndex].navState = NAV_SHOWING_CONTENT;
 	rowStates[rowIndex].needsUpdate = true;
 	
-	Serial.printf("NavigationManager: Row %d reset to column %d\n", rowIndex, columnIndex);
+	LOG_INFO(MODULE_NAV, "NavigationManager: Row %d reset to column %d\n", rowIndex, columnIndex);
 }
 
 void NavigationManager::forceDisplayUpdate(int rowIndex) {
 	if (rowIndex >= 0 && rowIndex < TOTAL_ROWS) {
 		rowStates[rowIndex].needsUpdate = true;
-		Serial.printf("NavigationManager: Forced display update for row %d\n", rowIndex);
+		LOG_INFO(MODULE_NAV, "NavigationManager: Forced display update for row %d\n", rowIndex);
 	}
 } 
\ No newline at end of file
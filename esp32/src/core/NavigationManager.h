@@ -1,9 +1,6 @@
 #pragma once
 #include <Arduino.h>
-
-// Forward declarations
-constexpr int MAX_COLUMNS = 4;
-constexpr int TOTAL_ROWS = 2;
+#include "../config/GPIOConfig.h"
 
 enum NavigationState {
 	NAV_SHOWING_CONTENT,     // Normal content display
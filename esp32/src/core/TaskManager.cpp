@@ -0,0 +1,334 @@
+#include "TaskManager.h"
+#include "../utils/Log.h"
+
+// Static member definitions
+ChoreTask TaskManager::tasks[MAX_TASKS];
+bool TaskManager::used[MAX_TASKS] = {false};
+bool TaskManager::completedHere[MAX_TASKS] = {false};
+TimerWheel<TaskManager::MAX_TASKS> TaskManager::timers;
+uint32_t TaskManager::clockBase = 0;
+bool TaskManager::clockSet = false;
+bool TaskManager::changed = false;
+SpscQueue<TaskEvent, TaskManager::EVENT_QUEUE_DEPTH> TaskManager::events;
+uint32_t TaskManager::droppedEvents = 0;
+StateSnapshot<TaskSnapshot> TaskManager::snapshot;
+uint32_t TaskManager::snapshotVersion = 0;
+uint32_t TaskManager::sequence = 0;
+uint32_t TaskManager::modified[MAX_TASKS] = {0};
+TaskRemoval TaskManager::removals[REMOVAL_LOG] = {};
+int TaskManager::removalHead = 0;
+uint32_t TaskManager::deltaHorizon = 0;
+
+// Seconds since boot, carried across millis() wrapping
+static uint32_t uptimeSeconds = 0;
+static unsigned long uptimeMillis = 0;
+
+static const char* const TYPE_NAMES[] = {"untimed", "fixed_time", "timed_with_early"};
+static const char* const STATE_NAMES[] = {"pending", "active", "completed", "expired", "auto_removed"};
+
+template <size_t N>
+static void terminate(char (&text)[N]) {
+	text[N - 1] = '\0';
+}
+
+void TaskManager::initialize() {
+	clear();
+	clockBase = 0;
+	clockSet = false;
+	timers.reset(now());
+	publishSnapshot();
+}
+
+void TaskManager::setTime(uint32_t unixSeconds) {
+	now();
+	clockBase = unixSeconds - uptimeSeconds;
+	bool first = !clockSet;
+	clockSet = true;
+
+	// Timers were filed against the old clock
+	timers.rebase(unixSeconds, onTimer);
+
+	// Timed tasks have been waiting for a real clock
+	for (int i = 0; first && i < MAX_TASKS; i++) {
+		if (used[i] && tasks[i].state == TASK_PENDING) onTimer(i);
+	}
+	if (changed) publishSnapshot();
+	LOG_INFO(MODULE_SYSTEM, "TaskManager: Clock set to %lu\n", (unsigned long)unixSeconds);
+}
+
+uint32_t TaskManager::now() {
+	unsigned long elapsed = millis() - uptimeMillis;
+	uptimeSeconds += elapsed / 1000;
+	uptimeMillis += (elapsed / 1000) * 1000;
+	return clockBase + uptimeSeconds;
+}
+
+bool TaskManager::hasTime() {
+	return clockSet;
+}
+
+void TaskManager::update() {
+	advanceTo(now());
+}
+
+void TaskManager::advanceTo(uint32_t time) {
+	timers.advance(time, onTimer);
+	if (changed) publishSnapshot();
+}
+
+int TaskManager::addTask(const ChoreTask& task) {
+	int slot = findTask(task.id);
+	if (slot < 0) {
+		for (int i = 0; i < MAX_TASKS && slot < 0; i++) {
+			if (!used[i]) slot = i;
+		}
+		if (slot < 0) {
+			LOG_WARN(MODULE_SYSTEM, "TaskManager: No free slot for task %s\n", task.id);
+			return -1;
+		}
+	}
+
+	// A task already completed elsewhere stays completed. So does one
+	// completed here, until the feed has heard: a list sent before the
+	// completion reached HA still calls it active. A new occurrence (other
+	// times) starts afresh. Anything else takes the state its times give it.
+	TaskState previous = used[slot] ? tasks[slot].state : TASK_PENDING;
+	bool keepCompletion = used[slot] && completedHere[slot] && task.state != TASK_COMPLETED &&
+	                      tasks[slot].startTime == task.startTime && tasks[slot].endTime == task.endTime;
+	TaskState state = task.state == TASK_COMPLETED || keepCompletion ? TASK_COMPLETED : stateAt(task, timers.now());
+	if (state == TASK_AUTO_REMOVED && !used[slot]) return -1;
+
+	uint32_t completedTime = tasks[slot].completedTime;
+	bool same = used[slot] && sameTask(tasks[slot], task);
+	tasks[slot] = task;
+	if (keepCompletion) tasks[slot].completedTime = completedTime;
+	completedHere[slot] = keepCompletion;
+	terminate(tasks[slot].id);
+	terminate(tasks[slot].title);
+	terminate(tasks[slot].personId);
+	terminate(tasks[slot].reward);
+	tasks[slot].state = previous;
+	used[slot] = true;
+	changed = true;
+	if (!same) touch(slot);
+
+	setState(slot, state);
+	if (state == TASK_AUTO_REMOVED) {
+		// Ended since the feed last said; the slot goes, as at its end timer
+		release(slot);
+		slot = -1;
+	} else {
+		arm(slot);
+	}
+	publishSnapshot();
+	return slot;
+}
+
+bool TaskManager::removeTask(const char* id) {
+	int slot = findTask(id);
+	if (slot < 0) return false;
+
+	release(slot);
+	publishSnapshot();
+	return true;
+}
+
+void TaskManager::clear() {
+	for (int i = 0; i < MAX_TASKS; i++) {
+		timers.cancel(i);
+		used[i] = false;
+		completedHere[i] = false;
+	}
+	// Removals are not logged one by one; any delta from before now is void
+	deltaHorizon = ++sequence;
+	changed = true;
+	publishSnapshot();
+}
+
+int TaskManager::handleSwitch(int switchId) {
+	for (int i = 0; i < MAX_TASKS; i++) {
+		if (used[i] && tasks[i].switchId == switchId && tasks[i].state == TASK_ACTIVE &&
+		    tasks[i].type != TASK_FIXED_TIME) {
+			return completeTask(tasks[i].id) ? i : -1;
+		}
+	}
+	return -1;
+}
+
+bool TaskManager::completeTask(const char* id) {
+	int slot = findTask(id);
+	if (slot < 0 || tasks[slot].state != TASK_ACTIVE || tasks[slot].type == TASK_FIXED_TIME) {
+		return false;
+	}
+
+	timers.cancel(slot);
+	tasks[slot].completedTime = timers.now();
+	completedHere[slot] = true;
+	setState(slot, TASK_COMPLETED);
+	publishSnapshot();
+	return true;
+}
+
+int TaskManager::findTask(const char* id) {
+	for (int i = 0; i < MAX_TASKS; i++) {
+		if (used[i] && strncmp(tasks[i].id, id, sizeof(tasks[i].id)) == 0) return i;
+	}
+	return -1;
+}
+
+const ChoreTask* TaskManager::getTask(int slot) {
+	if (slot < 0 || slot >= MAX_TASKS || !used[slot]) return nullptr;
+	return &tasks[slot];
+}
+
+int TaskManager::getTaskCount() {
+	int count = 0;
+	for (int i = 0; i < MAX_TASKS; i++) {
+		if (used[i]) count++;
+	}
+	return count;
+}
+
+bool TaskManager::pollEvent(TaskEvent& event) {
+	return events.pop(event);
+}
+
+uint32_t TaskManager::getDroppedEvents() {
+	return droppedEvents;
+}
+
+bool TaskManager::refreshSnapshot() {
+	return snapshot.refresh();
+}
+
+const TaskSnapshot& TaskManager::readSnapshot() {
+	return snapshot.current();
+}
+
+uint32_t TaskManager::getSequence() {
+	return sequence;
+}
+
+uint32_t TaskManager::getModified(int slot) {
+	return slot >= 0 && slot < MAX_TASKS ? modified[slot] : 0;
+}
+
+uint32_t TaskManager::getDeltaHorizon() {
+	return deltaHorizon;
+}
+
+const TaskRemoval* TaskManager::getRemoval(int index) {
+	if (index < 0 || index >= REMOVAL_LOG) return nullptr;
+	const TaskRemoval& removal = removals[(removalHead + index) % REMOVAL_LOG];
+	return removal.sequence ? &removal : nullptr;
+}
+
+const char* TaskManager::typeName(TaskType type) {
+	return type <= TASK_TIMED_WITH_EARLY ? TYPE_NAMES[type] : "unknown";
+}
+
+const char* TaskManager::stateName(TaskState state) {
+	return state <= TASK_AUTO_REMOVED ? STATE_NAMES[state] : "unknown";
+}
+
+void TaskManager::setState(int slot, TaskState state) {
+	ChoreTask& task = tasks[slot];
+	if (task.state == state) return;
+
+	TaskEvent event = {(uint8_t)slot, task.switchId, task.state, state, timers.now()};
+	task.state = state;
+	changed = true;
+	touch(slot);
+	if (!events.push(event)) droppedEvents++;
+}
+
+TaskState TaskManager::stateAt(const ChoreTask& task, uint32_t time) {
+	if (!clockSet && (task.startTime || task.endTime)) return TASK_PENDING;
+	if (task.startTime && (int32_t)(task.startTime - time) > 0) return TASK_PENDING;
+	if (task.endTime && (int32_t)(task.endTime - time) <= 0) {
+		return task.type == TASK_FIXED_TIME ? TASK_AUTO_REMOVED : TASK_EXPIRED;
+	}
+	return TASK_ACTIVE;
+}
+
+void TaskManager::arm(int slot) {
+	// A slot's one timer is its start while pending and its end while
+	// active; a timed task has none until the clock is set
+	const ChoreTask& task = tasks[slot];
+	if (task.state == TASK_PENDING && clockSet) {
+		timers.schedule(slot, task.startTime);
+	} else if (task.state == TASK_ACTIVE && task.endTime) {
+		timers.schedule(slot, task.endTime);
+	} else {
+		timers.cancel(slot);
+	}
+}
+
+void TaskManager::release(int slot) {
+	timers.cancel(slot);
+	logRemoval(slot);
+	used[slot] = false;
+	completedHere[slot] = false;
+	changed = true;
+}
+
+void TaskManager::onTimer(uint8_t slot) {
+	if (!used[slot]) return;
+	setState(slot, stateAt(tasks[slot], timers.now()));
+
+	// A fixed_time task is gone at its end, and its slot with it
+	if (tasks[slot].state == TASK_AUTO_REMOVED) {
+		release(slot);
+	} else {
+		arm(slot);
+	}
+}
+
+void TaskManager::publishSnapshot() {
+	if (!changed) return;
+	changed = false;
+
+	// Per display: its active task, otherwise the one last completed
+	TaskSnapshot state = {};
+	state.version = ++snapshotVersion;
+	for (int i = 0; i < MAX_TASKS; i++) {
+		const ChoreTask& task = tasks[i];
+		if (!used[i] || task.switchId < 0 || task.switchId >= TOTAL_TFT_DISPLAYS) continue;
+
+		TaskSlotView& view = state.displays[task.switchId];
+		bool shown = task.state == TASK_ACTIVE ||
+		             (task.state == TASK_COMPLETED && !(view.present && view.state == TASK_ACTIVE));
+		if (!shown) continue;
+
+		view.present = true;
+		view.state = task.state;
+		view.type = task.type;
+		view.endTime = task.endTime;
+		memcpy(view.title, task.title, sizeof(view.title));
+	}
+	snapshot.publish(state);
+}
+
+bool TaskManager::sameTask(const ChoreTask& a, const ChoreTask& b) {
+	// Everything the feed sets; state is tracked on its own
+	return strncmp(a.id, b.id, sizeof(a.id)) == 0 &&
+	       strncmp(a.title, b.title, sizeof(a.title)) == 0 &&
+	       strncmp(a.personId, b.personId, sizeof(a.personId)) == 0 &&
+	       strncmp(a.reward, b.reward, sizeof(a.reward)) == 0 &&
+	       a.type == b.type && a.startTime == b.startTime && a.endTime == b.endTime &&
+	       a.rewardTime == b.rewardTime && a.switchId == b.switchId;
+}
+
+void TaskManager::touch(int slot) {
+	modified[slot] = ++sequence;
+}
+
+void TaskManager::logRemoval(int slot) {
+	// The entry pushed out takes its sequence with it: a delta from before
+	// that would miss a removal
+	TaskRemoval& removal = removals[removalHead];
+	if (removal.sequence) deltaHorizon = removal.sequence;
+	memcpy(removal.id, tasks[slot].id, sizeof(removal.id));
+	removal.sequence = ++sequence;
+	removalHead = (removalHead + 1) % REMOVAL_LOG;
+}
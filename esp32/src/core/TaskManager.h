@@ -0,0 +1,169 @@
+#pragma once
+#include <Arduino.h>
+#include "../config/GPIOConfig.h"
+#include "../utils/SpscQueue.h"
+#include "../utils/StateSnapshot.h"
+#include "../utils/TimerWheel.h"
+
+// ==============================================
+// Task engine
+// ==============================================
+// The three-tier task model from project_outline.md:
+//   untimed           active as soon as it is added, completed by its switch
+//   fixed_time        appears at start_time, removed at end_time, no switch
+//   timed_with_early  appears at start_time, can be completed by its switch
+//                     until end_time, expired after that
+// Tasks live in fixed slots and never allocate. Each slot has at most one
+// pending timer, either its start or its end, on a TimerWheel with one-second
+// ticks. Activation and expiry therefore cost O(1) per tick however many
+// tasks are loaded, instead of a scan of every task.
+//
+// Times are seconds on the task clock: Unix time once setTime() has been
+// called, and seconds since boot until then. Task times are Unix times, so
+// until then timed tasks are held pending, with no timer, and take their
+// state when the clock is first set. update() reads the clock; advanceTo()
+// takes the time directly, for a simulated clock.
+//
+// State changes are queued as TaskEvents for the control side, and the task
+// shown on each display is published as a TaskSnapshot for the render side.
+//
+// Every change to the task list also takes the next sequence number, for
+// delta sync: each slot keeps the sequence of its last change, and the last
+// REMOVAL_LOG removals are kept as well, so "what changed since N" can be
+// answered for any N from getDeltaHorizon() on.
+
+enum TaskType : uint8_t {
+	TASK_UNTIMED = 0,
+	TASK_FIXED_TIME,
+	TASK_TIMED_WITH_EARLY
+};
+
+enum TaskState : uint8_t {
+	TASK_PENDING = 0,
+	TASK_ACTIVE,
+	TASK_COMPLETED,
+	TASK_EXPIRED,
+	TASK_AUTO_REMOVED
+};
+
+struct ChoreTask {
+	char id[24];
+	char title[32];
+	char personId[16];
+	char reward[24];
+	TaskType type;
+	TaskState state;
+	uint32_t startTime;       // 0 = none
+	uint32_t endTime;         // 0 = none
+	uint32_t completedTime;
+	uint32_t rewardTime;
+	int8_t switchId;          // Task switch (and display); -1 = none
+};
+
+struct TaskRemoval {
+	char id[24];
+	uint32_t sequence;        // 0 = empty
+};
+
+struct TaskEvent {
+	uint8_t slot;
+	int8_t switchId;
+	TaskState from;
+	TaskState to;
+	uint32_t time;            // Task clock
+};
+
+// What each display shows, for the render side
+struct TaskSlotView {
+	bool present;
+	TaskState state;
+	TaskType type;
+	uint32_t endTime;
+	char title[32];
+};
+
+struct TaskSnapshot {
+	uint32_t version;
+	TaskSlotView displays[TOTAL_TFT_DISPLAYS];
+};
+
+class TaskManager {
+public:
+	static const int MAX_TASKS = 32;
+	static const size_t EVENT_QUEUE_DEPTH = 16;
+	static const int REMOVAL_LOG = 16;
+
+	static void initialize();
+
+	// Task clock
+	static void setTime(uint32_t unixSeconds);
+	static uint32_t now();
+	static bool hasTime();                      // setTime() has been called
+
+	// Runs every timer due by now; call once per tick
+	static void update();
+	static void advanceTo(uint32_t time);
+
+	// Adds or replaces (matched by id) a task; its state is set from its
+	// type and times. A task completed here stays completed until the feed
+	// reports it completed too. Returns the slot, or -1 when every slot is
+	// in use or the task is a fixed_time one already past its end.
+	static int addTask(const ChoreTask& task);
+	static bool removeTask(const char* id);
+	static void clear();
+
+	// A task switch turned on. The slot of the task it completed, or -1.
+	static int handleSwitch(int switchId);
+	static bool completeTask(const char* id);
+
+	static int findTask(const char* id);
+	static const ChoreTask* getTask(int slot);   // nullptr for a free slot
+	static int getTaskCount();
+
+	// Control side: state changes in the order they happened
+	static bool pollEvent(TaskEvent& event);
+	static uint32_t getDroppedEvents();
+
+	// Render side, as for DemoManager: refreshSnapshot() once per frame,
+	// then readSnapshot() as often as needed. The snapshot has a single
+	// reader.
+	static bool refreshSnapshot();
+	static const TaskSnapshot& readSnapshot();
+
+	// Change log
+	static uint32_t getSequence();
+	static uint32_t getModified(int slot);
+	static uint32_t getDeltaHorizon();         // Oldest sequence a delta can start from
+	static const TaskRemoval* getRemoval(int index);   // Oldest first; nullptr when empty
+
+	static const char* typeName(TaskType type);
+	static const char* stateName(TaskState state);
+
+private:
+	static TaskState stateAt(const ChoreTask& task, uint32_t time);
+	static void setState(int slot, TaskState state);
+	static void arm(int slot);
+	static void release(int slot);
+	static void onTimer(uint8_t slot);
+	static void publishSnapshot();
+	static bool sameTask(const ChoreTask& a, const ChoreTask& b);
+	static void touch(int slot);
+	static void logRemoval(int slot);
+
+	static ChoreTask tasks[MAX_TASKS];
+	static bool used[MAX_TASKS];
+	static bool completedHere[MAX_TASKS];   // Not yet reported completed by the feed
+	static TimerWheel<MAX_TASKS> timers;
+	static uint32_t clockBase;          // Task clock at millis() == 0
+	static bool clockSet;               // Task clock is Unix time
+	static bool changed;                // Snapshot is out of date
+	static SpscQueue<TaskEvent, EVENT_QUEUE_DEPTH> events;
+	static uint32_t droppedEvents;
+	static StateSnapshot<TaskSnapshot> snapshot;
+	static uint32_t snapshotVersion;
+	static uint32_t sequence;
+	static uint32_t modified[MAX_TASKS];
+	static TaskRemoval removals[REMOVAL_LOG];
+	static int removalHead;
+	static uint32_t deltaHorizon;
+};
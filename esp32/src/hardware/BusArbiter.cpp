@@ -0,0 +1,143 @@
+#include "BusArbiter.h"
+#ifdef ESP32
+#include <soc/gpio_struct.h>
+#else
+#include <SimBus.h>
+#endif
+
+// Static member definitions
+const int BusArbiter::MAX_DISPLAYS;
+int BusArbiter::pins[MAX_DISPLAYS];
+uint32_t BusArbiter::pinMasks[MAX_DISPLAYS];
+int BusArbiter::displayCount = 0;
+int BusArbiter::selected = -1;
+uint16_t BusArbiter::selectedMask = 0;
+BusFrameStats BusArbiter::frameStats = {0, 0, 0};
+BusFrameStats BusArbiter::lastFrameStats = {0, 0, 0};
+BusFrameStats BusArbiter::totalStats = {0, 0, 0};
+
+void BusArbiter::initialize(const int* csPins, int count) {
+	displayCount = min(count, MAX_DISPLAYS);
+	selected = -1;
+	selectedMask = 0;
+
+	for (int i = 0; i < displayCount; i++) {
+		pins[i] = csPins[i];
+		// GPIO 0-31 live in the low set/clear registers, 32-39 in the high ones
+		pinMasks[i] = 1UL << (pins[i] & 31);
+
+		pinMode(pins[i], OUTPUT);
+		digitalWrite(pins[i], HIGH);  // CS is active low, start deselected
+#ifndef ESP32
+		// Tell the bus simulator which lines select a panel
+		SimBus::addPanel(pins[i]);
+#endif
+	}
+
+	Serial.printf("BusArbiter: Managing %d chip-select lines\n", displayCount);
+}
+
+void BusArbiter::setLevels(uint16_t displayMask, bool high) {
+	if (!displayMask) return;
+#ifdef ESP32
+	// Every line in one register write per bank
+	uint32_t low = 0;
+	uint32_t upper = 0;
+	for (int i = 0; i < displayCount; i++) {
+		if (!(displayMask & (1u << i))) continue;
+		if (pins[i] < 32) low |= pinMasks[i]; else upper |= pinMasks[i];
+	}
+	if (low) {
+		if (high) GPIO.out_w1ts = low; else GPIO.out_w1tc = low;
+		frameStats.pinWrites++;
+	}
+	if (upper) {
+		if (high) GPIO.out1_w1ts.val = upper; else GPIO.out1_w1tc.val = upper;
+		frameStats.pinWrites++;
+	}
+#else
+	for (int i = 0; i < displayCount; i++) {
+		if (!(displayMask & (1u << i))) continue;
+		digitalWrite(pins[i], high ? HIGH : LOW);
+		frameStats.pinWrites++;
+	}
+#endif
+}
+
+void BusArbiter::select(int displayIndex) {
+	if (displayIndex < 0 || displayIndex >= displayCount) return;
+
+	frameStats.selects++;
+	if (displayIndex == selected) return;
+
+	setLevels(selectedMask, true);
+	setLevels(1u << displayIndex, false);
+	selected = displayIndex;
+	selectedMask = 1u << displayIndex;
+	frameStats.switches++;
+}
+
+void BusArbiter::selectMask(uint16_t displayMask) {
+	displayMask &= allDisplays();
+	if (!displayMask) {
+		deselect();
+		return;
+	}
+
+	frameStats.selects++;
+	if (displayMask == selectedMask) return;
+
+	// Lines leaving the set go high before new ones go low
+	setLevels(selectedMask & ~displayMask, true);
+	setLevels(displayMask & ~selectedMask, false);
+	selectedMask = displayMask;
+	selected = (displayMask & (displayMask - 1)) ? -1 : __builtin_ctz(displayMask);
+	frameStats.switches++;
+}
+
+void BusArbiter::deselect() {
+	if (!selectedMask) return;
+
+	setLevels(selectedMask, true);
+	selected = -1;
+	selectedMask = 0;
+}
+
+int BusArbiter::getSelected() {
+	return selected;
+}
+
+uint16_t BusArbiter::getSelectedMask() {
+	return selectedMask;
+}
+
+uint16_t BusArbiter::allDisplays() {
+	return (1u << displayCount) - 1;
+}
+
+void BusArbiter::endFrame() {
+	lastFrameStats = frameStats;
+	totalStats.selects += frameStats.selects;
+	totalStats.switches += frameStats.switches;
+	totalStats.pinWrites += frameStats.pinWrites;
+	frameStats = {0, 0, 0};
+}
+
+BusFrameStats BusArbiter::getFrameStats() {
+	return lastFrameStats;
+}
+
+BusFrameStats BusArbiter::getTotalStats() {
+	// Include the frame in progress
+	BusFrameStats total = totalStats;
+	total.selects += frameStats.selects;
+	total.switches += frameStats.switches;
+	total.pinWrites += frameStats.pinWrites;
+	return total;
+}
+
+void BusArbiter::resetStats() {
+	frameStats = {0, 0, 0};
+	lastFrameStats = {0, 0, 0};
+	totalStats = {0, 0, 0};
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <Arduino.h>
+
+// ==============================================
+// Chip-select arbiter for the shared display bus
+// ==============================================
+// Owns the eight TFT CS lines (panels are constructed with cs = -1). It
+// remembers which display is selected and only touches GPIO when that
+// changes, so consecutive primitives on one display share one CS assertion.
+// On the ESP32 the lines are driven through the GPIO set/clear registers.
+//
+// selectMask() asserts several lines at once. The panels share SCK, MOSI and
+// DC, so whatever is sent then reaches every one of them - the same bytes for
+// the price of one transfer. Nothing is read back from the panels, so
+// several never drive the bus against each other.
+
+struct BusFrameStats {
+	uint32_t selects;        // select() requests
+	uint32_t switches;       // Requests that actually moved chip-select
+	uint32_t pinWrites;      // Set/clear register writes (digitalWrites on host)
+};
+
+class BusArbiter {
+public:
+	static const int MAX_DISPLAYS = 8;
+
+	static void initialize(const int* csPins, int count);
+
+	static void select(int displayIndex);
+	static void selectMask(uint16_t displayMask);   // Bit n selects display n
+	static void deselect();
+	static int getSelected();                       // -1 for none, or several
+	static uint16_t getSelectedMask();
+	static uint16_t allDisplays();
+
+	// Per-frame accounting; DisplayManager::update() closes a frame each tick
+	static void endFrame();
+	static BusFrameStats getFrameStats();   // Last completed frame
+	static BusFrameStats getTotalStats();
+	static void resetStats();
+
+private:
+	static void setLevels(uint16_t displayMask, bool high);
+
+	static int pins[MAX_DISPLAYS];
+	static uint32_t pinMasks[MAX_DISPLAYS];
+	static int displayCount;
+	static int selected;
+	static uint16_t selectedMask;
+	static BusFrameStats frameStats;
+	static BusFrameStats lastFrameStats;
+	static BusFrameStats totalStats;
+};
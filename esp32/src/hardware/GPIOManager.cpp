@@ -1,13 +1,21 @@
 #include "GPIOManager.h"
 #include "../config/GPIOConfig.h"
+#include "../core/Metrics.h"
+#include "../utils/Log.h"
 #include <Arduino.h>
+#ifdef ESP32
+#include <soc/gpio_reg.h>
+#include <soc/gpio_struct.h>
+#endif
 
 // Static member definitions
-bool GPIOManager::taskButtonStates[TOTAL_TASK_BUTTONS] = {false};
-bool GPIOManager::taskButtonPreviousStates[TOTAL_TASK_BUTTONS] = {false};
-bool GPIOManager::rowSelectStates[TOTAL_ROW_SELECT_BUTTONS] = {false};
-bool GPIOManager::rowSelectPreviousStates[TOTAL_ROW_SELECT_BUTTONS] = {false};
-unsigned long GPIOManager::lastDebounceTime[TOTAL_TASK_BUTTONS + TOTAL_ROW_SELECT_BUTTONS] = {0};
+SpscQueue<GPIOManager::RawEdge, GPIOManager::EDGE_QUEUE_DEPTH> GPIOManager::edgeQueue;
+SpscQueue<ButtonEvent, GPIOManager::EVENT_QUEUE_DEPTH> GPIOManager::eventQueue;
+std::atomic<uint32_t> GPIOManager::droppedEdges(0);
+InputDebouncer GPIOManager::debouncer;
+InputMask GPIOManager::inputSample = 0;
+uint8_t GPIOManager::ledFrame = 0;
+InputLatencyStats GPIOManager::latencyStats = {0, 0, 0, 0, 0};
 
 // Pin arrays for easier iteration
 const int taskButtonPins[TOTAL_TASK_BUTTONS] = TASK_BUTTON_PINS;
@@ -15,13 +23,41 @@ const int taskLEDPins[TOTAL_TASK_LEDS] = TASK_LED_PINS;
 const int rowSelectPins[TOTAL_ROW_SELECT_BUTTONS] = ROW_SELECT_PINS;
 const int tftCSPins[TOTAL_TFT_DISPLAYS] = TFT_CS_PINS;
 
+// Input bits by kind, and the ones that read LOW when active
+static const InputMask TASK_INPUTS = (1u << TOTAL_TASK_BUTTONS) - 1;
+static const InputMask ROW_SELECT_INPUTS = ((1u << TOTAL_ROW_SELECT_BUTTONS) - 1) << TOTAL_TASK_BUTTONS;
+static const InputMask ACTIVE_LOW_INPUTS =
+	(TASK_BUTTON_ACTIVE_STATE == LOW ? TASK_INPUTS : 0) | (ROW_SELECT_ACTIVE_STATE == LOW ? ROW_SELECT_INPUTS : 0);
+
+static const uint8_t ALL_LEDS = (1u << TOTAL_TASK_LEDS) - 1;
+static_assert(!LED_PWM_ENABLED || LED_STATE_TASK_INCOMPLETE == HIGH, "LEDC mode drives LEDs lit by a high output");
+
+// Pin behind each input, numbered like ButtonEvent::input
+static inline int inputPin(int input) {
+	return input < TOTAL_TASK_BUTTONS ? taskButtonPins[input] : rowSelectPins[input - TOTAL_TASK_BUTTONS];
+}
+
 void GPIOManager::initialize() {
 	Serial.println("GPIOManager: Initializing GPIO pins...");
 	setupPins();
 	
-	// Initialize button states
-	updateTaskButtonStates();
-	updateRowSelectStates();
+	// Everything starts released; a switch already on is reported (and its
+	// LED set) by the first processInput()
+	uint32_t windows[INPUT_COUNT];
+	for (int i = 0; i < INPUT_COUNT; i++) {
+		windows[i] = (i < TOTAL_TASK_BUTTONS ? BUTTON_DEBOUNCE_MS : ROW_SELECT_DEBOUNCE_MS) * 1000UL;
+	}
+	debouncer.begin(INPUT_COUNT, windows);
+	
+#if LED_PWM_ENABLED
+	if (LedPwm::begin(taskLEDPins, TOTAL_TASK_LEDS, LED_BRIGHTNESS)) {
+		LedPwm::setFrame(ledFrame);
+	}
+#endif
+	
+	for (int i = 0; i < INPUT_COUNT; i++) {
+		attachInterrupt(digitalPinToInterrupt(inputPin(i)), edgeISR, CHANGE);
+	}
 	
 	// Turn ON all LEDs initially (tasks are incomplete at startup)
 	setAllTasksIncomplete();
@@ -38,27 +74,28 @@ void GPIOManager::setupPins() {
 	// Setup task button pins (non-momentary, with pullup) - 8 buttons
 	for (int i = 0; i < TOTAL_TASK_BUTTONS; i++) {
 		pinMode(taskButtonPins[i], INPUT_PULLUP);
-		Serial.printf("Task Button %d (Display %d) on GPIO %d\n", i, i, taskButtonPins[i]);
+		LOG_DEBUG(MODULE_GPIO, "Task Button %d (Display %d) on GPIO %d\n", i, i, taskButtonPins[i]);
 	}
 	
 	// Setup task LED pins (output) - 8 LEDs
 	for (int i = 0; i < TOTAL_TASK_LEDS; i++) {
 		pinMode(taskLEDPins[i], OUTPUT);
-		digitalWrite(taskLEDPins[i], LED_STATE_TASK_INCOMPLETE);  // Start with tasks incomplete
-		Serial.printf("Task LED %d (Display %d) on GPIO %d\n", i, i, taskLEDPins[i]);
+		LOG_DEBUG(MODULE_GPIO, "Task LED %d (Display %d) on GPIO %d\n", i, i, taskLEDPins[i]);
 	}
+	ledFrame = 0;
+	setLedFrame(ALL_LEDS);  // Start with tasks incomplete
 	
 	// Setup row select button pins (momentary, with pullup)
 	for (int i = 0; i < TOTAL_ROW_SELECT_BUTTONS; i++) {
 		pinMode(rowSelectPins[i], INPUT_PULLUP);
-		Serial.printf("Row Select %d on GPIO %d\n", i, rowSelectPins[i]);
+		LOG_DEBUG(MODULE_GPIO, "Row Select %d on GPIO %d\n", i, rowSelectPins[i]);
 	}
 	
 	// Setup TFT CS pins (output, start high)
 	for (int i = 0; i < TOTAL_TFT_DISPLAYS; i++) {
 		pinMode(tftCSPins[i], OUTPUT);
 		digitalWrite(tftCSPins[i], HIGH);  // CS is active low, start deselected
-		Serial.printf("TFT CS %d on GPIO %d\n", i, tftCSPins[i]);
+		LOG_DEBUG(MODULE_GPIO, "TFT CS %d on GPIO %d\n", i, tftCSPins[i]);
 	}
 	
 	// Setup shared TFT pins
@@ -67,54 +104,169 @@ void GPIOManager::setupPins() {
 	pinMode(TFT_DC, OUTPUT);
 	pinMode(TFT_BL, OUTPUT);
 	
-	Serial.printf("TFT Shared: SCK=%d, MOSI=%d, DC=%d, BL=%d\n", 
-	              TFT_SCK, TFT_MOSI, TFT_DC, TFT_BL);
+	LOG_DEBUG(MODULE_GPIO, "TFT Shared: SCK=%d, MOSI=%d, DC=%d, BL=%d\n",
+	          TFT_SCK, TFT_MOSI, TFT_DC, TFT_BL);
+	
+	// The per-pin lines are debug level; one summary is enough at boot
+	LOG_INFO(MODULE_GPIO, "GPIO: %d buttons, %d LEDs, %d row selects, %d CS lines configured\n",
+	         TOTAL_TASK_BUTTONS, TOTAL_TASK_LEDS, TOTAL_ROW_SELECT_BUTTONS, TOTAL_TFT_DISPLAYS);
 }
 
-bool GPIOManager::hasTaskButtonChanged(int buttonIndex) {
-	if (buttonIndex < 0 || buttonIndex >= TOTAL_TASK_BUTTONS) {
-		return false;
+InputMask IRAM_ATTR GPIOManager::readInputs() {
+	// Both input registers once, then every input picked out of them
+#ifdef ESP32
+	uint64_t levels = ((uint64_t)REG_READ(GPIO_IN1_REG) << 32) | REG_READ(GPIO_IN_REG);
+#else
+	uint64_t levels = 0;
+	for (int i = 0; i < INPUT_COUNT; i++) {
+		if (digitalRead(inputPin(i))) levels |= 1ULL << inputPin(i);
 	}
+#endif
 	
-	bool currentState = (digitalRead(taskButtonPins[buttonIndex]) == TASK_BUTTON_ACTIVE_STATE);
-	bool changed = (currentState != taskButtonPreviousStates[buttonIndex]);
+	InputMask mask = 0;
+	for (int i = 0; i < INPUT_COUNT; i++) {
+		mask |= (InputMask)((levels >> inputPin(i)) & 1) << i;
+	}
+	return mask ^ ACTIVE_LOW_INPUTS;
+}
+
+void IRAM_ATTR GPIOManager::edgeISR() {
+	// Any input edge: record the whole port, so the handler needn't know which
+	RawEdge edge = {readInputs(), (uint32_t)micros()};
+	if (!edgeQueue.push(edge)) {
+		droppedEdges.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void GPIOManager::processInput() {
+	// Replay the captured edges in order, so changes between ticks count
+	RawEdge edge;
+	while (edgeQueue.pop(edge)) {
+		dispatch(debouncer.step(edge.inputs, edge.timestamp));
+	}
 	
-	// Simple debouncing
-	unsigned long now = millis();
-	if (changed && (now - lastDebounceTime[buttonIndex] > BUTTON_DEBOUNCE_MS)) {
-		lastDebounceTime[buttonIndex] = now;
-		taskButtonPreviousStates[buttonIndex] = currentState;
-		taskButtonStates[buttonIndex] = currentState;
+	// This tick's snapshot: settles bounces whose window has closed, and
+	// corrects the state if edges were lost to a full ring
+	inputSample = readInputs();
+	dispatch(debouncer.step(inputSample, micros()));
+}
+
+void GPIOManager::dispatch(InputMask changed) {
+	if (!changed) return;
+	InputMask state = debouncer.state();
+	
+	// Latching switches: their LEDs follow in one write, before anything else
+	uint8_t switched = changed & TASK_INPUTS;
+	if (switched) {
+		setLedFrame((ledFrame & ~switched) | (~state & switched));
 		
-		Serial.printf("Task Button %d (Display %d) changed to %s\n", 
-		              buttonIndex, buttonIndex, currentState ? "ACTIVE" : "INACTIVE");
+		uint32_t now = micros();
+		for (uint8_t bits = switched; bits; bits &= bits - 1) {
+			uint32_t latency = now - debouncer.changedAt(__builtin_ctz(bits));
+			latencyStats.samples++;
+			latencyStats.lastMicros = latency;
+			latencyStats.totalMicros += latency;
+			if (latency > latencyStats.maxMicros) latencyStats.maxMicros = latency;
+			METRIC_RECORD(METRIC_INPUT_LATENCY, latency * 1000);
+		}
+	}
+	
+	for (InputMask bits = changed; bits; bits &= bits - 1) {
+		int input = __builtin_ctz(bits);
+		bool active = state & (1u << input);
+		uint32_t timestamp = debouncer.changedAt(input);
 		
-		// Automatically handle task completion when button changes
-		if (currentState) {
-			setTaskComplete(buttonIndex);  // Turn LED OFF
-			Serial.printf("Task %d (Display %d) COMPLETED - LED OFF\n", buttonIndex, buttonIndex);
-		} else {
-			setTaskIncomplete(buttonIndex);  // Turn LED ON
-			Serial.printf("Task %d (Display %d) RESET - LED ON\n", buttonIndex, buttonIndex);
+		if (input < TOTAL_TASK_BUTTONS) {
+			LOG_INFO(MODULE_GPIO, "Task Button %d (Display %d) changed to %s - LED %s\n", 
+			              input, input, active ? "ACTIVE" : "INACTIVE", active ? "OFF" : "ON");
+		} else if (active) {
+			LOG_INFO(MODULE_GPIO, "Row Select %d pressed\n", input - ROW_SELECT_INPUT);
 		}
 		
-		return true;
+		if (!eventQueue.push({(uint8_t)input, active, timestamp})) {
+			LOG_WARN(MODULE_GPIO, "GPIOManager: Event queue full, input %d change dropped\n", input);
+		}
 	}
-	
-	return false;
+}
+
+bool GPIOManager::pollEvent(ButtonEvent& event) {
+	return eventQueue.pop(event);
+}
+
+InputMask GPIOManager::getInputState() {
+	return debouncer.state();
+}
+
+InputMask GPIOManager::getInputSample() {
+	return inputSample;
+}
+
+InputLatencyStats GPIOManager::getLatencyStats() {
+	InputLatencyStats stats = latencyStats;
+	stats.droppedEdges = droppedEdges.load(std::memory_order_relaxed);
+	return stats;
+}
+
+void GPIOManager::resetLatencyStats() {
+	latencyStats = {0, 0, 0, 0, 0};
 }
 
 bool GPIOManager::getTaskButtonState(int buttonIndex) {
 	if (buttonIndex < 0 || buttonIndex >= TOTAL_TASK_BUTTONS) {
 		return false;
 	}
-	return taskButtonStates[buttonIndex];
+	return debouncer.state() & (1u << buttonIndex);
 }
 
-void GPIOManager::updateTaskButtonStates() {
-	for (int i = 0; i < TOTAL_TASK_BUTTONS; i++) {
-		hasTaskButtonChanged(i);  // This updates the state if changed
+void GPIOManager::setLedFrame(uint8_t litMask) {
+	litMask &= ALL_LEDS;
+	uint8_t changed = litMask ^ ledFrame;
+	ledFrame = litMask;
+	
+	if (LedPwm::isActive()) {
+		LedPwm::setFrame(litMask);
+		return;
+	}
+	
+#ifdef ESP32
+	// Gather every LED into the set/clear registers (GPIO 32+ live in the second bank)
+	uint32_t set = 0, clear = 0, set1 = 0, clear1 = 0;
+	for (int i = 0; i < TOTAL_TASK_LEDS; i++) {
+		bool high = (litMask & (1u << i)) ? LED_STATE_TASK_INCOMPLETE == HIGH : LED_STATE_TASK_COMPLETE == HIGH;
+		int pin = taskLEDPins[i];
+		uint32_t bit = 1UL << (pin & 31);
+		if (pin < 32) {
+			if (high) set |= bit; else clear |= bit;
+		} else {
+			if (high) set1 |= bit; else clear1 |= bit;
+		}
+	}
+	if (set) GPIO.out_w1ts = set;
+	if (clear) GPIO.out_w1tc = clear;
+	if (set1) GPIO.out1_w1ts.val = set1;
+	if (clear1) GPIO.out1_w1tc.val = clear1;
+	(void)changed;
+#else
+	for (uint8_t bits = changed; bits; bits &= bits - 1) {
+		int i = __builtin_ctz(bits);
+		digitalWrite(taskLEDPins[i], (litMask & (1u << i)) ? LED_STATE_TASK_INCOMPLETE : LED_STATE_TASK_COMPLETE);
 	}
+#endif
+}
+
+uint8_t GPIOManager::getLedFrame() {
+	return ledFrame;
+}
+
+void GPIOManager::setLedBrightness(uint8_t level) {
+	LedPwm::setBrightness(level);
+}
+
+void GPIOManager::setLedPattern(int ledIndex, LedPattern pattern, uint16_t periodMs) {
+	if (ledIndex < 0 || ledIndex >= TOTAL_TASK_LEDS) {
+		return;
+	}
+	LedPwm::setPattern(ledIndex, pattern, periodMs);
 }
 
 void GPIOManager::setTaskLED(int ledIndex, bool taskComplete) {
@@ -123,8 +275,12 @@ void GPIOManager::setTaskLED(int ledIndex, bool taskComplete) {
 	}
 	
 	// INVERTED LOGIC: taskComplete=true means LED OFF, taskComplete=false means LED ON
-	digitalWrite(taskLEDPins[ledIndex], taskComplete ? LED_STATE_TASK_COMPLETE : LED_STATE_TASK_INCOMPLETE);
-	Serial.printf("Task LED %d set to %s (task %s)\n", 
+	if (taskComplete) {
+		setLedFrame(ledFrame & ~(1u << ledIndex));
+	} else {
+		setLedFrame(ledFrame | (1u << ledIndex));
+	}
+	LOG_INFO(MODULE_GPIO, "Task LED %d set to %s (task %s)\n", 
 	              ledIndex, 
 	              taskComplete ? "OFF" : "ON",
 	              taskComplete ? "COMPLETE" : "INCOMPLETE");
@@ -134,63 +290,38 @@ void GPIOManager::setTaskIncomplete(int ledIndex) {
 	if (ledIndex < 0 || ledIndex >= TOTAL_TASK_LEDS) {
 		return;
 	}
-	digitalWrite(taskLEDPins[ledIndex], LED_STATE_TASK_INCOMPLETE);  // LED ON
-	Serial.printf("Task %d marked INCOMPLETE - LED ON\n", ledIndex);
+	setLedFrame(ledFrame | (1u << ledIndex));  // LED ON
+	LOG_INFO(MODULE_GPIO, "Task %d marked INCOMPLETE - LED ON\n", ledIndex);
 }
 
 void GPIOManager::setTaskComplete(int ledIndex) {
 	if (ledIndex < 0 || ledIndex >= TOTAL_TASK_LEDS) {
 		return;
 	}
-	digitalWrite(taskLEDPins[ledIndex], LED_STATE_TASK_COMPLETE);  // LED OFF
-	Serial.printf("Task %d marked COMPLETE - LED OFF\n", ledIndex);
+	setLedFrame(ledFrame & ~(1u << ledIndex));  // LED OFF
+	LOG_INFO(MODULE_GPIO, "Task %d marked COMPLETE - LED OFF\n", ledIndex);
 }
 
 void GPIOManager::setAllTasksIncomplete() {
-	for (int i = 0; i < TOTAL_TASK_LEDS; i++) {
-		setTaskIncomplete(i);
-	}
-	Serial.println("All tasks marked INCOMPLETE - All LEDs ON");
+	setLedFrame(ALL_LEDS);
+	LOG_INFO(MODULE_GPIO, "All tasks marked INCOMPLETE - All LEDs ON\n");
 }
 
 void GPIOManager::setAllTasksComplete() {
-	for (int i = 0; i < TOTAL_TASK_LEDS; i++) {
-		setTaskComplete(i);
-	}
-	Serial.println("All tasks marked COMPLETE - All LEDs OFF");
+	setLedFrame(0);
+	LOG_INFO(MODULE_GPIO, "All tasks marked COMPLETE - All LEDs OFF\n");
 }
 
-bool GPIOManager::isRowSelectPressed(int rowIndex) {
+bool GPIOManager::isRowSelectHeld(int rowIndex) {
 	if (rowIndex < 0 || rowIndex >= TOTAL_ROW_SELECT_BUTTONS) {
 		return false;
 	}
-	
-	bool currentState = (digitalRead(rowSelectPins[rowIndex]) == ROW_SELECT_ACTIVE_STATE);
-	bool pressed = false;
-	
-	// Detect button press (transition from released to pressed)
-	if (currentState && !rowSelectPreviousStates[rowIndex]) {
-		unsigned long now = millis();
-		if (now - lastDebounceTime[TOTAL_TASK_BUTTONS + rowIndex] > ROW_SELECT_DEBOUNCE_MS) {
-			lastDebounceTime[TOTAL_TASK_BUTTONS + rowIndex] = now;
-			pressed = true;
-			Serial.printf("Row Select %d pressed\n", rowIndex);
-		}
-	}
-	
-	rowSelectPreviousStates[rowIndex] = currentState;
-	return pressed;
-}
-
-void GPIOManager::updateRowSelectStates() {
-	for (int i = 0; i < TOTAL_ROW_SELECT_BUTTONS; i++) {
-		isRowSelectPressed(i);  // This handles the state update
-	}
+	return debouncer.state() & (1u << (ROW_SELECT_INPUT + rowIndex));
 }
 
 void GPIOManager::setDisplayBacklight(bool state) {
 	digitalWrite(TFT_BL, state ? HIGH : LOW);
-	Serial.printf("Display backlight set to %s\n", state ? "ON" : "OFF");
+	LOG_INFO(MODULE_GPIO, "Display backlight set to %s\n", state ? "ON" : "OFF");
 }
 
 int GPIOManager::getDisplayForPosition(int row, int col) {
@@ -1,23 +1,55 @@
 #pragma once
 #include <Arduino.h>
+#include "../config/GPIOConfig.h"
+#include "../utils/SpscQueue.h"
+#include "InputDebouncer.h"
+#include "LedPwm.h"
 
-// Forward declarations from GPIOConfig.h
-constexpr int TOTAL_TASK_BUTTONS = 8;        // 8 buttons (one per screen)
-constexpr int TOTAL_TASK_LEDS = 8;           // 8 LEDs (one per button)
-constexpr int TOTAL_ROW_SELECT_BUTTONS = 2;
-constexpr int TOTAL_TFT_DISPLAYS = 8;
-constexpr int DISPLAYS_PER_ROW = 4;
-constexpr int TOTAL_ROWS = 2;
+// Debounced input change, in the order the edges happened
+struct ButtonEvent {
+	uint8_t input;          // Task buttons 0-7, then the row selects
+	bool active;            // New state: switch on, or row select pressed
+	uint32_t timestamp;     // micros() at the edge, taken in the ISR
+};
+
+// Edge-to-LED time for task switches, measured from the ISR timestamp
+struct InputLatencyStats {
+	uint32_t samples;
+	uint32_t lastMicros;
+	uint32_t maxMicros;
+	uint32_t totalMicros;
+	uint32_t droppedEdges;  // Edges lost to a full capture ring
+};
 
 class GPIOManager {
 public:
+	static const int INPUT_COUNT = TOTAL_TASK_BUTTONS + TOTAL_ROW_SELECT_BUTTONS;
+	static const int ROW_SELECT_INPUT = TOTAL_TASK_BUTTONS;   // First row select input
+	static const size_t EDGE_QUEUE_DEPTH = 64;
+	static const size_t EVENT_QUEUE_DEPTH = 32;
+	
 	static void initialize();
 	static void setupPins();
 	
+	// Input capture: every input pin interrupts on both edges and the ISR
+	// only queues a snapshot of the port and a timestamp. processInput()
+	// (call it every tick) replays those, then reads the port once more and
+	// debounces all inputs together as a bitmask; accepted changes drive the
+	// task LEDs and are queued as events.
+	static void processInput();
+	static bool pollEvent(ButtonEvent& event);    // Oldest event first; false when none
+	static InputMask getInputState();             // Debounced, bit per input
+	static InputMask getInputSample();            // Raw, as read this tick
+	
 	// Task button handling (non-momentary) - 8 buttons total
-	static bool hasTaskButtonChanged(int buttonIndex);
 	static bool getTaskButtonState(int buttonIndex);
-	static void updateTaskButtonStates();
+	
+	// LED frame: bit i set = LED i on (task incomplete). Every LED is
+	// written at once, through the set/clear registers or LEDC.
+	static void setLedFrame(uint8_t litMask);
+	static uint8_t getLedFrame();
+	static void setLedBrightness(uint8_t level);   // LEDC mode only
+	static void setLedPattern(int ledIndex, LedPattern pattern, uint16_t periodMs = LED_PATTERN_PERIOD_MS);
 	
 	// LED control - INVERTED LOGIC: ON = incomplete, OFF = complete
 	static void setTaskLED(int ledIndex, bool taskComplete);
@@ -27,8 +59,11 @@ public:
 	static void setAllTasksComplete();            // All LEDs OFF
 	
 	// Row select button handling (momentary)
-	static bool isRowSelectPressed(int rowIndex);
-	static void updateRowSelectStates();
+	static bool isRowSelectHeld(int rowIndex);    // Debounced level
+	
+	// Press-to-LED latency
+	static InputLatencyStats getLatencyStats();
+	static void resetLatencyStats();
 	
 	// Display control
 	static void setDisplayBacklight(bool state);
@@ -43,9 +78,23 @@ public:
 	static int getButtonForDisplay(int displayIndex);
 	
 private:
-	static bool taskButtonStates[TOTAL_TASK_BUTTONS];
-	static bool taskButtonPreviousStates[TOTAL_TASK_BUTTONS];
-	static bool rowSelectStates[TOTAL_ROW_SELECT_BUTTONS];
-	static bool rowSelectPreviousStates[TOTAL_ROW_SELECT_BUTTONS];
-	static unsigned long lastDebounceTime[TOTAL_TASK_BUTTONS + TOTAL_ROW_SELECT_BUTTONS];
-}; 
\ No newline at end of file
+	struct RawEdge {
+		InputMask inputs;
+		uint32_t timestamp;
+	};
+	
+	static InputMask readInputs();
+	static void edgeISR();
+	static void dispatch(InputMask changed);
+	
+	// ISR -> loop. Every input shares edgeISR, and GPIO handlers all run from
+	// one interrupt on the core that attached them: a single producer.
+	static SpscQueue<RawEdge, EDGE_QUEUE_DEPTH> edgeQueue;
+	static SpscQueue<ButtonEvent, EVENT_QUEUE_DEPTH> eventQueue;
+	static std::atomic<uint32_t> droppedEdges;
+	
+	static InputDebouncer debouncer;
+	static InputMask inputSample;
+	static uint8_t ledFrame;
+	static InputLatencyStats latencyStats;
+};
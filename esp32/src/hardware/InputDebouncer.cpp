@@ -0,0 +1,56 @@
+#include "InputDebouncer.h"
+
+InputDebouncer::InputDebouncer()
+	: count(0), all(0), stable(0), raw(0), window(0), lastStep(0) {
+	for (int i = 0; i < MAX_INPUTS; i++) {
+		windowMicros[i] = 0;
+		rawSince[i] = 0;
+		acceptedAt[i] = 0;
+	}
+}
+
+void InputDebouncer::begin(int inputs, const uint32_t* windows) {
+	count = inputs < MAX_INPUTS ? inputs : MAX_INPUTS;
+	all = (InputMask)((1u << count) - 1);
+	stable = 0;
+	raw = 0;
+	window = 0;
+	lastStep = 0;
+	for (int i = 0; i < count; i++) {
+		windowMicros[i] = windows[i];
+		rawSince[i] = 0;
+		acceptedAt[i] = 0;
+	}
+}
+
+InputMask InputDebouncer::step(InputMask sample, uint32_t timestamp) {
+	sample &= all;
+	
+	// An edge can be replayed after a later tick sample already saw it
+	if ((int32_t)(timestamp - lastStep) < 0) timestamp = lastStep;
+	lastStep = timestamp;
+	
+	// Note when each input last moved
+	for (InputMask moved = sample ^ raw; moved; moved &= moved - 1) {
+		rawSince[__builtin_ctz(moved)] = timestamp;
+	}
+	raw = sample;
+	
+	// Close the windows that have run out
+	for (InputMask open = window; open; open &= open - 1) {
+		int i = __builtin_ctz(open);
+		if (timestamp - acceptedAt[i] >= windowMicros[i]) {
+			window &= ~(InputMask)(1u << i);
+		}
+	}
+	
+	// Anything that differs and isn't held off changes now
+	InputMask accepted = (raw ^ stable) & ~window;
+	stable ^= accepted;
+	window |= accepted;
+	for (InputMask bits = accepted; bits; bits &= bits - 1) {
+		int i = __builtin_ctz(bits);
+		acceptedAt[i] = rawSince[i];
+	}
+	return accepted;
+}
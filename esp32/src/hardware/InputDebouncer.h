@@ -0,0 +1,43 @@
+#pragma once
+#include <stdint.h>
+
+// Bit i is input i; 1 = active (switch on, button pressed)
+typedef uint16_t InputMask;
+
+// ==============================================
+// Bitwise debounce over whole-port samples
+// ==============================================
+// Each step() takes every input at once, as sampled at a timestamp. A change
+// is accepted on its leading edge unless the input is still inside the
+// window opened by its last accepted change; a level that settles away from
+// the accepted state is taken once the window closes, stamped with the time
+// it last moved. Plain C++ with no Arduino dependency, so recorded sample
+// sequences can be replayed on the host.
+
+class InputDebouncer {
+public:
+	static const int MAX_INPUTS = 16;
+
+	InputDebouncer();
+
+	// Starts with every input released and no window open
+	void begin(int count, const uint32_t* windowMicros);
+
+	// Returns the inputs whose debounced state changed with this sample
+	InputMask step(InputMask sample, uint32_t timestamp);
+
+	InputMask state() const { return stable; }
+	InputMask pending() const { return (raw ^ stable); }     // Moved but not yet accepted
+	uint32_t changedAt(int input) const { return acceptedAt[input]; }
+
+private:
+	int count;
+	InputMask all;
+	InputMask stable;            // Accepted state
+	InputMask raw;               // Latest sample
+	InputMask window;            // Inputs inside a debounce window
+	uint32_t lastStep;
+	uint32_t windowMicros[MAX_INPUTS];
+	uint32_t rawSince[MAX_INPUTS];
+	uint32_t acceptedAt[MAX_INPUTS];
+};
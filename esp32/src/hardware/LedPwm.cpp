@@ -0,0 +1,115 @@
+#include "LedPwm.h"
+#ifdef ESP32
+#include <esp_timer.h>
+#endif
+
+// Static member definitions
+int LedPwm::ledCount = 0;
+bool LedPwm::active = false;
+std::atomic<uint8_t> LedPwm::frame(0);
+std::atomic<uint8_t> LedPwm::brightness(255);
+std::atomic<uint8_t> LedPwm::patterns[MAX_LEDS];
+std::atomic<uint16_t> LedPwm::periods[MAX_LEDS];
+
+bool LedPwm::begin(const int* pins, int count, uint8_t level) {
+#ifdef ESP32
+	ledCount = min(count, MAX_LEDS);
+	brightness = level;
+	for (int i = 0; i < ledCount; i++) {
+		patterns[i] = LED_PATTERN_STEADY;
+		periods[i] = 1000;
+		ledcSetup(i, PWM_FREQUENCY, PWM_BITS);
+		ledcAttachPin(pins[i], i);
+	}
+	
+	esp_timer_create_args_t args = {};
+	args.callback = onTimer;
+	args.name = "leds";
+	esp_timer_handle_t timer;
+	if (esp_timer_create(&args, &timer) != ESP_OK ||
+	    esp_timer_start_periodic(timer, TIMER_PERIOD_MS * 1000) != ESP_OK) {
+		Serial.println("LedPwm: Timer unavailable - patterns disabled");
+	}
+	
+	active = true;
+	setFrame(frame);
+	Serial.printf("LedPwm: %d LEDs on LEDC, brightness %d\n", ledCount, level);
+	return true;
+#else
+	(void)pins;
+	(void)count;
+	(void)level;
+	return false;
+#endif
+}
+
+bool LedPwm::isActive() {
+	return active;
+}
+
+void LedPwm::setFrame(uint8_t litMask) {
+	frame = litMask;
+	if (!active) return;
+	
+	uint32_t now = millis();
+	for (int i = 0; i < ledCount; i++) {
+		apply(i, now);
+	}
+}
+
+void LedPwm::setBrightness(uint8_t level) {
+	brightness = level;
+	setFrame(frame);
+}
+
+void LedPwm::setPattern(int ledIndex, LedPattern pattern, uint16_t periodMs) {
+	if (ledIndex < 0 || ledIndex >= MAX_LEDS) return;
+	periods[ledIndex] = max<uint16_t>(periodMs, TIMER_PERIOD_MS * 2);
+	patterns[ledIndex] = pattern;
+	if (active) apply(ledIndex, millis());
+}
+
+uint8_t LedPwm::dutyAt(LedPattern pattern, uint16_t periodMs, uint8_t level, uint32_t now) {
+	uint32_t phase = now % periodMs;
+	switch (pattern) {
+		case LED_PATTERN_BLINK:
+			return phase < periodMs / 2u ? level : 0;
+		
+		case LED_PATTERN_BREATHE: {
+			// Triangle wave, squared so the fade looks even to the eye
+			uint32_t half = periodMs / 2u;
+			uint32_t ramp = phase < half ? phase : periodMs - phase;
+			uint32_t wave = ramp * 255 / half;
+			return (uint8_t)(level * wave * wave / (255u * 255u));
+		}
+		
+		default:
+			return level;
+	}
+}
+
+void LedPwm::apply(int ledIndex, uint32_t now) {
+#ifdef ESP32
+	uint8_t duty = 0;
+	if (frame & (1u << ledIndex)) {
+		duty = dutyAt((LedPattern)patterns[ledIndex].load(), periods[ledIndex], brightness, now);
+	}
+	ledcWrite(ledIndex, duty);
+#else
+	(void)ledIndex;
+	(void)now;
+#endif
+}
+
+void LedPwm::onTimer(void* argument) {
+	(void)argument;
+	
+	// Only animated, lit LEDs change between frames
+	uint32_t now = millis();
+	uint8_t lit = frame;
+	for (int i = 0; i < ledCount; i++) {
+		if ((lit & (1u << i)) && patterns[i] != LED_PATTERN_STEADY) {
+			apply(i, now);
+		}
+	}
+}
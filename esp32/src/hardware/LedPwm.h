@@ -0,0 +1,48 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// ==============================================
+// LEDC PWM driver for the task LEDs
+// ==============================================
+// Each LED gets an LEDC channel, so lit LEDs can be dimmed and animated.
+// Steady changes are written straight away (press-to-LED latency matters).
+// Blink and breathe are stepped by a periodic esp_timer, so they keep time
+// however busy loop() is. Without LEDC (the host build) begin() fails and
+// GPIOManager drives the pins as plain outputs.
+
+enum LedPattern : uint8_t {
+	LED_PATTERN_STEADY = 0,
+	LED_PATTERN_BLINK,        // Full brightness half the period, off the other half
+	LED_PATTERN_BREATHE       // Smooth fade in and out over the period
+};
+
+class LedPwm {
+public:
+	static const int MAX_LEDS = 8;
+	static const uint32_t PWM_FREQUENCY = 5000;
+	static const uint8_t PWM_BITS = 8;
+	static const uint32_t TIMER_PERIOD_MS = 20;
+
+	static bool begin(const int* pins, int count, uint8_t brightness);
+	static bool isActive();
+
+	// Bit i lit = LED i on
+	static void setFrame(uint8_t litMask);
+	static void setBrightness(uint8_t level);
+	static void setPattern(int ledIndex, LedPattern pattern, uint16_t periodMs);
+
+	// Duty for a lit LED at time now
+	static uint8_t dutyAt(LedPattern pattern, uint16_t periodMs, uint8_t brightness, uint32_t now);
+
+private:
+	static void apply(int ledIndex, uint32_t now);
+	static void onTimer(void* argument);
+
+	static int ledCount;
+	static bool active;
+	static std::atomic<uint8_t> frame;
+	static std::atomic<uint8_t> brightness;
+	static std::atomic<uint8_t> patterns[MAX_LEDS];
+	static std::atomic<uint16_t> periods[MAX_LEDS];
+};
@@ -0,0 +1,195 @@
+#include "SpiBackends.h"
+#include "BusArbiter.h"
+
+// ==============================================
+// PanelSpiBackend
+// ==============================================
+
+PanelSpiBackend::PanelSpiBackend(St7789Panel** panels, int panelCount)
+	: panels(panels), panelCount(panelCount), currentMask(0), currentDisplay(-1), completedChunks(0) {
+}
+
+void PanelSpiBackend::release() {
+	if (currentDisplay >= 0) {
+		panels[currentDisplay]->endWrite();
+		currentMask = 0;
+		currentDisplay = -1;
+	}
+}
+
+void PanelSpiBackend::beginWindow(uint16_t displayMask, int16_t x, int16_t y, int16_t w, int16_t h) {
+	displayMask &= (1u << panelCount) - 1;
+	if (!displayMask) return;
+
+	if (displayMask != currentMask) {
+		release();
+		BusArbiter::selectMask(displayMask);
+		// The panels are alike, so any selected driver can frame the window
+		currentDisplay = __builtin_ctz(displayMask);
+		panels[currentDisplay]->startWrite();
+		currentMask = displayMask;
+	}
+	panels[currentDisplay]->setAddrWindow(x, y, w, h);
+}
+
+void PanelSpiBackend::writeChunk(const uint16_t* pixels, size_t count) {
+	if (currentDisplay >= 0) {
+		// Already big-endian, so the driver can send the bytes as they are
+		panels[currentDisplay]->writePixels((uint16_t*)pixels, count, true, true);
+	}
+	completedChunks++;
+}
+
+int PanelSpiBackend::poll() {
+	int completed = completedChunks;
+	completedChunks = 0;
+	return completed;
+}
+
+#ifdef ESP32
+#include <driver/gpio.h>
+#include <soc/spi_periph.h>
+
+// ==============================================
+// Esp32DmaSpiBackend
+// ==============================================
+
+// Transaction user flags
+static const uintptr_t USER_DC_DATA = 0x01;   // DC high (parameters and pixels)
+static const uintptr_t USER_CHUNK = 0x02;     // Pixel chunk owned by the queue
+
+static int dmaDcPin = -1;
+
+static void IRAM_ATTR dmaPreTransfer(spi_transaction_t* t) {
+	gpio_set_level((gpio_num_t)dmaDcPin, ((uintptr_t)t->user & USER_DC_DATA) ? 1 : 0);
+}
+
+Esp32DmaSpiBackend::Esp32DmaSpiBackend(St7789Panel** panels, int panelCount,
+                                       int sckPin, int mosiPin, int dcPin, uint32_t clockHz)
+	: panels(panels), panelCount(panelCount), sckPin(sckPin), mosiPin(mosiPin),
+	  dcPin(dcPin), clockHz(clockHz), device(nullptr), nextSlot(0), pending(0) {
+}
+
+bool Esp32DmaSpiBackend::begin() {
+	spi_bus_config_t bus = {};
+	bus.mosi_io_num = mosiPin;
+	bus.miso_io_num = -1;
+	bus.sclk_io_num = sckPin;
+	bus.quadwp_io_num = -1;
+	bus.quadhd_io_num = -1;
+	bus.max_transfer_sz = SpiTransferQueue::CHUNK_PIXELS * sizeof(uint16_t);
+	if (spi_bus_initialize(HSPI_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) {
+		Serial.println("SpiDma: HSPI bus init failed");
+		return false;
+	}
+
+	spi_device_interface_config_t dev = {};
+	dev.clock_speed_hz = clockHz;
+	dev.mode = 0;
+	dev.spics_io_num = -1;  // CS belongs to BusArbiter
+	dev.queue_size = TRANSACTION_DEPTH;
+	dev.pre_cb = dmaPreTransfer;
+	if (spi_bus_add_device(HSPI_HOST, &dev, &device) != ESP_OK) {
+		Serial.println("SpiDma: HSPI device add failed");
+		spi_bus_free(HSPI_HOST);
+		return false;
+	}
+	dmaDcPin = dcPin;
+
+	// Bus init routed SCK/MOSI to HSPI; the driver keeps them until there is work
+	routePins(VSPI_HOST);
+	Serial.printf("SpiDma: HSPI DMA ready at %u Hz\n", (unsigned)clockHz);
+	return true;
+}
+
+void Esp32DmaSpiBackend::routePins(spi_host_device_t host) {
+	pinMatrixOutAttach(sckPin, spi_periph_signal[host].spiclk_out, false, false);
+	pinMatrixOutAttach(mosiPin, spi_periph_signal[host].spid_out, false, false);
+}
+
+void Esp32DmaSpiBackend::acquire() {
+	routePins(HSPI_HOST);
+}
+
+void Esp32DmaSpiBackend::release() {
+	// Only window commands can still be outstanding here
+	spi_transaction_t* t;
+	while (pending > 0 && spi_device_get_trans_result(device, &t, portMAX_DELAY) == ESP_OK) {
+		pending--;
+	}
+	routePins(VSPI_HOST);
+}
+
+spi_transaction_t* Esp32DmaSpiBackend::nextTransaction() {
+	spi_transaction_t* t = &transactions[nextSlot];
+	nextSlot = (nextSlot + 1) % TRANSACTION_DEPTH;
+	memset(t, 0, sizeof(*t));
+	return t;
+}
+
+void Esp32DmaSpiBackend::queueCommand(uint8_t command) {
+	spi_transaction_t* t = nextTransaction();
+	t->flags = SPI_TRANS_USE_TXDATA;
+	t->length = 8;
+	t->tx_data[0] = command;
+	t->user = (void*)0;
+	spi_device_queue_trans(device, t, portMAX_DELAY);
+	pending++;
+}
+
+void Esp32DmaSpiBackend::queueData32(uint32_t value) {
+	spi_transaction_t* t = nextTransaction();
+	t->flags = SPI_TRANS_USE_TXDATA;
+	t->length = 32;
+	t->tx_data[0] = value >> 24;
+	t->tx_data[1] = value >> 16;
+	t->tx_data[2] = value >> 8;
+	t->tx_data[3] = value;
+	t->user = (void*)USER_DC_DATA;
+	spi_device_queue_trans(device, t, portMAX_DELAY);
+	pending++;
+}
+
+void Esp32DmaSpiBackend::beginWindow(uint16_t displayMask, int16_t x, int16_t y, int16_t w, int16_t h) {
+	displayMask &= (1u << panelCount) - 1;
+	if (!displayMask) return;
+
+	// The queue only changes displays with nothing in flight
+	BusArbiter::selectMask(displayMask);
+
+	// Same window encoding as Adafruit_ST77xx::setAddrWindow; the panels
+	// share their offsets, so the lowest selected one stands for all
+	St7789Panel* panel = panels[__builtin_ctz(displayMask)];
+	uint16_t x0 = x + panel->ramXOffset();
+	uint16_t y0 = y + panel->ramYOffset();
+	queueCommand(ST77XX_CASET);
+	queueData32(((uint32_t)x0 << 16) | (uint16_t)(x0 + w - 1));
+	queueCommand(ST77XX_RASET);
+	queueData32(((uint32_t)y0 << 16) | (uint16_t)(y0 + h - 1));
+	queueCommand(ST77XX_RAMWR);
+}
+
+void Esp32DmaSpiBackend::writeChunk(const uint16_t* pixels, size_t count) {
+	spi_transaction_t* t = nextTransaction();
+	t->length = count * 16;
+	t->tx_buffer = pixels;
+	t->user = (void*)(USER_DC_DATA | USER_CHUNK);
+	spi_device_queue_trans(device, t, portMAX_DELAY);
+	pending++;
+}
+
+bool Esp32DmaSpiBackend::canAccept() {
+	// A window is five transactions, plus the chunk itself
+	return pending + 6 <= TRANSACTION_DEPTH;
+}
+
+int Esp32DmaSpiBackend::poll() {
+	int chunks = 0;
+	spi_transaction_t* t;
+	while (pending > 0 && spi_device_get_trans_result(device, &t, 0) == ESP_OK) {
+		pending--;
+		if ((uintptr_t)t->user & USER_CHUNK) chunks++;
+	}
+	return chunks;
+}
+#endif
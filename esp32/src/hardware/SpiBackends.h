@@ -0,0 +1,85 @@
+#pragma once
+#include <Arduino.h>
+#include <Adafruit_ST7789.h>
+#include "SpiTransferQueue.h"
+
+// ==============================================
+// Transfer backends for SpiTransferQueue
+// ==============================================
+
+// ST7789 driver that exposes the panel's RAM offsets, so a backend that
+// bypasses the driver can address the same pixels the driver would
+class St7789Panel : public Adafruit_ST7789 {
+public:
+	St7789Panel(int8_t cs, int8_t dc, int8_t rst) : Adafruit_ST7789(cs, dc, rst) {}
+	int16_t ramXOffset() const { return _xstart; }
+	int16_t ramYOffset() const { return _ystart; }
+
+	// Takes on the driver state (size, rotation, offsets) of a panel whose
+	// init went out to this one too, under a shared chip-select. All panels
+	// are built alike - CS is BusArbiter's - so nothing panel-specific is lost.
+	void adoptInit(const St7789Panel& initialised) { *this = initialised; }
+};
+
+// Blocking fallback through the Adafruit driver. Used in the native env and
+// whenever the DMA backend can't start; chunks complete inside writeChunk().
+class PanelSpiBackend : public SpiTransferBackend {
+public:
+	PanelSpiBackend(St7789Panel** panels, int panelCount);
+
+	bool begin() override { return true; }
+	void acquire() override {}
+	void release() override;
+	void beginWindow(uint16_t displayMask, int16_t x, int16_t y, int16_t w, int16_t h) override;
+	void writeChunk(const uint16_t* pixels, size_t count) override;
+	bool canAccept() override { return true; }
+	int poll() override;
+
+private:
+	St7789Panel** panels;
+	int panelCount;
+	uint16_t currentMask;
+	int currentDisplay;      // Lowest display in currentMask; its driver sends the bytes
+	int completedChunks;
+};
+
+#ifdef ESP32
+#include <driver/spi_master.h>
+
+// Streams pixels with the HSPI peripheral's DMA engine. The Adafruit driver
+// owns VSPI on the same SCK/MOSI pins, so acquire()/release() move the pins
+// between the two peripherals through the GPIO matrix. Chip-select goes
+// through BusArbiter; DC is set from the transaction pre-callback.
+class Esp32DmaSpiBackend : public SpiTransferBackend {
+public:
+	static const int TRANSACTION_DEPTH = 32;
+
+	Esp32DmaSpiBackend(St7789Panel** panels, int panelCount,
+	                   int sckPin, int mosiPin, int dcPin, uint32_t clockHz);
+
+	bool begin() override;
+	void acquire() override;
+	void release() override;
+	void beginWindow(uint16_t displayMask, int16_t x, int16_t y, int16_t w, int16_t h) override;
+	void writeChunk(const uint16_t* pixels, size_t count) override;
+	bool canAccept() override;
+	int poll() override;
+
+private:
+	void queueCommand(uint8_t command);
+	void queueData32(uint32_t value);
+	spi_transaction_t* nextTransaction();
+	void routePins(spi_host_device_t host);
+
+	St7789Panel** panels;
+	int panelCount;
+	int sckPin;
+	int mosiPin;
+	int dcPin;
+	uint32_t clockHz;
+	spi_device_handle_t device;
+	spi_transaction_t transactions[TRANSACTION_DEPTH];
+	int nextSlot;
+	int pending;
+};
+#endif
@@ -0,0 +1,167 @@
+#include "SpiTransferQueue.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef ESP32
+#include <esp_heap_caps.h>
+#endif
+
+SpiTransferQueue::SpiTransferQueue()
+	: backend(nullptr), chunks(nullptr), storage(nullptr), chunkCount(0),
+	  oldestChunk(0), inFlightChunks(0), queuedChunks(0), activeMask(0),
+	  busAcquired(false), filling(false) {
+	resetStats();
+}
+
+SpiTransferQueue::~SpiTransferQueue() {
+	free(chunks);
+	free(storage);
+}
+
+bool SpiTransferQueue::begin(SpiTransferBackend* transferBackend, int count) {
+	if (!transferBackend || count < 1) return false;
+
+	size_t storageBytes = (size_t)count * CHUNK_PIXELS * sizeof(uint16_t);
+#ifdef ESP32
+	// DMA can't read PSRAM on the ESP32, so the bounce chunks live in internal RAM
+	storage = (uint16_t*)heap_caps_malloc(storageBytes, MALLOC_CAP_DMA);
+#else
+	storage = (uint16_t*)malloc(storageBytes);
+#endif
+	chunks = (Chunk*)calloc(count, sizeof(Chunk));
+	if (!storage || !chunks) {
+		free(storage);
+		free(chunks);
+		storage = nullptr;
+		chunks = nullptr;
+		return false;
+	}
+
+	for (int i = 0; i < count; i++) {
+		chunks[i].data = storage + (size_t)i * CHUNK_PIXELS;
+	}
+	chunkCount = count;
+	backend = transferBackend;
+	return true;
+}
+
+void SpiTransferQueue::resetStats() {
+	stats = {0, 0, 0, 0, 0, 0};
+}
+
+SpiTransferQueue::Chunk* SpiTransferQueue::claimChunk() {
+	if (inFlightChunks + queuedChunks >= chunkCount) {
+		stats.stalls++;
+		while (inFlightChunks + queuedChunks >= chunkCount) {
+			pump();
+		}
+	}
+	Chunk* chunk = &chunks[(oldestChunk + inFlightChunks + queuedChunks) % chunkCount];
+	chunk->count = 0;
+	chunk->startsWindow = false;
+	return chunk;
+}
+
+void SpiTransferQueue::publish() {
+	queuedChunks++;
+	// Start streaming as soon as there is something to send
+	pump();
+}
+
+void SpiTransferQueue::enqueue(uint16_t displayMask, int16_t x, int16_t y, int16_t w, int16_t h,
+                               const uint16_t* pixels, int16_t stride) {
+	if (!backend || !displayMask || w <= 0 || h <= 0) return;
+
+	filling = true;
+	Chunk* chunk = claimChunk();
+	chunk->startsWindow = true;
+	chunk->displayMask = displayMask;
+	chunk->x = x;
+	chunk->y = y;
+	chunk->w = w;
+	chunk->h = h;
+
+	for (int16_t row = 0; row < h; row++) {
+		const uint16_t* src = pixels + (size_t)row * stride;
+		int16_t remaining = w;
+		while (remaining > 0) {
+			if (chunk->count == CHUNK_PIXELS) {
+				publish();
+				chunk = claimChunk();
+			}
+			int16_t run = CHUNK_PIXELS - chunk->count;
+			if (run > remaining) run = remaining;
+
+			// The panel wants big-endian RGB565
+			uint16_t* dst = chunk->data + chunk->count;
+			for (int16_t i = 0; i < run; i++) {
+				dst[i] = (uint16_t)((src[i] << 8) | (src[i] >> 8));
+			}
+			chunk->count += run;
+			src += run;
+			remaining -= run;
+		}
+	}
+	filling = false;
+	publish();
+	stats.pixels += (uint32_t)w * h;
+}
+
+void SpiTransferQueue::retire() {
+	int completed = backend->poll();
+	if (completed > inFlightChunks) completed = inFlightChunks;
+	oldestChunk = (oldestChunk + completed) % chunkCount;
+	inFlightChunks -= completed;
+}
+
+void SpiTransferQueue::pump() {
+	if (!backend) return;
+
+	// A blocking backend completes chunks inside writeChunk(), so keep going
+	// while each pass makes progress
+	bool progressed = true;
+	while (progressed) {
+		progressed = false;
+		retire();
+
+		while (queuedChunks > 0 && backend->canAccept()) {
+			Chunk& chunk = chunks[(oldestChunk + inFlightChunks) % chunkCount];
+
+			if (chunk.startsWindow) {
+				// Chip-select can't move while bytes for the previous display are on the wire
+				if (chunk.displayMask != activeMask && inFlightChunks > 0) break;
+
+				if (!busAcquired) {
+					backend->acquire();
+					busAcquired = true;
+				}
+				if (chunk.displayMask != activeMask) {
+					if (activeMask) stats.displaySwitches++;
+					activeMask = chunk.displayMask;
+				}
+				backend->beginWindow(chunk.displayMask, chunk.x, chunk.y, chunk.w, chunk.h);
+				stats.windows++;
+				if (chunk.displayMask & (chunk.displayMask - 1)) stats.broadcastWindows++;
+			}
+
+			backend->writeChunk(chunk.data, chunk.count);
+			stats.chunks++;
+			queuedChunks--;
+			inFlightChunks++;
+			progressed = true;
+		}
+	}
+
+	// Give the bus back to the blocking driver whenever the queue runs dry,
+	// but not between the chunks of a window that is still being filled
+	if (busAcquired && isIdle() && !filling) {
+		backend->release();
+		busAcquired = false;
+		activeMask = 0;
+	}
+}
+
+void SpiTransferQueue::drain() {
+	while (!isIdle()) {
+		pump();
+	}
+}
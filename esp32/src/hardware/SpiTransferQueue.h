@@ -0,0 +1,95 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// ==============================================
+// Asynchronous pixel transfer queue for the shared display bus
+// ==============================================
+// Plain C++ so the queue logic also runs in the native env. Rectangles are
+// byte-swapped into a ring of small bounce chunks at enqueue time, so the
+// source (the shared canvas) can be reused straight away. pump() hands
+// chunks to the backend as it can take them; the backend may stream them
+// with DMA while the CPU gets on with polling buttons and composing the
+// next display. Chip-select only changes once the bus has gone idle.
+// Windows are addressed to a display mask (bit n = display n); with more than
+// one bit set, the pixels go out once to all of those displays together.
+
+// Moves bytes for the queue. Implementations: PanelSpiBackend (blocking,
+// through the Adafruit driver) and Esp32DmaSpiBackend (HSPI DMA).
+class SpiTransferBackend {
+public:
+	virtual ~SpiTransferBackend() {}
+
+	virtual bool begin() = 0;
+	virtual void acquire() = 0;     // Take the bus from the blocking driver
+	virtual void release() = 0;     // Deselect and hand the bus back; nothing in flight
+
+	// Select the displays in displayMask (only called with nothing in flight
+	// when it changes) and queue CASET/RASET/RAMWR for the window
+	virtual void beginWindow(uint16_t displayMask, int16_t x, int16_t y, int16_t w, int16_t h) = 0;
+
+	// Queue big-endian RGB565 pixels; the buffer stays untouched until poll()
+	// has reported it complete
+	virtual void writeChunk(const uint16_t* pixels, size_t count) = 0;
+
+	virtual bool canAccept() = 0;   // Room for a window plus one chunk
+	virtual int poll() = 0;         // Chunks completed since the last call, in order
+};
+
+struct SpiQueueStats {
+	uint32_t windows;        // Address windows sent
+	uint32_t chunks;         // Chunks handed to the backend
+	uint32_t pixels;         // Pixels enqueued
+	uint32_t displaySwitches;// Chip-select changes between windows
+	uint32_t broadcastWindows;// Windows sent to more than one display
+	uint32_t stalls;         // Enqueues that had to wait for a free chunk
+};
+
+class SpiTransferQueue {
+public:
+	static const int CHUNK_PIXELS = 512;   // 1 KB per chunk
+	static const int MAX_CHUNKS = 24;
+
+	SpiTransferQueue();
+	~SpiTransferQueue();
+
+	bool begin(SpiTransferBackend* backend, int chunkCount = MAX_CHUNKS);
+	bool isReady() const { return backend != nullptr; }
+
+	// Copy a rectangle of native-endian RGB565 (stride in pixels) into the
+	// queue. Only blocks while every chunk is queued or in flight.
+	void enqueue(uint16_t displayMask, int16_t x, int16_t y, int16_t w, int16_t h,
+	             const uint16_t* pixels, int16_t stride);
+
+	void pump();             // Feed the backend; call every loop
+	void drain();            // Block until everything is out, then release the bus
+	bool isIdle() const { return queuedChunks == 0 && inFlightChunks == 0; }
+
+	SpiQueueStats getStats() const { return stats; }
+	void resetStats();
+
+private:
+	struct Chunk {
+		uint16_t* data;
+		uint16_t count;
+		bool startsWindow;
+		uint16_t displayMask;
+		int16_t x, y, w, h;
+	};
+
+	Chunk* claimChunk();     // Next free chunk, pumping until one frees up
+	void publish();
+	void retire();           // Recycle chunks the backend has finished with
+
+	SpiTransferBackend* backend;
+	Chunk* chunks;
+	uint16_t* storage;
+	int chunkCount;
+	int oldestChunk;         // First in-flight chunk
+	int inFlightChunks;
+	int queuedChunks;        // Filled but not yet handed to the backend
+	uint16_t activeMask;     // Displays selected for the open window; 0 = none
+	bool busAcquired;
+	bool filling;          // enqueue() in progress - the open window needs the bus
+	SpiQueueStats stats;
+};
@@ -1,98 +1,310 @@
 #include <Arduino.h>
 #include "hardware/GPIOManager.h"
 #include "core/NavigationManager.h"
+#include "core/BootTrace.h"
 #include "core/DemoManager.h"
+#include "core/FrameScheduler.h"
+#include "core/Metrics.h"
+#include "core/TaskManager.h"
+#include "network/APIServer.h"
+#include "network/HAClient.h"
+#include "network/MQTTClient.h"
 #include "ui/DisplayManager.h"
+#include "ui/RenderTask.h"
 #include "config/Config.h"
+#include "utils/ConfigLoader.h"
+#include "utils/Log.h"
 
 // Main application state
 bool isDemoMode = false;
 unsigned long demoModeActivationStart = 0;
 bool bothButtonsPressed = false;
+int demoActivationShown = -1;          // Percent last sent to the displays
 
 // Demo mode activation constants
 #define DEMO_ACTIVATION_TIME_MS 5000  // 5 seconds to activate demo mode
 #define BOTH_BUTTONS_HELD_CHECK_MS 100  // Check every 100ms if both buttons still held
 
+// Frame scheduling: one tick per period, jobs share the budget
+#define FRAME_TICK_US 10000
+#define FRAME_BUDGET_US 8000
+
+// Forward declarations
+void checkDemoModeActivation();
+void enterDemoMode();
+void exitDemoMode();
+void handleTaskButton(int buttonIndex, bool buttonState, uint32_t edgeMicros);
+void handleDisplayUpdates();
+void updateRowDisplay(int rowIndex);
+void displaySystemInfo();
+void inputJob();
+void navigationJob();
+void logicJob();
+void renderJob();
+void logJob();
+void consoleJob();
+void networkJob();
+void apiJob();
+void handleCommand(const char* command);
+void printTasks();
+void printMQTT();
+void printAPI();
+
 void setup() {
+	// Each stage is timed up to its mark; "boot" on the console shows them
+	BootTrace::begin();
 	Serial.begin(SERIAL_SPEED);
 	Serial.println("ChoreTracker Starting...");
+	Metrics::initialize();
+	BootTrace::mark("serial");
+	
+	// Settings from NVS, before anything that uses them
+	ConfigLoader::initialize();
+	BootTrace::mark("config");
 	
 	// Initialize hardware GPIO
 	GPIOManager::initialize();
+	BootTrace::mark("gpio");
 	
 	// Initialize navigation system
 	NavigationManager::initialize();
+	BootTrace::mark("navigation");
 	
-	// Initialize display system
+	// Initialize display system; marks "panels" and "splash" itself
 	DisplayManager::initialize();
 	
 	// Initialize demo system
 	DemoManager::initialize();
+	BootTrace::mark("demo");
+	
+	// Task engine; tasks arrive from Home Assistant
+	TaskManager::initialize();
+	HAClient::initialize();
+	HAClient::startSyncTask();
+	MQTTClient::initialize();
+	MQTTClient::startConnectTask();
+	APIServer::initialize();
+	BootTrace::mark("network");
 	
 	// Set custom column titles
 	NavigationManager::setColumnTitle(0, "Emma");
 	NavigationManager::setColumnTitle(1, "Jack");
 	NavigationManager::setColumnTitle(2, "Weather");
 	NavigationManager::setColumnTitle(3, "Family");
+	Log::flush();
+	BootTrace::mark("log");
+	
+	// Input first and always; rendering always gets at least one step
+	FrameScheduler::initialize(FRAME_TICK_US, FRAME_BUDGET_US);
+	FrameScheduler::addJob("input", PRIORITY_INPUT, inputJob, true);
+	FrameScheduler::addJob("navigation", PRIORITY_NAVIGATION, navigationJob, false);
+	FrameScheduler::addJob("logic", PRIORITY_LOGIC, logicJob, false);
+	
+	// With a core to itself, rendering leaves the tick entirely
+	bool renderThreaded = false;
+#if DUAL_CORE_RENDERING
+	renderThreaded = RenderTask::start(RENDER_CORE);
+#endif
+	if (!renderThreaded) {
+		FrameScheduler::addJob("render", PRIORITY_RENDER, renderJob, true);
+	}
+	
+	// Log output only ever gets what is left of the tick
+	if (!Log::startDrainTask()) {
+		FrameScheduler::addJob("log", PRIORITY_BACKGROUND, logJob, false);
+	}
+	FrameScheduler::addJob("console", PRIORITY_BACKGROUND, consoleJob, false);
+	FrameScheduler::addJob("api", PRIORITY_BACKGROUND, apiJob, false);
+	FrameScheduler::addJob("network", PRIORITY_BACKGROUND, networkJob, false);
 	
 	Serial.println("System ready! Press both row select buttons for 5 seconds to enter demo mode.");
 	displaySystemInfo();
+	BootTrace::finish();
 }
 
 void loop() {
-	// Update hardware states
-	GPIOManager::updateTaskButtonStates();
-	GPIOManager::updateRowSelectStates();
+	FrameScheduler::tick();
+}
+
+void inputJob() {
+	// Debounce captured edges; task LEDs follow their switches from here
+	GPIOManager::processInput();
 	
+	ButtonEvent event;
+	while (GPIOManager::pollEvent(event)) {
+		if (event.input < TOTAL_TASK_BUTTONS) {
+			if (isDemoMode) {
+				// Any task button press exits demo mode
+				exitDemoMode();
+			} else {
+				handleTaskButton(event.input, event.active, event.timestamp);
+			}
+		} else if (event.active && !isDemoMode) {
+			NavigationManager::handleRowSelect(event.input - GPIOManager::ROW_SELECT_INPUT);
+		}
+	}
+}
+
+void navigationJob() {
+	if (!isDemoMode) {
+		NavigationManager::update();
+	}
+}
+
+void logicJob() {
 	// Check for demo mode activation
 	checkDemoModeActivation();
 	
+	// Task starts and ends due by now
+	TaskManager::update();
+	TaskEvent event;
+	while (TaskManager::pollEvent(event)) {
+		const ChoreTask* task = TaskManager::getTask(event.slot);
+		LOG_INFO(MODULE_SYSTEM, "Task %s: %s -> %s\n", task ? task->id : "?",
+		         TaskManager::stateName(event.from), TaskManager::stateName(event.to));
+	}
+	
 	if (isDemoMode) {
 		// Run demo mode
 		DemoManager::update();
-		
-		// Check for demo mode exit (any task button press)
-		for (int i = 0; i < 8; i++) {
-			if (GPIOManager::hasTaskButtonChanged(i)) {
-				exitDemoMode();
-				break;
-			}
-		}
-	} else {
-		// Normal operation mode
-		NavigationManager::update();
-		handleTaskButtons();
+	} else if (!RenderTask::isAnimating()) {
+		// Row content waits for a running transition to finish
 		handleDisplayUpdates();
 	}
-	
+}
+
+void renderJob() {
 	// Update displays
-	DisplayManager::update();
+	RenderTask::run();
+}
+
+void logJob() {
+	// Whatever does not fit in the tick waits in the ring
+	while (FrameScheduler::hasBudget() && Log::drain(1) > 0) {}
+}
+
+void consoleJob() {
+	// Line-based serial commands
+	static char line[32];
+	static int length = 0;
 	
-	delay(10);
+	while (Serial.available() > 0) {
+		char c = Serial.read();
+		if (c == '\r') continue;
+		if (c != '\n') {
+			if (length < (int)sizeof(line) - 1) line[length++] = c;
+			continue;
+		}
+		line[length] = '\0';
+		length = 0;
+		handleCommand(line);
+	}
+}
+
+void networkJob() {
+	// Events both ways over MQTT; while the broker is out of reach, task
+	// sync falls back to polling Home Assistant once a minute. A sync asked
+	// for over the API goes to HA either way, as do polls until HA has set
+	// the clock.
+	MQTTClient::update();
+	HAClient::update(!MQTTClient::isConnected());
+}
+
+void apiJob() {
+	// Local HTTP API; answers only what has fully arrived
+	APIServer::update();
+}
+
+void handleCommand(const char* command) {
+	if (strcmp(command, "metrics") == 0) {
+		Metrics::printReport(Serial);
+		FrameScheduler::printStats();
+	} else if (strcmp(command, "metrics json") == 0) {
+		Metrics::writeJson(Serial);
+	} else if (strcmp(command, "metrics reset") == 0) {
+		Metrics::reset();
+		FrameScheduler::resetStats();
+		Serial.println("Metrics reset");
+	} else if (strcmp(command, "tasks") == 0) {
+		printTasks();
+	} else if (strcmp(command, "tasks json") == 0) {
+		TaskFeed::writeTasks(Serial, false);
+	} else if (strcmp(command, "mqtt") == 0) {
+		printMQTT();
+	} else if (strcmp(command, "api") == 0) {
+		printAPI();
+	} else if (strcmp(command, "config") == 0) {
+		ConfigLoader::printConfiguration();
+	} else if (strcmp(command, "config reset") == 0) {
+		ConfigLoader::resetToDefaults();
+		Serial.println("Config reset to defaults; restart to apply everywhere");
+	} else if (strcmp(command, "boot") == 0) {
+		BootTrace::printReport(Serial);
+	} else if (*command) {
+		Serial.printf("Unknown command \"%s\" - try: metrics, metrics json, metrics reset, tasks, tasks json, mqtt, api, config, config reset, boot\n", command);
+	}
+}
+
+void printTasks() {
+	HASyncStats sync = HAClient::getStats();
+	Serial.printf("%d tasks, change sequence %lu\n", TaskManager::getTaskCount(),
+	              (unsigned long)TaskManager::getSequence());
+	for (int i = 0; i < TaskManager::MAX_TASKS; i++) {
+		const ChoreTask* task = TaskManager::getTask(i);
+		if (!task) continue;
+		Serial.printf("  %-16s %-12s switch %d  %s\n", task->id, TaskManager::stateName(task->state),
+		              task->switchId + 1, task->title);
+	}
+	Serial.printf("HA sync: %lu requests, %lu full, %lu delta, %lu unchanged, %lu failed\n",
+	              (unsigned long)sync.requests, (unsigned long)sync.fulls, (unsigned long)sync.deltas,
+	              (unsigned long)sync.unchanged, (unsigned long)sync.failures);
+}
+
+void printMQTT() {
+	MQTTStats mqtt = MQTTClient::getStats();
+	Serial.printf("MQTT %s: %lu connects, %lu failed, %d queued\n",
+	              MQTTClient::isConnected() ? "connected" : "offline", (unsigned long)mqtt.connects,
+	              (unsigned long)mqtt.failures, MQTTClient::getQueued());
+	Serial.printf("  %lu published, %lu acknowledged, %lu dropped, %lu received\n",
+	              (unsigned long)mqtt.published, (unsigned long)mqtt.acknowledged,
+	              (unsigned long)mqtt.dropped, (unsigned long)mqtt.received);
+	Serial.printf("  completion latency %lu us last, %lu us max\n",
+	              (unsigned long)mqtt.lastLatencyMicros, (unsigned long)mqtt.maxLatencyMicros);
+}
+
+void printAPI() {
+	APIServerStats api = APIServer::getStats();
+	Serial.printf("API %s: %lu connections, %lu requests, %lu errors, %lu timed out, %u open at most\n",
+	              APIServer::isListening() ? "listening" : "off", (unsigned long)api.connections,
+	              (unsigned long)api.requests, (unsigned long)api.errors, (unsigned long)api.timeouts, api.maxOpen);
 }
 
 void checkDemoModeActivation() {
 	// Check if both row select buttons are being held
-	bool row0Pressed = digitalRead(17) == LOW;  // GPIO 17 (Row 0 select)
-	bool row1Pressed = digitalRead(22) == LOW;  // GPIO 22 (Row 1 select)
+	bool row0Pressed = GPIOManager::isRowSelectHeld(0);  // GPIO 17 (Row 0 select)
+	bool row1Pressed = GPIOManager::isRowSelectHeld(1);  // GPIO 22 (Row 1 select)
 	
 	if (row0Pressed && row1Pressed) {
 		if (!bothButtonsPressed) {
 			// Just started holding both buttons
 			bothButtonsPressed = true;
 			demoModeActivationStart = millis();
-			Serial.println("Demo activation: Holding both buttons...");
+			LOG_INFO(MODULE_SYSTEM, "Demo activation: Holding both buttons...\n");
 			
 			// Show progress on displays
-			DisplayManager::showDemoActivationProgress(0);
+			demoActivationShown = 0;
+			RenderTask::showDemoActivationProgress(0);
 		} else {
 			// Continue holding both buttons - show progress
 			unsigned long elapsed = millis() - demoModeActivationStart;
 			int progress = (elapsed * 100) / DEMO_ACTIVATION_TIME_MS;
 			progress = min(progress, 100);
 			
-			DisplayManager::showDemoActivationProgress(progress);
+			// The loop runs far more often than the percentage moves
+			if (progress != demoActivationShown) {
+				demoActivationShown = progress;
+				RenderTask::showDemoActivationProgress(progress);
+			}
 			
 			if (elapsed >= DEMO_ACTIVATION_TIME_MS) {
 				// Activate demo mode!
@@ -103,14 +315,14 @@ void checkDemoModeActivation() {
 		if (bothButtonsPressed) {
 			// Released buttons before demo activation
 			bothButtonsPressed = false;
-			Serial.println("Demo activation cancelled - buttons released");
-			DisplayManager::clearDemoActivationProgress();
+			LOG_INFO(MODULE_SYSTEM, "Demo activation cancelled - buttons released\n");
+			RenderTask::clearDemoActivationProgress();
 		}
 	}
 }
 
 void enterDemoMode() {
-	Serial.println("🎮 ENTERING DEMO MODE! 🎮");
+	LOG_INFO(MODULE_SYSTEM, "🎮 ENTERING DEMO MODE! 🎮\n");
 	isDemoMode = true;
 	bothButtonsPressed = false;
 	
@@ -118,23 +330,23 @@ void enterDemoMode() {
 	DemoManager::startDemo();
 	
 	// Show demo mode activation animation
-	DisplayManager::showDemoModeActivation();
+	RenderTask::showDemoModeActivation();
 	
 	// Turn off all task LEDs initially
 	GPIOManager::setAllTasksComplete();
 	
-	Serial.println("Demo mode active! Press any task button to exit.");
+	LOG_INFO(MODULE_SYSTEM, "Demo mode active! Press any task button to exit.\n");
 }
 
 void exitDemoMode() {
-	Serial.println("Exiting demo mode - returning to normal operation");
+	LOG_INFO(MODULE_SYSTEM, "Exiting demo mode - returning to normal operation\n");
 	isDemoMode = false;
 	
 	// Stop demo
 	DemoManager::stopDemo();
 	
 	// Reset displays to normal content
-	DisplayManager::showExitingDemoMode();
+	RenderTask::showExitingDemoMode();
 	
 	// Reset LEDs to normal state
 	GPIOManager::setAllTasksIncomplete();
@@ -145,17 +357,20 @@ void exitDemoMode() {
 	}
 }
 
-void handleTaskButtons() {
-	// Handle task button changes in normal mode
-	for (int i = 0; i < 8; i++) {
-		if (GPIOManager::hasTaskButtonChanged(i)) {
-			bool buttonState = GPIOManager::getTaskButtonState(i);
-			Serial.printf("Task Button %d changed to: %s\n", i, buttonState ? "ACTIVE" : "INACTIVE");
-			
-			// Update display content based on task completion
-			DisplayManager::updateTaskDisplay(i, buttonState);
+void handleTaskButton(int buttonIndex, bool buttonState, uint32_t edgeMicros) {
+	// Handle a task button change in normal mode
+	LOG_INFO(MODULE_SYSTEM, "Task Button %d changed to: %s\n", buttonIndex, buttonState ? "ACTIVE" : "INACTIVE");
+	
+	// Switching on completes the display's active task, if it has one
+	if (buttonState) {
+		int slot = TaskManager::handleSwitch(buttonIndex);
+		if (slot >= 0) {
+			MQTTClient::publishCompletion(*TaskManager::getTask(slot), edgeMicros);
 		}
 	}
+	
+	// Update display content based on task completion
+	RenderTask::updateTaskDisplay(buttonIndex, buttonState);
 }
 
 void handleDisplayUpdates() {
@@ -164,11 +379,14 @@ void handleDisplayUpdates() {
 		if (NavigationManager::needsDisplayUpdate(row)) {
 			updateRowDisplay(row);
 			NavigationManager::clearUpdateFlag(row);
+			// A held activation goes back over the row on the next tick
+			demoActivationShown = -1;
 		}
 	}
 }
 
 void updateRowDisplay(int rowIndex) {
+	METRIC_SCOPE(METRIC_ROW_DISPLAY);
 	int currentColumn = NavigationManager::getCurrentColumn(rowIndex);
 	
 	if (NavigationManager::shouldShowColumnTitle(rowIndex)) {
@@ -176,22 +394,22 @@ void updateRowDisplay(int rowIndex) {
 		String title = NavigationManager::getColumnTitle(currentColumn);
 		int titleDisplay = (rowIndex == 0) ? 0 : 4;
 		
-		Serial.printf("ROW %d DISPLAY %d: Showing title \"%s\"\n", 
+		LOG_INFO(MODULE_SYSTEM, "ROW %d DISPLAY %d: Showing title \"%s\"\n", 
 		              rowIndex + 1, titleDisplay, title.c_str());
 		
-		DisplayManager::showColumnTitle(titleDisplay, title, currentColumn);
+		RenderTask::showColumnTitle(titleDisplay, title, currentColumn);
 		
 	} else if (NavigationManager::shouldShowContent(rowIndex)) {
 		// Show content for the current column across all displays in the row
 		String columnTitle = NavigationManager::getColumnTitle(currentColumn);
 		
-		Serial.printf("ROW %d: Showing content for \"%s\" column\n", 
+		LOG_INFO(MODULE_SYSTEM, "ROW %d: Showing content for \"%s\" column\n", 
 		              rowIndex + 1, columnTitle.c_str());
 		
 		// Update all 4 displays in this row
 		for (int col = 0; col < 4; col++) {
 			int displayIndex = NavigationManager::getDisplayIndexForRowColumn(rowIndex, col);
-			DisplayManager::showTaskContent(displayIndex, currentColumn, col);
+			RenderTask::showTaskContent(displayIndex, currentColumn, col);
 		}
 	}
 }
@@ -210,5 +428,6 @@ void displaySystemInfo() {
 	Serial.println("Task Buttons: [0:GPIO13+LED15] [1:GPIO12+LED2] [2:GPIO14+LED0] [3:GPIO27+LED4]");
 	Serial.println("              [4:GPIO26+LED5]  [5:GPIO33+LED25] [6:GPIO35+LED32] [7:GPIO34+LED21]");
 	Serial.println("Demo Mode: Hold BOTH row select buttons (GPIO17 + GPIO22) for 5 seconds");
+	Serial.println("Serial commands: metrics, metrics json, metrics reset, tasks, tasks json, mqtt, api, config, config reset, boot");
 	Serial.println();
 } 
\ No newline at end of file
@@ -0,0 +1,471 @@
+#include "APIServer.h"
+#include <ArduinoJson.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include "HAClient.h"
+#include "MQTTClient.h"
+#include "../config/Config.h"
+#include "../core/FrameScheduler.h"
+#include "../core/Metrics.h"
+#include "../core/TaskManager.h"
+#include "../utils/ConfigLoader.h"
+#include "../utils/Log.h"
+
+// Static member definitions
+APIServer::Connection APIServer::connections[MAX_CONNECTIONS];
+bool APIServer::listening = false;
+bool APIServer::restartPending = false;
+uint32_t APIServer::lastListenAttempt = 0;
+APIServerStats APIServer::stats = {};
+
+static WiFiServer server(API_PORT, APIServer::BACKLOG);
+
+static const char* const SYNC_MODE_HEADER = "X-ChoreTracker-Sync";
+
+static_assert(APIServer::OUTPUT_SIZE >= TaskFeed::MAX_ELEMENT_JSON, "a task must fit the output buffer");
+
+// Response output: gathered in the connection's output buffer, so a JSON
+// body printed field by field is not sent as dozens of tiny packets, and
+// sent from there by flushOutput()
+class APIServer::ResponseWriter : public Print {
+public:
+	explicit ResponseWriter(Connection& connection) : connection(connection) {}
+
+	size_t write(uint8_t c) override {
+		if (connection.outputLength == OUTPUT_SIZE) flushOutput(connection);
+		// Only a socket that has stopped taking anything leaves no room; the
+		// task list, the one response that could fill both, waits for room
+		if (connection.outputLength == OUTPUT_SIZE) return 0;
+		connection.output[connection.outputLength++] = c;
+		return 1;
+	}
+
+	size_t write(const uint8_t* data, size_t size) override {
+		size_t written = 0;
+		while (written < size && write(data[written])) written++;
+		return written;
+	}
+
+private:
+	Connection& connection;
+};
+
+static const char* reason(int status) {
+	switch (status) {
+	case 200: return "OK";
+	case 202: return "Accepted";
+	case 304: return "Not Modified";
+	case 400: return "Bad Request";
+	case 404: return "Not Found";
+	case 405: return "Method Not Allowed";
+	case 409: return "Conflict";
+	case 413: return "Payload Too Large";
+	case 431: return "Request Header Fields Too Large";
+	case 500: return "Internal Server Error";
+	default: return "";
+	}
+}
+
+// Status line and the headers every response has; the caller adds its own
+// and ends them with endHead()
+static void writeHead(Print& out, int status) {
+	out.printf("HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nCache-Control: no-store\r\n"
+	           "Connection: close\r\n", status, reason(status));
+}
+
+static void endHead(Print& out) {
+	out.print("\r\n");
+}
+
+static int writeError(Print& out, int status, const char* message) {
+	writeHead(out, status);
+	endHead(out);
+	out.printf("{\"error\":\"%s\"}\n", message);
+	return status;
+}
+
+static bool startsWithIgnoreCase(const char* text, const char* prefix) {
+	for (; *prefix; text++, prefix++) {
+		if (tolower((uint8_t)*text) != tolower((uint8_t)*prefix)) return false;
+	}
+	return true;
+}
+
+void APIServer::initialize() {
+	for (int i = 0; i < MAX_CONNECTIONS; i++) connections[i].open = false;
+	listening = false;
+	restartPending = false;
+	lastListenAttempt = millis() - LISTEN_RETRY_MS;
+}
+
+void APIServer::update() {
+	if (!API_ENABLED) return;
+	METRIC_SCOPE(METRIC_API_UPDATE);
+	if (!listening) {
+		if (WiFi.status() != WL_CONNECTED || millis() - lastListenAttempt < LISTEN_RETRY_MS) return;
+		lastListenAttempt = millis();
+		server.begin();
+		if (!server) {
+			LOG_WARN(MODULE_NET, "APIServer: Cannot listen on port %d\n", API_PORT);
+			return;
+		}
+		server.setNoDelay(true);
+		listening = true;
+		LOG_INFO(MODULE_NET, "APIServer: Listening on port %d\n", API_PORT);
+	}
+
+	// At least one pass per tick; more while requests are being answered and
+	// the tick has time, since each answer frees a slot for the backlog
+	int answered = 0;
+	for (bool more = true; more && answered < MAX_ANSWERS; ) {
+		more = false;
+		accept();
+		for (int i = 0; i < MAX_CONNECTIONS; i++) {
+			Connection& connection = connections[i];
+			if (!connection.open) continue;
+			if (connection.answered) {
+				transmit(connection);
+				continue;
+			}
+			receive(connection);
+			if (!connection.open) continue;
+
+			if (connection.headerLength && connection.length >= connection.headerLength + connection.contentLength) {
+				respond(connection);
+				answered++;
+				more = true;
+			} else if (millis() - connection.opened > REQUEST_TIMEOUT_MS || !connection.client.connected()) {
+				stats.timeouts++;
+				close(connection);
+			}
+		}
+		if (!FrameScheduler::hasBudget()) break;
+	}
+
+	// Once the answer to it has gone
+	bool sending = false;
+	for (int i = 0; i < MAX_CONNECTIONS; i++) sending = sending || (connections[i].open && connections[i].answered);
+	if (restartPending && !sending) {
+		LOG_WARN(MODULE_SYSTEM, "APIServer: Restart requested\n");
+		Log::flush();
+#ifdef ESP32
+		ESP.restart();
+#endif
+		restartPending = false;
+	}
+}
+
+bool APIServer::isListening() {
+	return listening;
+}
+
+APIServerStats APIServer::getStats() {
+	return stats;
+}
+
+void APIServer::accept() {
+	int open = 0;
+	for (int i = 0; i < MAX_CONNECTIONS; i++) {
+		Connection& connection = connections[i];
+		if (!connection.open) {
+			connection.client = server.available();
+			if (!connection.client) continue;
+			connection.open = true;
+			connection.answered = false;
+			connection.listing = false;
+			connection.outputLength = 0;
+			connection.length = 0;
+			connection.headerLength = 0;
+			connection.contentLength = 0;
+			connection.opened = millis();
+			stats.connections++;
+		}
+		open++;
+	}
+	if (open > stats.maxOpen) stats.maxOpen = open;
+}
+
+void APIServer::receive(Connection& connection) {
+	// Only what has already arrived; never waits for more
+	if (connection.headerLength && connection.length >= connection.headerLength + connection.contentLength) return;
+	int waiting = connection.client.available();
+	if (waiting <= 0) return;
+
+	size_t space = REQUEST_SIZE - connection.length;
+	size_t wanted = (size_t)waiting < space ? waiting : space;
+	int received = wanted ? connection.client.read((uint8_t*)connection.request + connection.length, wanted) : 0;
+	if (received > 0) {
+		connection.length += received;
+		connection.request[connection.length] = '\0';
+	}
+
+	int error = connection.headerLength ? 0 : parseHead(connection);
+	if (!error && !connection.headerLength && connection.length == REQUEST_SIZE) error = 431;
+	if (error) {
+		stats.errors++;
+		ResponseWriter out(connection);
+		writeError(out, error, reason(error));
+		connection.answered = true;
+		connection.lastSent = millis();
+		transmit(connection);
+	}
+}
+
+int APIServer::parseHead(Connection& connection) {
+	// Waits for the blank line; the rest of the head is read by respond()
+	char* end = strstr(connection.request, "\r\n\r\n");
+	if (!end) return 0;
+	connection.headerLength = end + 4 - connection.request;
+
+	for (char* line = strstr(connection.request, "\r\n"); line && line < end; line = strstr(line + 2, "\r\n")) {
+		if (startsWithIgnoreCase(line + 2, "Content-Length:")) {
+			long length = strtol(line + 2 + 15, nullptr, 10);
+			if (length < 0) return 400;
+			if (length > (long)(REQUEST_SIZE - connection.headerLength)) return 413;
+			connection.contentLength = length;
+		}
+	}
+	return 0;
+}
+
+void APIServer::respond(Connection& connection) {
+	stats.requests++;
+	ResponseWriter out(connection);
+	connection.answered = true;
+	connection.lastSent = millis();
+
+	// Split the head in place: "METHOD /path?query HTTP/1.1\r\nName: value\r\n..."
+	char* head = connection.request;
+	head[connection.headerLength - 2] = '\0';
+	Request request = {};
+	request.body = head + connection.headerLength;
+	request.bodyLength = connection.contentLength;
+	head[connection.headerLength + connection.contentLength] = '\0';
+
+	char* lineEnd = strstr(head, "\r\n");
+	if (lineEnd) *lineEnd = '\0';
+	char* path = strchr(head, ' ');
+	char* version = path ? strchr(path + 1, ' ') : nullptr;
+	if (!version) {
+		stats.errors++;
+		writeError(out, 400, "bad request line");
+		transmit(connection);
+		return;
+	}
+	*path++ = '\0';
+	*version = '\0';
+	char* query = strchr(path, '?');
+	if (query) *query = '\0';
+	request.method = head;
+	request.path = path;
+
+	for (char* line = lineEnd; line; ) {
+		char* name = line + 2;
+		line = strstr(name, "\r\n");
+		if (line) *line = '\0';
+		if (startsWithIgnoreCase(name, "If-None-Match:")) {
+			const char* value = name + 14;
+			while (*value == ' ') value++;
+			request.ifNoneMatch = value;
+		}
+	}
+
+	int status = route(connection, request, out);
+	if (status >= 400) stats.errors++;
+	transmit(connection);
+}
+
+int APIServer::route(Connection& connection, const Request& request, Print& out) {
+	const char* path = request.path;
+	bool get = strcmp(request.method, "GET") == 0;
+	bool post = strcmp(request.method, "POST") == 0;
+	bool put = strcmp(request.method, "PUT") == 0;
+
+	if (strcmp(path, "/api/status") == 0) {
+		if (get) return getStatus(out);
+	} else if (strcmp(path, "/api/tasks") == 0) {
+		if (get) return getTasks(connection, request, out);
+		if (post) {
+			// Only asks: the sync runs from the network job, and what it
+			// brings shows on GET /api/tasks
+			HAClient::requestSync();
+			writeHead(out, 202);
+			endHead(out);
+			out.print("{\"sync\":\"requested\"}\n");
+			return 202;
+		}
+	} else if (strncmp(path, "/api/tasks/", 11) == 0) {
+		// /api/tasks/{taskId}/complete
+		char id[sizeof(ChoreTask::id)];
+		const char* suffix = strchr(path + 11, '/');
+		size_t length = suffix ? suffix - (path + 11) : 0;
+		if (!suffix || strcmp(suffix, "/complete") != 0 || length == 0 || length >= sizeof(id)) {
+			return writeError(out, 404, "not found");
+		}
+		memcpy(id, path + 11, length);
+		id[length] = '\0';
+		if (post) return completeTask(id, out);
+	} else if (strcmp(path, "/api/config") == 0) {
+		if (get) return getConfig(out);
+		if (put) return putConfig(request, out);
+	} else if (strcmp(path, "/api/metrics") == 0) {
+		if (get) {
+			writeHead(out, 200);
+			endHead(out);
+			Metrics::writeJson(out);
+			return 200;
+		}
+	} else if (strcmp(path, "/api/restart") == 0) {
+		if (post) {
+			restartPending = true;
+			writeHead(out, 200);
+			endHead(out);
+			out.print("{\"restarting\":true}\n");
+			return 200;
+		}
+	} else {
+		return writeError(out, 404, "not found");
+	}
+	return writeError(out, 405, "method not allowed");
+}
+
+void APIServer::transmit(Connection& connection) {
+	// The task list is written an element at a time, whenever the output
+	// has room for one
+	ResponseWriter out(connection);
+	for (;;) {
+		if (!flushOutput(connection)) {
+			close(connection);
+			return;
+		}
+		if (!connection.listing || OUTPUT_SIZE - connection.outputLength < TaskFeed::MAX_ELEMENT_JSON) break;
+		connection.listing = TaskFeed::writeNextTask(out, connection.tasks);
+	}
+
+	if (!connection.listing && !connection.outputLength) {
+		close(connection);
+	} else if (millis() - connection.lastSent > REQUEST_TIMEOUT_MS) {
+		stats.timeouts++;
+		close(connection);
+	}
+}
+
+bool APIServer::flushOutput(Connection& connection) {
+	// Only what the socket takes now; WiFiClient::write() would wait for room
+	size_t sent = 0;
+	while (sent < connection.outputLength) {
+		ssize_t taken = ::send(connection.client.fd(), connection.output + sent, connection.outputLength - sent,
+		                       MSG_DONTWAIT | MSG_NOSIGNAL);
+		if (taken < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+		if (taken <= 0) return false;
+		sent += taken;
+		connection.lastSent = millis();
+	}
+	memmove(connection.output, connection.output + sent, connection.outputLength - sent);
+	connection.outputLength -= sent;
+	return true;
+}
+
+void APIServer::close(Connection& connection) {
+	connection.client.stop();
+	connection.open = false;
+}
+
+int APIServer::getStatus(Print& out) {
+	writeHead(out, 200);
+	endHead(out);
+
+	// Tasks are current as of the last sync, or the last 304 from HA; null
+	// for never, or while there is no clock to say when
+	uint32_t synced = TaskFeed::getLastSyncTime();
+	uint32_t confirmed = HAClient::getLastSyncTime();
+	if (confirmed && (!synced || (int32_t)(confirmed - synced) > 0)) synced = confirmed;
+	uint32_t freeHeap = 0;
+#ifdef ESP32
+	freeHeap = ESP.getFreeHeap();
+#endif
+	out.printf("{\"device_id\":\"%s\",\"uptime\":%lu,\"wifi_strength\":%d,\"memory_free\":%lu,\"last_update\":",
+	           CONFIG_DEVICE_NAME(), (unsigned long)(millis() / 1000), (int)WiFi.RSSI(), (unsigned long)freeHeap);
+	if (synced && TaskManager::hasTime()) {
+		char time[24];
+		TaskFeed::formatDateTime(time, sizeof(time), TaskManager::now() - (millis() - synced) / 1000);
+		out.printf("\"%s\"", time);
+	} else {
+		out.print("null");
+	}
+	out.print(",\"version\":\"" FIRMWARE_VERSION "\"}\n");
+	return 200;
+}
+
+int APIServer::getTasks(Connection& connection, const Request& request, Print& out) {
+	// With a tag the device gave out, only what changed since, or nothing
+	uint32_t since = 0;
+	bool delta = request.ifNoneMatch && TaskFeed::parseTag(request.ifNoneMatch, since);
+	char tag[HAClient::TAG_SIZE];
+	TaskFeed::formatTag(tag, sizeof(tag));
+
+	if (delta && since == TaskManager::getSequence()) {
+		writeHead(out, 304);
+		out.printf("ETag: %s\r\n", tag);
+		endHead(out);
+		return 304;
+	}
+	writeHead(out, 200);
+	out.printf("ETag: %s\r\n%s: %s\r\n", tag, SYNC_MODE_HEADER, delta ? "delta" : "full");
+	endHead(out);
+	TaskFeed::beginTasks(connection.tasks, delta, since);
+	connection.listing = true;
+	return 200;
+}
+
+int APIServer::completeTask(const char* id, Print& out) {
+	int slot = TaskManager::findTask(id);
+	if (slot < 0) return writeError(out, 404, "no such task");
+	if (!TaskManager::completeTask(id)) return writeError(out, 409, "task cannot be completed now");
+
+	// Reported to HA the same way as a switch
+	const ChoreTask* task = TaskManager::getTask(slot);
+	MQTTClient::publishCompletion(*task, micros());
+	writeHead(out, 200);
+	endHead(out);
+	out.print("{\"id\":");
+	TaskFeed::writeString(out, task->id);
+	out.printf(",\"state\":\"%s\"}\n", TaskManager::stateName(task->state));
+	return 200;
+}
+
+int APIServer::getConfig(Print& out) {
+	writeHead(out, 200);
+	endHead(out);
+	out.printf("{\"device_name\":\"%s\",\"update_interval\":%lu,\"audio_enabled\":%s}\n", CONFIG_DEVICE_NAME(),
+	           (unsigned long)HAClient::getUpdateInterval(), CONFIG_AUDIO_ENABLED() ? "true" : "false");
+	return 200;
+}
+
+int APIServer::putConfig(const Request& request, Print& out) {
+	// DeviceConfig; fields the device does not have are accepted and ignored.
+	// What is applied is kept in NVS.
+	StaticJsonDocument<MQTTClient::MAX_CONFIG> config;
+	if (deserializeJson(config, request.body) || config.isNull()) {
+		return writeError(out, 400, "expected a DeviceConfig object");
+	}
+	JsonObjectConst settings = config.as<JsonObjectConst>();
+	long interval = settings["update_interval"] | 0L;
+	if (!settings["update_interval"].isNull() && interval < MIN_UPDATE_INTERVAL_MS) {
+		char message[48];
+		snprintf(message, sizeof(message), "update_interval must be at least %d ms", MIN_UPDATE_INTERVAL_MS);
+		return writeError(out, 400, message);
+	}
+	const char* name = settings["device_name"] | (const char*)nullptr;
+	if (!settings["device_name"].isNull() && (!name || !*name || !ConfigLoader::setDeviceName(name))) {
+		return writeError(out, 400, "device_name must be 1 to 31 characters, without quotes or backslashes");
+	}
+	if (!settings["audio_enabled"].isNull()) {
+		ConfigLoader::setAudioEnabled(settings["audio_enabled"] | CONFIG_AUDIO_ENABLED());
+	}
+	if (interval > 0 && HAClient::setUpdateInterval(interval)) {
+		LOG_INFO(MODULE_NET, "APIServer: Task poll interval now %ld ms\n", interval);
+	}
+	ConfigLoader::saveConfiguration();
+	return getConfig(out);
+}
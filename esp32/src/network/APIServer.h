@@ -0,0 +1,108 @@
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+#include "TaskFeed.h"
+
+// ==============================================
+// Local HTTP API
+// ==============================================
+// Serves the device side of shared/api/choretracker_api.yaml on API_PORT:
+//   GET  /api/status                  DeviceStatus
+//   GET  /api/tasks                   task list; ETag, If-None-Match, deltas
+//   POST /api/tasks                   sync with Home Assistant soon (202)
+//   POST /api/tasks/{id}/complete     as if its switch had been turned on
+//   GET  /api/config, PUT /api/config DeviceConfig
+//   GET  /api/metrics                 Metrics::writeJson
+//   POST /api/restart
+//
+// update() never waits on a client. Each call accepts what is waiting,
+// reads whatever bytes have arrived into a fixed buffer per connection, and
+// answers each request whose headers (and body) are complete, for as long
+// as the tick has budget. A slow or silent client just holds its slot
+// until REQUEST_TIMEOUT_MS; connections beyond MAX_CONNECTIONS wait in the
+// listen backlog, up to BACKLOG.
+//
+// Responses go out the same way: written into OUTPUT_SIZE bytes per
+// connection, and from there only as much as the socket takes without
+// waiting, with "Connection: close" ending the body. Most are a few hundred
+// bytes and go in one piece. The task list can be 10 KB or more, past the
+// socket's send buffer, so it is written one task at a time as room frees
+// up, over as many ticks as the client takes to read it. A client that
+// stops reading is closed after REQUEST_TIMEOUT_MS without progress.
+// Changes made while a list is going out are in the next delta after its
+// ETag, whether the list caught them or not.
+
+struct APIServerStats {
+	uint32_t connections;
+	uint32_t requests;
+	uint32_t errors;          // Answered 4xx or 5xx
+	uint32_t timeouts;        // Closed before the request came, or the answer went
+	uint16_t maxOpen;         // Most connections open at once
+};
+
+class APIServer {
+public:
+	static const int MAX_CONNECTIONS = 4;
+	static const int BACKLOG = 8;             // Waiting to be accepted
+	static const int MAX_ANSWERS = 8;         // Per update(), budget allowing
+	static const size_t REQUEST_SIZE = 1024;  // Request line, headers and body
+	static const size_t OUTPUT_SIZE = 1024;   // Response not yet taken by the socket
+	static const uint32_t REQUEST_TIMEOUT_MS = 3000;
+	static const uint32_t LISTEN_RETRY_MS = 10000;
+
+	static void initialize();
+
+	// Call every tick; starts listening once WiFi is up
+	static void update();
+
+	static bool isListening();
+	static APIServerStats getStats();
+
+private:
+	struct Connection {
+		WiFiClient client;
+		bool open;
+		bool answered;            // Response under way; transmit() sends the rest
+		bool listing;             // Task list still being written
+		uint16_t length;          // Bytes in request
+		uint16_t headerLength;    // Up to the blank line; 0 until it has arrived
+		uint16_t contentLength;
+		uint16_t outputLength;    // Bytes in output, from the start
+		uint32_t opened;          // millis()
+		uint32_t lastSent;        // millis() the socket last took something
+		TaskListCursor tasks;
+		char request[REQUEST_SIZE + 1];
+		uint8_t output[OUTPUT_SIZE];
+	};
+
+	class ResponseWriter;
+
+	struct Request {
+		const char* method;
+		const char* path;
+		const char* ifNoneMatch;  // nullptr when absent
+		const char* body;         // Null-terminated
+		uint16_t bodyLength;
+	};
+
+	static void accept();
+	static void receive(Connection& connection);
+	static int parseHead(Connection& connection);     // 0, or an error status
+	static void respond(Connection& connection);
+	static int route(Connection& connection, const Request& request, Print& out);
+	static void transmit(Connection& connection);
+	static bool flushOutput(Connection& connection);  // False once the connection has failed
+	static void close(Connection& connection);
+
+	static int getStatus(Print& out);
+	static int getTasks(Connection& connection, const Request& request, Print& out);
+	static int completeTask(const char* id, Print& out);
+	static int getConfig(Print& out);
+	static int putConfig(const Request& request, Print& out);
+
+	static Connection connections[MAX_CONNECTIONS];
+	static bool listening;
+	static bool restartPending;
+	static uint32_t lastListenAttempt;
+	static APIServerStats stats;
+};
@@ -0,0 +1,240 @@
+#include "HAClient.h"
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include "../config/Config.h"
+#include "../core/TaskManager.h"
+#include "../utils/ConfigLoader.h"
+#include "../utils/Log.h"
+
+// Static member definitions
+TaskFeedResult HAClient::lastResult = {};
+uint32_t HAClient::lastSyncTime = 0;
+uint32_t HAClient::lastAttemptTime = 0;
+bool HAClient::attempted = false;
+bool HAClient::syncRequested = false;
+bool HAClient::syncing = false;
+bool HAClient::running = false;
+uint32_t HAClient::updateInterval = UPDATE_INTERVAL_MS;
+char HAClient::syncTag[TAG_SIZE] = "";
+HASyncStats HAClient::stats = {};
+TaskFeedApplier HAClient::applier;
+SpscQueue<HAClient::SyncEntry, HAClient::QUEUE_DEPTH> HAClient::entries;
+HAClient::SyncResponse HAClient::response = {};
+char HAClient::requestTag[TAG_SIZE] = "";
+
+static const char* const SYNC_MODE_HEADER = "X-ChoreTracker-Sync";
+static const char* RESPONSE_HEADERS[] = {"ETag", SYNC_MODE_HEADER, "Date"};
+
+// Sync task: HTTPClient and TLS want the room
+static const uint32_t SYNC_STACK_BYTES = 8192;
+static const int SYNC_TASK_PRIORITY = 1;
+
+// The sync side's own, apart from the one TaskFeed::sync() uses for MQTT
+static StaticJsonDocument<TaskFeed::ELEMENT_CAPACITY> syncElement;
+
+#ifdef ESP32
+static TaskHandle_t syncTask = nullptr;
+#endif
+
+void HAClient::initialize() {
+	WiFi.mode(WIFI_STA);
+	updateInterval = CONFIG_UPDATE_INTERVAL();
+	WiFi.setHostname(CONFIG_DEVICE_NAME());
+	WiFi.begin(CONFIG_WIFI_SSID(), CONFIG_WIFI_PASSWORD());
+	LOG_INFO(MODULE_NET, "HAClient: Joining %s\n", CONFIG_WIFI_SSID());
+#ifdef ESP32
+	// Runs in the background once WiFi is up
+	configTime(0, 0, NTP_SERVER);
+#endif
+}
+
+bool HAClient::startSyncTask() {
+#ifdef ESP32
+	if (running) return true;
+	if (xTaskCreate(taskMain, "ha-sync", SYNC_STACK_BYTES, nullptr, SYNC_TASK_PRIORITY, &syncTask) == pdPASS) {
+		running = true;
+		return true;
+	}
+	Serial.println("HAClient: Could not create sync task - syncing inline");
+#endif
+	return false;
+}
+
+void HAClient::taskMain(void* parameter) {
+	(void)parameter;
+#ifdef ESP32
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		request();
+	}
+#endif
+}
+
+void HAClient::update(bool poll) {
+#ifdef ESP32
+	// time() stays near 1970 until SNTP has answered
+	if (!TaskManager::hasTime() && time(nullptr) > 1600000000) setClock(time(nullptr));
+#endif
+	// What the sync task has read so far
+	SyncEntry entry;
+	for (int i = 0; i < APPLY_BATCH && entries.pop(entry); i++) apply(entry);
+
+	if (syncing || !isConnected()) return;
+	bool due = !attempted || millis() - lastAttemptTime >= updateInterval;
+	if (syncRequested || (due && (poll || !TaskManager::hasTime()))) startSync();
+}
+
+void HAClient::requestSync() {
+	syncRequested = true;
+}
+
+bool HAClient::isSyncing() {
+	return syncing;
+}
+
+void HAClient::startSync() {
+	syncRequested = false;
+	attempted = true;
+	lastAttemptTime = millis();
+	syncing = true;
+
+	// With the tag of the last list we applied, HA answers with what has
+	// changed since, or 304 for nothing
+	memcpy(requestTag, syncTag, TAG_SIZE);
+#ifdef ESP32
+	if (running) {
+		xTaskNotifyGive(syncTask);
+		return;
+	}
+#endif
+	request();
+}
+
+void HAClient::request() {
+	HTTPClient http;
+	// HTTP/1.0 keeps the body free of chunk headers, so it can be parsed
+	// straight off the socket
+	http.useHTTP10(true);
+	http.setTimeout(HA_HTTP_TIMEOUT_MS);
+	if (!http.begin(String(CONFIG_HA_SERVER()) + HA_TASKS_PATH)) {
+		LOG_WARN(MODULE_NET, "HAClient: Bad server URL\n");
+		response.status = 0;
+		deliver({SYNC_END, {}});
+		return;
+	}
+	http.addHeader("Authorization", String("Bearer ") + CONFIG_HA_TOKEN());
+	http.collectHeaders(RESPONSE_HEADERS, 3);
+	if (requestTag[0]) http.addHeader("If-None-Match", requestTag);
+
+	response.status = http.GET();
+	response.date = TaskFeed::parseHttpDate(http.header("Date").c_str());
+	response.delta = requestTag[0] && http.header(SYNC_MODE_HEADER) == "delta";
+	// A tag too long to keep just means a full list next time
+	String tag = http.header("ETag");
+	size_t length = tag.length() < TAG_SIZE ? tag.length() : 0;
+	memcpy(response.tag, tag.c_str(), length);
+	response.tag[length] = '\0';
+	response.read = {};
+	deliver({SYNC_HEADERS, {}});
+
+	if (response.status == HTTP_CODE_OK) {
+		TaskFeedReader reader(http.getStream(), syncElement);
+		SyncEntry entry = {SYNC_ELEMENT, {}};
+		while (reader.next(entry.element)) deliver(entry);
+		response.read = reader.result();
+	}
+	http.end();
+	deliver({SYNC_END, {}});
+}
+
+void HAClient::deliver(const SyncEntry& entry) {
+	if (!running) {
+		apply(entry);
+		return;
+	}
+	// The control side takes APPLY_BATCH a tick
+	while (!entries.push(entry)) delay(1);
+}
+
+void HAClient::apply(const SyncEntry& entry) {
+	switch (entry.type) {
+	case SYNC_HEADERS:
+		stats.requests++;
+		// The clock first, so the list is applied against it
+		if (response.status > 0) setClock(response.date);
+		if (response.status == HTTP_CODE_OK) applier.begin(!response.delta);
+		break;
+	case SYNC_ELEMENT:
+		applier.apply(entry.element);
+		break;
+	case SYNC_END:
+		finish();
+		syncing = false;
+		break;
+	}
+}
+
+void HAClient::finish() {
+	if (response.status == HTTP_CODE_NOT_MODIFIED) {
+		stats.unchanged++;
+		lastSyncTime = millis();
+		return;
+	}
+	if (response.status != HTTP_CODE_OK) {
+		if (response.status) {
+			LOG_WARN(MODULE_NET, "HAClient: Task request failed (%d)\n", response.status);
+			stats.failures++;
+		}
+		return;
+	}
+
+	lastResult = applier.finish(response.read);
+	if (!lastResult.complete) {
+		// Start again from a full list
+		syncTag[0] = '\0';
+		stats.failures++;
+		return;
+	}
+	memcpy(syncTag, response.tag, TAG_SIZE);
+	if (response.delta) {
+		stats.deltas++;
+	} else {
+		stats.fulls++;
+	}
+	lastSyncTime = millis();
+}
+
+void HAClient::setClock(uint32_t unixSeconds) {
+	if (!unixSeconds) return;
+	int32_t drift = (int32_t)(unixSeconds - TaskManager::now());
+	if (TaskManager::hasTime() && drift >= -CLOCK_SLACK_S && drift <= CLOCK_SLACK_S) return;
+	TaskManager::setTime(unixSeconds);
+}
+
+bool HAClient::isConnected() {
+	return WiFi.status() == WL_CONNECTED;
+}
+
+const TaskFeedResult& HAClient::getLastResult() {
+	return lastResult;
+}
+
+uint32_t HAClient::getLastSyncTime() {
+	return lastSyncTime;
+}
+
+HASyncStats HAClient::getStats() {
+	return stats;
+}
+
+uint32_t HAClient::getUpdateInterval() {
+	return updateInterval;
+}
+
+bool HAClient::setUpdateInterval(uint32_t ms) {
+	// Kept across restarts; NVS is only written when it changes
+	if (!ConfigLoader::setUpdateInterval(ms)) return false;
+	updateInterval = ms;
+	ConfigLoader::saveConfiguration();
+	return true;
+}
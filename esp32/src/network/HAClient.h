@@ -0,0 +1,115 @@
+#pragma once
+#include <Arduino.h>
+#include "TaskFeed.h"
+#include "../utils/SpscQueue.h"
+
+// ==============================================
+// Home Assistant client
+// ==============================================
+// Joins WiFi and pulls the task list from HA every update_interval, as kept
+// by ConfigLoader (set from config/update over MQTT or PUT /api/config).
+// The response body goes straight through TaskFeed into TaskManager, so a
+// sync needs no more RAM for a long list than for a short one.
+//
+// The request, and the reading of the response, run on a FreeRTOS task of
+// their own once startSyncTask() has succeeded, so a slow or silent HA never
+// holds up the tick. The sync task hands each element it reads to the
+// control side through a queue, and update() applies up to APPLY_BATCH of
+// them per call; the rest of the body waits in the socket meanwhile. Until
+// then (and always on the host build) a sync runs inline in update(),
+// blocking for as long as the request takes.
+//
+// After the first full list, each request carries that list's ETag in
+// If-None-Match. HA answers 304 when nothing has changed, or only the
+// changes since that tag, marked "X-ChoreTracker-Sync: delta". Anything
+// else is a full list. A sync that fails part way drops the tag, so the
+// next one starts from a full list again. On NativeSim this runs against
+// tools/ha_standin.py (SIM_NET_HOST).
+//
+// It also keeps the task clock, which timed tasks wait for: from SNTP on
+// the ESP32, and from the Date header of every HA response, before the
+// list in it is applied. HA's clock is the one the task times come from,
+// so it wins when the two differ by more than CLOCK_SLACK_S.
+
+struct HASyncStats {
+	uint32_t requests;
+	uint32_t fulls;
+	uint32_t deltas;
+	uint32_t unchanged;       // 304
+	uint32_t failures;
+};
+
+class HAClient {
+public:
+	static const size_t TAG_SIZE = 40;
+	static const size_t QUEUE_DEPTH = 8;
+	static const int APPLY_BATCH = 4;
+
+	static void initialize();
+
+	// False (and syncs stay inline) when threading is unavailable
+	static bool startSyncTask();
+
+	// Call every tick; applies what the sync task has read, and starts a
+	// sync when WiFi is up and one is due. With poll false only a requested
+	// sync is due, or one to set the clock.
+	static void update(bool poll = true);
+
+	// Syncs on the next update(), whether one is due or not
+	static void requestSync();
+	static bool isSyncing();
+
+	static bool isConnected();
+	static const TaskFeedResult& getLastResult();
+	static uint32_t getLastSyncTime();     // millis(), 0 = never
+	static HASyncStats getStats();
+	static uint32_t getUpdateInterval();
+	static bool setUpdateInterval(uint32_t ms);   // False below MIN_UPDATE_INTERVAL_MS
+
+private:
+	enum SyncEntryType : uint8_t {
+		SYNC_HEADERS,           // response holds the status and headers
+		SYNC_ELEMENT,
+		SYNC_END                // response.read holds how reading went
+	};
+
+	struct SyncEntry {
+		SyncEntryType type;
+		TaskFeedEntry element;
+	};
+
+	// Written by the sync side before it queues the entry that says so, and
+	// read by the control side after taking that entry
+	struct SyncResponse {
+		int status;             // HTTP status, negative for no answer, 0 for no request
+		bool delta;
+		uint32_t date;          // Unix seconds, 0 = none
+		char tag[TAG_SIZE];     // "" = none, or too long to keep
+		TaskFeedResult read;
+	};
+
+	static void startSync();
+	static void request();                         // Sync side
+	static void deliver(const SyncEntry& entry);   // Sync side: to apply()
+	static void apply(const SyncEntry& entry);     // Control side
+	static void finish();
+	static void setClock(uint32_t unixSeconds);
+	static void taskMain(void* parameter);
+
+	static uint32_t updateInterval;
+	static TaskFeedResult lastResult;
+	static uint32_t lastSyncTime;
+	static uint32_t lastAttemptTime;
+	static bool attempted;
+	static bool syncRequested;
+	static bool syncing;                   // Started, and its SYNC_END not yet applied
+	static bool running;                   // Sync task started
+	static char syncTag[TAG_SIZE];         // ETag of the tasks applied; "" = none
+	static HASyncStats stats;
+	static TaskFeedApplier applier;
+
+	// Between the two sides
+	static SpscQueue<SyncEntry, QUEUE_DEPTH> entries;
+	static SyncResponse response;
+	static char requestTag[TAG_SIZE];      // For If-None-Match; set before the sync starts
+};
@@ -0,0 +1,528 @@
+#include "MQTTClient.h"
+#include <WiFi.h>
+#include <ArduinoJson.h>
+#include <atomic>
+#include "HAClient.h"
+#include "TaskFeed.h"
+#include "../config/Config.h"
+#include "../utils/ConfigLoader.h"
+#include "../utils/Log.h"
+
+// Static member definitions
+MQTTClient::Message MQTTClient::queue[QUEUE_DEPTH];
+int MQTTClient::queueHead = 0;
+int MQTTClient::queueCount = 0;
+MQTTClient::State MQTTClient::state = STATE_OFFLINE;
+uint16_t MQTTClient::nextPacketId = 1;
+uint8_t MQTTClient::backoffLevel = 0;
+uint32_t MQTTClient::nextAttempt = 0;
+uint32_t MQTTClient::connectStarted = 0;
+uint32_t MQTTClient::lastSent = 0;
+uint32_t MQTTClient::lastReceived = 0;
+bool MQTTClient::running = false;
+MQTTStats MQTTClient::stats = {};
+
+// Only the connect task touches client while the state is STATE_OPENING,
+// and only the control side otherwise; opened hands it back
+static WiFiClient client;
+
+enum OpenResult : uint8_t { OPEN_WAITING, OPEN_DONE, OPEN_FAILED };
+static std::atomic<uint8_t> opened(OPEN_WAITING);
+
+static const uint32_t CONNECT_STACK_BYTES = 4096;
+static const int CONNECT_TASK_PRIORITY = 1;
+
+#ifdef ESP32
+static TaskHandle_t connectTask = nullptr;
+#endif
+
+// Control packet types (high nibble of the first byte)
+static const uint8_t PACKET_CONNECT = 0x10;
+static const uint8_t PACKET_CONNACK = 0x20;
+static const uint8_t PACKET_PUBLISH = 0x30;
+static const uint8_t PACKET_PUBACK = 0x40;
+static const uint8_t PACKET_SUBSCRIBE = 0x82;     // Reserved flags 0010
+static const uint8_t PACKET_SUBACK = 0x90;
+static const uint8_t PACKET_PINGREQ = 0xC0;
+static const uint8_t PACKET_PINGRESP = 0xD0;
+static const uint8_t PUBLISH_DUP = 0x08;
+static const uint8_t PUBLISH_RETAIN = 0x01;
+
+static const char TOPIC_ONLINE[] = MQTT_TOPIC_PREFIX "/status/online";
+static const char* const TOPIC_COMPLETED = MQTT_TOPIC_PREFIX "/task/completed/";
+static const char* const TOPIC_TASKS = MQTT_TOPIC_PREFIX "/tasks";
+static const char* const TOPIC_CONFIG = MQTT_TOPIC_PREFIX "/config/update";
+
+// CONNECT body: protocol name, level, flags and keepalive, then the client
+// id (the device name), the will and the credentials, each length-prefixed.
+// Sized from Config.h, so no setting can overrun it.
+static const char WILL_PAYLOAD[] = "offline";
+static const size_t CONNECT_BODY = (2 + 4) + 4 + (2 + CONFIG_NAME_SIZE - 1) + (2 + sizeof(TOPIC_ONLINE) - 1) +
+                                   (2 + sizeof(WILL_PAYLOAD) - 1) + (2 + sizeof(MQTT_USERNAME) - 1) +
+                                   (2 + sizeof(MQTT_PASSWORD) - 1);
+static_assert(CONNECT_BODY <= 1024, "MQTT_USERNAME or MQTT_PASSWORD too long for the CONNECT packet");
+
+// Packets read per update(), so a flood cannot hold up the tick
+static const int READ_BATCH = 4;
+
+// One incoming packet's payload as a Stream, so a task list can be parsed
+// straight off the socket without reading past the packet
+class PacketStream : public Stream {
+public:
+	PacketStream(Stream& source, uint32_t length) : source(source), remaining(length) {}
+
+	int available() override {
+		int waiting = source.available();
+		return (uint32_t)waiting < remaining ? waiting : remaining;
+	}
+
+	int read() override {
+		if (remaining == 0) return -1;
+		int c = source.read();
+		if (c >= 0) remaining--;
+		return c;
+	}
+
+	int peek() override { return remaining ? source.peek() : -1; }
+	size_t write(uint8_t c) override { (void)c; return 0; }
+	uint32_t left() const { return remaining; }
+
+private:
+	Stream& source;
+	uint32_t remaining;
+};
+
+// Appends a length-prefixed string; returns the new end
+static uint8_t* putString(uint8_t* out, const char* text) {
+	size_t length = strlen(text);
+	*out++ = length >> 8;
+	*out++ = length & 0xFF;
+	memcpy(out, text, length);
+	return out + length;
+}
+
+void MQTTClient::initialize() {
+	for (int i = 0; i < QUEUE_DEPTH; i++) queue[i].queued = false;
+	queueHead = 0;
+	queueCount = 0;
+	state = STATE_OFFLINE;
+	backoffLevel = 0;
+	nextAttempt = millis();
+}
+
+void MQTTClient::update() {
+	if (!MQTT_ENABLED) return;
+
+	if (state == STATE_OFFLINE) {
+		if (WiFi.status() == WL_CONNECTED && (int32_t)(millis() - nextAttempt) >= 0) connect();
+		if (state != STATE_OPENING) return;
+	}
+	if (state == STATE_OPENING) {
+		uint8_t result = opened.load(std::memory_order_acquire);
+		if (result == OPEN_WAITING) return;
+		if (result == OPEN_FAILED) {
+			LOG_WARN(MODULE_NET, "MQTT: Cannot reach %s:%d\n", MQTT_SERVER, MQTT_PORT);
+			disconnect(true);
+			return;
+		}
+		sendConnect();
+		return;
+	}
+	if (!client.connected()) {
+		LOG_WARN(MODULE_NET, "MQTT: Connection lost\n");
+		disconnect(true);
+		return;
+	}
+
+	readPackets();
+	if (state == STATE_CONNECTING && millis() - connectStarted > CONNECT_TIMEOUT_MS) {
+		LOG_WARN(MODULE_NET, "MQTT: No CONNACK\n");
+		disconnect(true);
+	}
+	if (state != STATE_CONNECTED) return;
+
+	sendQueued();
+
+	// Keepalive: ping at half the interval; a broker silent for one and a
+	// half intervals is gone
+	uint32_t now = millis();
+	if (now - lastSent >= MQTT_KEEPALIVE_S * 500UL) sendPacket(PACKET_PINGREQ, nullptr, 0);
+	if (now - lastReceived > MQTT_KEEPALIVE_S * 1500UL) {
+		LOG_WARN(MODULE_NET, "MQTT: Broker stopped answering\n");
+		disconnect(true);
+	}
+}
+
+bool MQTTClient::isConnected() {
+	return state == STATE_CONNECTED;
+}
+
+bool MQTTClient::publish(const char* topic, const char* payload, uint8_t qos, bool retain, uint32_t edgeMicros) {
+	compact();
+	if (queueCount == QUEUE_DEPTH) {
+		// Make room from the oldest QoS 0 message not yet written
+		for (int i = 0; i < QUEUE_DEPTH; i++) {
+			Message& message = queue[(queueHead + i) % QUEUE_DEPTH];
+			if (message.queued && message.qos == 0 && !message.sent) {
+				message.queued = false;
+				stats.dropped++;
+				break;
+			}
+		}
+		compact();
+	}
+	if (queueCount == QUEUE_DEPTH || strlen(topic) >= MAX_TOPIC || strlen(payload) >= MAX_PAYLOAD) {
+		stats.dropped++;
+		LOG_WARN(MODULE_NET, "MQTT: Dropped message for %s\n", topic);
+		return false;
+	}
+
+	Message& message = queue[(queueHead + queueCount) % QUEUE_DEPTH];
+	strcpy(message.topic, topic);
+	strcpy(message.payload, payload);
+	message.qos = qos ? 1 : 0;
+	message.retain = retain;
+	message.queued = true;
+	message.sent = false;
+	message.resend = false;
+	message.packetId = 0;
+	message.edgeMicros = edgeMicros;
+	queueCount++;
+	return true;
+}
+
+bool MQTTClient::publishCompletion(const ChoreTask& task, uint32_t edgeMicros) {
+	// Stamped with the edge, not with whenever the message gets out. Until
+	// the clock is set there is no time to give, and HA stamps it on arrival.
+	char time[48] = "";
+	char topic[MAX_TOPIC];
+	char payload[MAX_PAYLOAD];
+	if (TaskManager::hasTime()) {
+		uint32_t completedAt = TaskManager::now() - (micros() - edgeMicros) / 1000000;
+		char text[24];
+		TaskFeed::formatDateTime(text, sizeof(text), completedAt);
+		snprintf(time, sizeof(time), ",\"completed_at\":\"%s\"", text);
+	}
+	snprintf(topic, sizeof(topic), "%s%s", TOPIC_COMPLETED, task.id);
+	snprintf(payload, sizeof(payload), "{\"id\":\"%s\",\"switch_id\":%d%s}", task.id, task.switchId + 1, time);
+	return publish(topic, payload, 1, false, edgeMicros);
+}
+
+int MQTTClient::getQueued() {
+	compact();
+	return queueCount;
+}
+
+MQTTStats MQTTClient::getStats() {
+	return stats;
+}
+
+bool MQTTClient::startConnectTask() {
+#ifdef ESP32
+	if (running) return true;
+	if (xTaskCreate(taskMain, "mqtt-connect", CONNECT_STACK_BYTES, nullptr, CONNECT_TASK_PRIORITY,
+	                &connectTask) == pdPASS) {
+		running = true;
+		return true;
+	}
+	Serial.println("MQTT: Could not create connect task - connecting inline");
+#endif
+	return false;
+}
+
+void MQTTClient::taskMain(void* parameter) {
+	(void)parameter;
+#ifdef ESP32
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		open();
+	}
+#endif
+}
+
+void MQTTClient::connect() {
+	state = STATE_OPENING;
+	opened.store(OPEN_WAITING, std::memory_order_relaxed);
+#ifdef ESP32
+	if (running) {
+		xTaskNotifyGive(connectTask);
+		return;
+	}
+#endif
+	open();
+}
+
+void MQTTClient::open() {
+	bool ok = client.connect(MQTT_SERVER, MQTT_PORT, CONNECT_TIMEOUT_MS);
+	if (ok) client.setNoDelay(true);
+	opened.store(ok ? OPEN_DONE : OPEN_FAILED, std::memory_order_release);
+}
+
+void MQTTClient::sendConnect() {
+	connectStarted = millis();
+
+	// Clean session; subscriptions and unacknowledged messages are our job.
+	// The will marks the device offline if the link dies.
+	uint8_t body[CONNECT_BODY];
+	uint8_t* out = putString(body, "MQTT");
+	uint8_t flags = 0x02 | 0x04 | 0x08 | 0x20;    // Clean, will, will QoS 1, will retain
+	if (*MQTT_USERNAME) flags |= 0x80;
+	if (*MQTT_PASSWORD) flags |= 0x40;
+	*out++ = 4;                                   // Protocol level 3.1.1
+	*out++ = flags;
+	*out++ = MQTT_KEEPALIVE_S >> 8;
+	*out++ = MQTT_KEEPALIVE_S & 0xFF;
+	out = putString(out, CONFIG_DEVICE_NAME());
+	out = putString(out, TOPIC_ONLINE);
+	out = putString(out, WILL_PAYLOAD);
+	if (*MQTT_USERNAME) out = putString(out, MQTT_USERNAME);
+	if (*MQTT_PASSWORD) out = putString(out, MQTT_PASSWORD);
+
+	state = STATE_CONNECTING;
+	lastReceived = millis();
+	if (!sendPacket(PACKET_CONNECT, body, out - body)) disconnect(true);
+}
+
+void MQTTClient::disconnect(bool failed) {
+	client.stop();
+	if (failed) stats.failures++;
+	state = STATE_OFFLINE;
+
+	// Anything written but not acknowledged goes again next time
+	for (int i = 0; i < QUEUE_DEPTH; i++) {
+		if (queue[i].queued && queue[i].sent) {
+			queue[i].sent = false;
+			queue[i].resend = true;
+		}
+	}
+
+	// 1x, 2x, 4x ... the minimum, up to the maximum, plus up to a quarter
+	// more so devices that lost the broker together do not return together
+	uint32_t delay = MQTT_BACKOFF_MIN_MS << backoffLevel;
+	if (delay > MQTT_BACKOFF_MAX_MS) delay = MQTT_BACKOFF_MAX_MS;
+	if (delay < MQTT_BACKOFF_MAX_MS) backoffLevel++;
+	delay += (uint32_t)((uint64_t)(delay / 4) * (micros() % 1024) / 1024);
+	nextAttempt = millis() + delay;
+}
+
+void MQTTClient::onConnected() {
+	state = STATE_CONNECTED;
+	backoffLevel = 0;
+	stats.connects++;
+	LOG_INFO(MODULE_NET, "MQTT: Connected to %s\n", MQTT_SERVER);
+
+	uint8_t body[MAX_TOPIC * 2 + 8];
+	uint8_t* out = body;
+	uint16_t id = nextPacketId++;
+	if (nextPacketId == 0) nextPacketId = 1;
+	*out++ = id >> 8;
+	*out++ = id & 0xFF;
+	out = putString(out, TOPIC_TASKS);
+	*out++ = 1;
+	out = putString(out, TOPIC_CONFIG);
+	*out++ = 1;
+	sendPacket(PACKET_SUBSCRIBE, body, out - body);
+
+	publish(TOPIC_ONLINE, "online", 1, true);
+}
+
+void MQTTClient::sendQueued() {
+	for (int i = 0; i < queueCount && state == STATE_CONNECTED; i++) {
+		Message& message = queue[(queueHead + i) % QUEUE_DEPTH];
+		if (!message.queued || message.sent) continue;
+
+		uint8_t body[2 + MAX_TOPIC + 2 + MAX_PAYLOAD];
+		uint8_t* out = putString(body, message.topic);
+		if (message.qos) {
+			if (!message.packetId) {
+				message.packetId = nextPacketId++;
+				if (nextPacketId == 0) nextPacketId = 1;
+			}
+			*out++ = message.packetId >> 8;
+			*out++ = message.packetId & 0xFF;
+		}
+		size_t length = strlen(message.payload);
+		memcpy(out, message.payload, length);
+		out += length;
+
+		uint8_t header = PACKET_PUBLISH | (message.qos << 1);
+		if (message.retain) header |= PUBLISH_RETAIN;
+		if (message.resend) header |= PUBLISH_DUP;
+		if (!sendPacket(header, body, out - body)) return;
+
+		stats.published++;
+		if (message.edgeMicros) {
+			stats.lastLatencyMicros = micros() - message.edgeMicros;
+			if (stats.lastLatencyMicros > stats.maxLatencyMicros) stats.maxLatencyMicros = stats.lastLatencyMicros;
+			message.edgeMicros = 0;
+		}
+		// QoS 0 is done once written; QoS 1 waits for its PUBACK
+		message.sent = true;
+		if (!message.qos) message.queued = false;
+	}
+	compact();
+}
+
+bool MQTTClient::sendPacket(uint8_t header, const uint8_t* body, size_t length) {
+	uint8_t fixed[5];
+	size_t used = 0;
+	fixed[used++] = header;
+	size_t remaining = length;
+	do {
+		uint8_t digit = remaining % 128;
+		remaining /= 128;
+		fixed[used++] = digit | (remaining ? 0x80 : 0);
+	} while (remaining);
+
+	if (client.write(fixed, used) != used || (length && client.write(body, length) != length)) {
+		LOG_WARN(MODULE_NET, "MQTT: Write failed\n");
+		disconnect(true);
+		return false;
+	}
+	lastSent = millis();
+	return true;
+}
+
+void MQTTClient::readPackets() {
+	for (int i = 0; i < READ_BATCH && state != STATE_OFFLINE && client.available() > 0; i++) {
+		if (!readPacket()) {
+			LOG_WARN(MODULE_NET, "MQTT: Bad packet\n");
+			disconnect(true);
+		}
+	}
+}
+
+bool MQTTClient::readPacket() {
+	uint8_t header;
+	if (client.readBytes(&header, 1) != 1) return false;
+	uint32_t length = 0;
+	for (int shift = 0; ; shift += 7) {
+		uint8_t digit;
+		if (shift > 21 || client.readBytes(&digit, 1) != 1) return false;
+		length |= (uint32_t)(digit & 0x7F) << shift;
+		if (!(digit & 0x80)) break;
+	}
+	lastReceived = millis();
+
+	uint8_t reply[2];
+	switch (header & 0xF0) {
+	case PACKET_CONNACK:
+		if (length != 2 || client.readBytes(reply, 2) != 2) return false;
+		if (state != STATE_CONNECTING) return true;
+		if (reply[1] != 0) {
+			LOG_WARN(MODULE_NET, "MQTT: Broker refused connection (%u)\n", reply[1]);
+			disconnect(true);
+			return true;
+		}
+		onConnected();
+		return true;
+
+	case PACKET_PUBLISH:
+		return handlePublish(header & 0x0F, length);
+
+	case PACKET_PUBACK: {
+		if (length != 2 || client.readBytes(reply, 2) != 2) return false;
+		uint16_t id = reply[0] << 8 | reply[1];
+		for (int i = 0; i < QUEUE_DEPTH; i++) {
+			Message& message = queue[i];
+			if (message.queued && message.qos && message.sent && message.packetId == id) {
+				message.queued = false;
+				stats.acknowledged++;
+			}
+		}
+		compact();
+		return true;
+	}
+
+	case PACKET_SUBACK:
+	case PACKET_PINGRESP:
+	default:
+		return skip(length);
+	}
+}
+
+bool MQTTClient::handlePublish(uint8_t flags, uint32_t length) {
+	uint8_t field[2];
+	if (length < 2 || client.readBytes(field, 2) != 2) return false;
+	uint16_t topicLength = field[0] << 8 | field[1];
+	uint8_t qos = (flags >> 1) & 0x03;
+	if (topicLength + 2u + (qos ? 2u : 0u) > length) return false;
+
+	// Topics we did not subscribe to are read and thrown away
+	char topic[MAX_TOPIC];
+	size_t kept = topicLength < MAX_TOPIC ? topicLength : 0;
+	if (client.readBytes((uint8_t*)topic, kept) != kept || !skip(topicLength - kept)) return false;
+	topic[kept] = '\0';
+
+	uint16_t packetId = 0;
+	if (qos) {
+		if (client.readBytes(field, 2) != 2) return false;
+		packetId = field[0] << 8 | field[1];
+	}
+
+	PacketStream payload(client, length - 2 - topicLength - (qos ? 2 : 0));
+	if (payload.left() == 0) {
+		// An empty retained message clears the topic; nothing to apply
+	} else if (strcmp(topic, TOPIC_TASKS) == 0) {
+		stats.received++;
+		TaskFeed::sync(payload, true);
+	} else if (strcmp(topic, TOPIC_CONFIG) == 0) {
+		stats.received++;
+		char json[MAX_CONFIG];
+		size_t size = payload.readBytes(json, sizeof(json) - 1);
+		json[size] = '\0';
+		handleConfig(json);
+	}
+	if (!skip(payload.left())) return false;
+
+	if (qos == 1) {
+		field[0] = packetId >> 8;
+		field[1] = packetId & 0xFF;
+		sendPacket(PACKET_PUBACK, field, 2);
+	}
+	return true;
+}
+
+void MQTTClient::handleConfig(const char* json) {
+	// DeviceConfig (shared/api); only what can change at runtime is applied
+	StaticJsonDocument<MAX_CONFIG> config;
+	if (deserializeJson(config, json)) {
+		LOG_WARN(MODULE_NET, "MQTT: Config is not JSON\n");
+		return;
+	}
+	JsonObjectConst settings = config.as<JsonObjectConst>();
+	if (settings["update_interval"].isNull()) return;
+	long interval = settings["update_interval"] | 0L;
+	if (interval <= 0 || !HAClient::setUpdateInterval(interval)) {
+		LOG_WARN(MODULE_NET, "MQTT: Ignored update_interval %ld ms, below %d ms\n", interval, MIN_UPDATE_INTERVAL_MS);
+		return;
+	}
+	LOG_INFO(MODULE_NET, "MQTT: Task poll interval now %ld ms\n", interval);
+}
+
+bool MQTTClient::skip(uint32_t length) {
+	uint8_t scratch[32];
+	while (length) {
+		size_t chunk = length < sizeof(scratch) ? length : sizeof(scratch);
+		if (client.readBytes(scratch, chunk) != chunk) return false;
+		length -= chunk;
+	}
+	return true;
+}
+
+void MQTTClient::compact() {
+	// Finished messages leave wherever they are, an eviction or an out of
+	// order PUBACK included; the rest close up behind the head in order
+	int kept = 0;
+	for (int i = 0; i < queueCount; i++) {
+		Message& message = queue[(queueHead + i) % QUEUE_DEPTH];
+		if (!message.queued) continue;
+		if (kept != i) {
+			queue[(queueHead + kept) % QUEUE_DEPTH] = message;
+			message.queued = false;
+		}
+		kept++;
+	}
+	queueCount = kept;
+	if (!queueCount) queueHead = 0;
+}
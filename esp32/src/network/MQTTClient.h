@@ -0,0 +1,118 @@
+#pragma once
+#include <Arduino.h>
+#include "../core/TaskManager.h"
+
+// ==============================================
+// MQTT event channel
+// ==============================================
+// A small MQTT 3.1.1 client, so task completions reach Home Assistant as
+// they happen rather than at its next poll, and task list changes reach
+// the device the same way. Topics, under MQTT_TOPIC_PREFIX:
+//   status/online              "online", retained; "offline" as the will
+//   task/completed/{id}        QoS 1, stamped with the switch edge time
+//                              once the clock is set
+//   tasks                      subscribed: the full task list, retained
+//   config/update              subscribed: DeviceConfig JSON, retained
+// A task list arriving here goes through TaskFeed straight off the socket,
+// like an HTTP one.
+//
+// Outgoing messages wait in a fixed queue. QoS 1 messages stay there until
+// the broker acknowledges them and are sent again after a reconnect, so a
+// completion made while the link is down still arrives. A full queue drops
+// its oldest QoS 0 message for a new one, and otherwise refuses it.
+// Connection attempts back off exponentially, with jitter, from
+// MQTT_BACKOFF_MIN_MS to MQTT_BACKOFF_MAX_MS.
+//
+// Opening the connection (name lookup, TCP handshake, up to
+// CONNECT_TIMEOUT_MS) runs on a FreeRTOS task of its own once
+// startConnectTask() has succeeded, and update() looks for the outcome on
+// later ticks. Until then (and always on the host build) it runs inline.
+// Otherwise update() only waits on the broker to finish a packet that has
+// started to arrive.
+
+struct MQTTStats {
+	uint32_t connects;
+	uint32_t failures;          // Refused, lost or timed out
+	uint32_t published;         // Messages written, resends included
+	uint32_t acknowledged;      // QoS 1 messages the broker confirmed
+	uint32_t dropped;           // Queue full
+	uint32_t received;          // Messages on subscribed topics
+	uint32_t lastLatencyMicros; // Completion: switch edge to message written
+	uint32_t maxLatencyMicros;
+};
+
+class MQTTClient {
+public:
+	static const int QUEUE_DEPTH = 8;
+	static const size_t MAX_TOPIC = 64;
+	static const size_t MAX_PAYLOAD = 160;
+	static const size_t MAX_CONFIG = 256;     // Larger config messages are cut
+	static const uint32_t CONNECT_TIMEOUT_MS = 5000;
+
+	static void initialize();
+
+	// False (and connections are opened inline) when threading is unavailable
+	static bool startConnectTask();
+
+	// Call every tick: connects when due, reads what has arrived, sends
+	// what is queued and keeps the connection alive
+	static void update();
+	static bool isConnected();
+
+	// Queues a message; false (and counted) when there is no room.
+	// edgeMicros, when set, is the input edge the message reports.
+	static bool publish(const char* topic, const char* payload, uint8_t qos = 0, bool retain = false,
+	                    uint32_t edgeMicros = 0);
+	static bool publishCompletion(const ChoreTask& task, uint32_t edgeMicros);
+
+	static int getQueued();
+	static MQTTStats getStats();
+
+private:
+	enum State : uint8_t {
+		STATE_OFFLINE = 0,
+		STATE_OPENING,            // Connect task opening the TCP connection
+		STATE_CONNECTING,         // Waiting for CONNACK
+		STATE_CONNECTED
+	};
+
+	struct Message {
+		char topic[MAX_TOPIC];
+		char payload[MAX_PAYLOAD];
+		uint8_t qos;
+		bool retain;
+		bool queued;              // Slot in use
+		bool sent;                // Written on this connection
+		bool resend;              // Written before; goes again with DUP
+		uint16_t packetId;
+		uint32_t edgeMicros;
+	};
+
+	static void connect();
+	static void sendConnect();
+	static void open();                       // Connect task side
+	static void taskMain(void* parameter);
+	static void disconnect(bool failed);
+	static void onConnected();
+	static void sendQueued();
+	static bool sendPacket(uint8_t header, const uint8_t* body, size_t length);
+	static void readPackets();
+	static bool readPacket();
+	static bool handlePublish(uint8_t flags, uint32_t length);
+	static void handleConfig(const char* json);
+	static bool skip(uint32_t length);
+	static void compact();
+
+	static Message queue[QUEUE_DEPTH];
+	static int queueHead;
+	static int queueCount;
+	static State state;
+	static uint16_t nextPacketId;
+	static uint8_t backoffLevel;
+	static uint32_t nextAttempt;
+	static uint32_t connectStarted;
+	static uint32_t lastSent;
+	static uint32_t lastReceived;
+	static bool running;                      // Connect task started
+	static MQTTStats stats;
+};
@@ -0,0 +1,438 @@
+#include "TaskFeed.h"
+#include <ArduinoJson.h>
+#include "../utils/Log.h"
+#include <time.h>
+
+static StaticJsonDocument<TaskFeed::ELEMENT_CAPACITY> element;      // sync()'s
+
+// Tells this boot's sequence numbers from the last one's
+static uint32_t bootEpoch = 0;
+static uint32_t lastSyncTime = 0;
+
+template <size_t N>
+static void copyField(char (&dest)[N], JsonVariantConst value) {
+	const char* text = value | "";
+	size_t length = strnlen(text, N - 1);
+	memcpy(dest, text, length);
+	dest[length] = '\0';
+}
+
+// Keys are string literals, which ArduinoJson stores by pointer
+static StaticJsonDocument<384> makeFilter() {
+	StaticJsonDocument<384> filter;
+	filter["id"] = true;
+	filter["title"] = true;
+	filter["person_id"] = true;
+	filter["state"] = true;
+	filter["type"] = true;
+	filter["start_time"] = true;
+	filter["end_time"] = true;
+	filter["reward"] = true;
+	filter["reward_time"] = true;
+	filter["switch_id"] = true;
+	filter["removed"] = true;
+	return filter;
+}
+
+// Built before setup(), so readers on any task only ever read it
+static const StaticJsonDocument<384> filter = makeFilter();
+
+// One filtered element into a task; false when it has no id
+static bool toTask(JsonObjectConst object, ChoreTask& task) {
+	const char* id = object["id"] | "";
+	if (!*id) return false;
+
+	memset(&task, 0, sizeof(task));
+	copyField(task.id, object["id"]);
+	copyField(task.title, object["title"]);
+	copyField(task.personId, object["person_id"]);
+	copyField(task.reward, object["reward"]);
+	task.type = TaskFeed::parseType(object["type"] | "");
+	task.state = TaskFeed::parseState(object["state"] | "");
+	task.startTime = TaskFeed::parseDateTime(object["start_time"] | "");
+	task.endTime = TaskFeed::parseDateTime(object["end_time"] | "");
+	task.rewardTime = TaskFeed::parseDateTime(object["reward_time"] | "");
+
+	// The API numbers switches from 1, as they are labelled
+	int switchId = object["switch_id"] | 0;
+	task.switchId = switchId >= 1 && switchId <= TOTAL_TFT_DISPLAYS ? switchId - 1 : -1;
+	return true;
+}
+
+// A full list can name new tasks while ones it will drop still hold every
+// slot. One it has not named yet gives way; if it is named further down it
+// is added again then.
+static void makeRoom(const char* id, const bool* seen) {
+	if (TaskManager::getTaskCount() < TaskManager::MAX_TASKS || TaskManager::findTask(id) >= 0) return;
+	for (int i = 0; i < TaskManager::MAX_TASKS; i++) {
+		const ChoreTask* task = TaskManager::getTask(i);
+		if (task && !seen[i]) {
+			TaskManager::removeTask(task->id);
+			return;
+		}
+	}
+}
+
+TaskFeedReader::TaskFeedReader(Stream& body, JsonDocument& element)
+	: body(body), element(element), pending(-1), started(false), outcome() {}
+
+int TaskFeedReader::read() {
+	if (pending >= 0) {
+		int c = pending;
+		pending = -1;
+		return c;
+	}
+	char c;
+	return body.readBytes(&c, 1) == 1 ? (uint8_t)c : -1;
+}
+
+size_t TaskFeedReader::readBytes(char* buffer, size_t length) {
+	if (length == 0) return 0;
+	size_t n = 0;
+	if (pending >= 0) {
+		buffer[n++] = (char)pending;
+		pending = -1;
+	}
+	return n + body.readBytes(buffer + n, length - n);
+}
+
+int TaskFeedReader::nextCharacter() {
+	int c;
+	do {
+		c = read();
+	} while (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+	return c;
+}
+
+bool TaskFeedReader::next(TaskFeedEntry& entry) {
+	if (!started) {
+		started = true;
+		if (nextCharacter() != '[') {
+			outcome.error = "not an array";
+			return false;
+		}
+		int c = nextCharacter();
+		if (c == ']') {
+			outcome.complete = true;
+		} else {
+			pending = c;
+		}
+	}
+
+	while (!outcome.complete && !outcome.error) {
+		DeserializationError error = deserializeJson(element, *this,
+			DeserializationOption::Filter(filter),
+			DeserializationOption::NestingLimit(TaskFeed::NESTING_LIMIT));
+		if (error) {
+			outcome.error = error.c_str();
+			break;
+		}
+		outcome.received++;
+
+		JsonObjectConst object = element.as<JsonObjectConst>();
+		entry.removed = object["removed"] | false;
+		bool found = false;
+		if (entry.removed) {
+			memset(&entry.task, 0, sizeof(entry.task));
+			copyField(entry.task.id, object["id"]);
+			found = true;
+		} else if (toTask(object, entry.task)) {
+			found = true;
+		} else {
+			outcome.rejected++;
+		}
+
+		int c = nextCharacter();
+		if (c == ']') {
+			outcome.complete = true;
+		} else if (c != ',') {
+			outcome.error = c < 0 ? "body ended early" : "expected , or ]";
+		}
+		if (found) return true;
+	}
+	return false;
+}
+
+void TaskFeedApplier::begin(bool full) {
+	this->full = full;
+	memset(seen, 0, sizeof(seen));
+	result = {};
+}
+
+void TaskFeedApplier::apply(const TaskFeedEntry& entry) {
+	if (entry.removed) {
+		// Only meaningful in a delta; a full list just leaves it out
+		if (!full && TaskManager::removeTask(entry.task.id)) result.removed++;
+		return;
+	}
+	if (full) makeRoom(entry.task.id, seen);
+	int slot = TaskManager::addTask(entry.task);
+	if (slot >= 0) {
+		seen[slot] = true;
+		result.applied++;
+	} else {
+		result.rejected++;
+	}
+}
+
+TaskFeedResult TaskFeedApplier::finish(const TaskFeedResult& read) {
+	result.complete = read.complete;
+	result.received = read.received;
+	result.rejected += read.rejected;
+	result.error = read.error;
+
+	if (result.complete && full) {
+		for (int i = 0; i < TaskManager::MAX_TASKS; i++) {
+			const ChoreTask* task = TaskManager::getTask(i);
+			if (task && !seen[i] && TaskManager::removeTask(task->id)) result.removed++;
+		}
+	}
+	if (result.complete) {
+		lastSyncTime = millis();
+		LOG_INFO(MODULE_NET, "TaskFeed: %s sync, %u tasks, %u rejected, %u removed\n",
+		         full ? "Full" : "Delta", result.applied, result.rejected, result.removed);
+	} else {
+		LOG_WARN(MODULE_NET, "TaskFeed: Sync stopped after %u tasks: %s\n", result.received, result.error);
+	}
+	return result;
+}
+
+TaskFeedResult TaskFeed::sync(Stream& body, bool full) {
+	TaskFeedReader reader(body, element);
+	TaskFeedApplier applier;
+	TaskFeedEntry entry;
+	applier.begin(full);
+	while (reader.next(entry)) applier.apply(entry);
+	return applier.finish(reader.result());
+}
+
+uint32_t TaskFeed::getLastSyncTime() {
+	return lastSyncTime;
+}
+
+void TaskFeed::writeString(Print& out, const char* text) {
+	out.print('"');
+	for (; *text; text++) {
+		if (*text == '"' || *text == '\\') {
+			out.print('\\');
+			out.print(*text);
+		} else if ((uint8_t)*text < 0x20) {
+			out.printf("\\u%04x", *text);
+		} else {
+			out.print(*text);
+		}
+	}
+	out.print('"');
+}
+
+static void printTime(Print& out, uint32_t seconds) {
+	if (seconds) {
+		char text[24];
+		TaskFeed::formatDateTime(text, sizeof(text), seconds);
+		out.printf("\"%s\"", text);
+	} else {
+		out.print("null");
+	}
+}
+
+void TaskFeed::writeTasks(Print& out, bool delta, uint32_t since) {
+	TaskListCursor cursor;
+	beginTasks(cursor, delta, since);
+	while (writeNextTask(out, cursor)) {}
+}
+
+void TaskFeed::beginTasks(TaskListCursor& cursor, bool delta, uint32_t since) {
+	cursor.delta = delta;
+	cursor.first = true;
+	cursor.next = -1;
+	cursor.since = since;
+}
+
+bool TaskFeed::writeNextTask(Print& out, TaskListCursor& cursor) {
+	if (cursor.next < 0) {
+		out.print('[');
+		cursor.next = 0;
+	}
+
+	// Removals first: an id removed and added again ends up present
+	for (; cursor.delta && cursor.next < TaskManager::REMOVAL_LOG; cursor.next++) {
+		const TaskRemoval* removal = TaskManager::getRemoval(cursor.next);
+		if (!removal || removal->sequence <= cursor.since) continue;
+		out.print(cursor.first ? "{\"id\":" : ",{\"id\":");
+		writeString(out, removal->id);
+		out.print(",\"removed\":true}");
+		cursor.first = false;
+		cursor.next++;
+		return true;
+	}
+	if (cursor.next < TaskManager::REMOVAL_LOG) cursor.next = TaskManager::REMOVAL_LOG;
+
+	for (; cursor.next < TaskManager::REMOVAL_LOG + TaskManager::MAX_TASKS; cursor.next++) {
+		int slot = cursor.next - TaskManager::REMOVAL_LOG;
+		const ChoreTask* task = TaskManager::getTask(slot);
+		if (!task || (cursor.delta && TaskManager::getModified(slot) <= cursor.since)) continue;
+		out.print(cursor.first ? "{\"id\":" : ",{\"id\":");
+		writeString(out, task->id);
+		out.print(",\"title\":");
+		writeString(out, task->title);
+		out.print(",\"person_id\":");
+		writeString(out, task->personId);
+		out.printf(",\"state\":\"%s\",\"type\":\"%s\",\"start_time\":",
+		           TaskManager::stateName(task->state), TaskManager::typeName(task->type));
+		printTime(out, task->startTime);
+		out.print(",\"end_time\":");
+		printTime(out, task->endTime);
+		out.print(",\"reward\":");
+		if (task->reward[0]) {
+			writeString(out, task->reward);
+		} else {
+			out.print("null");
+		}
+		out.print(",\"reward_time\":");
+		printTime(out, task->rewardTime);
+		out.printf(",\"switch_id\":%d}", task->switchId + 1);
+		cursor.first = false;
+		cursor.next++;
+		return true;
+	}
+	out.print("]\n");
+	return false;
+}
+
+size_t TaskFeed::formatTag(char* out, size_t size) {
+	if (!bootEpoch) {
+#ifdef ESP32
+		bootEpoch = esp_random() | 1;
+#else
+		bootEpoch = (uint32_t)time(nullptr) | 1;
+#endif
+	}
+	int length = snprintf(out, size, "\"%08lx.%lu\"", (unsigned long)bootEpoch,
+	                      (unsigned long)TaskManager::getSequence());
+	return length > 0 ? (size_t)length : 0;
+}
+
+bool TaskFeed::parseTag(const char* tag, uint32_t& since) {
+	unsigned long epoch = 0;
+	unsigned long sequence = 0;
+	if (!tag || !bootEpoch) return false;
+	if (strncmp(tag, "W/", 2) == 0) tag += 2;
+	if (sscanf(tag, "\"%lx.%lu\"", &epoch, &sequence) != 2 || epoch != bootEpoch) return false;
+	if (sequence > TaskManager::getSequence() || sequence < TaskManager::getDeltaHorizon()) return false;
+	since = sequence;
+	return true;
+}
+
+// Digits at text[0..count), or -1
+static int parseDigits(const char* text, int count) {
+	int value = 0;
+	for (int i = 0; i < count; i++) {
+		if (text[i] < '0' || text[i] > '9') return -1;
+		value = value * 10 + (text[i] - '0');
+	}
+	return value;
+}
+
+// Days from 1970-01-01 to a proleptic Gregorian date
+static int32_t daysFromCivil(int year, int month, int day) {
+	year -= month <= 2;
+	int era = (year >= 0 ? year : year - 399) / 400;
+	int yearOfEra = year - era * 400;
+	int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+	int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+	return era * 146097 + dayOfEra - 719468;
+}
+
+uint32_t TaskFeed::parseDateTime(const char* text) {
+	// YYYY-MM-DDTHH:MM:SS, optional fraction, then Z or +-HH:MM
+	if (!text || strlen(text) < 19) return 0;
+	if (text[4] != '-' || text[7] != '-' || text[13] != ':' || text[16] != ':') return 0;
+	if (text[10] != 'T' && text[10] != 't' && text[10] != ' ') return 0;
+
+	int year = parseDigits(text, 4);
+	int month = parseDigits(text + 5, 2);
+	int day = parseDigits(text + 8, 2);
+	int hour = parseDigits(text + 11, 2);
+	int minute = parseDigits(text + 14, 2);
+	int second = parseDigits(text + 17, 2);
+	if (year < 1970 || month < 1 || month > 12 || day < 1 || day > 31 ||
+	    hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 || second > 60) {
+		return 0;
+	}
+
+	const char* zone = text + 19;
+	if (*zone == '.') {
+		do {
+			zone++;
+		} while (*zone >= '0' && *zone <= '9');
+	}
+
+	int32_t offset = 0;
+	if (*zone == '+' || *zone == '-') {
+		int hours = parseDigits(zone + 1, 2);
+		int minutes = zone[3] == ':' ? parseDigits(zone + 4, 2) : parseDigits(zone + 3, 2);
+		if (hours < 0 || minutes < 0) return 0;
+		offset = (hours * 60 + minutes) * 60;
+		if (*zone == '-') offset = -offset;
+	} else if (*zone && *zone != 'Z' && *zone != 'z') {
+		return 0;
+	}
+
+	int64_t seconds = (int64_t)daysFromCivil(year, month, day) * 86400 +
+	                  hour * 3600 + minute * 60 + second - offset;
+	return seconds > 0 && seconds <= UINT32_MAX ? (uint32_t)seconds : 0;
+}
+
+uint32_t TaskFeed::parseHttpDate(const char* text) {
+	// "Sun, 06 Nov 1994 08:49:37 GMT", the only form HTTP/1.1 sends
+	static const char MONTHS[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+	if (!text || strlen(text) != 29 || text[3] != ',' || strcmp(text + 25, " GMT") != 0) return 0;
+	if (text[19] != ':' || text[22] != ':') return 0;
+
+	int month = 0;
+	while (month < 12 && strncmp(MONTHS + month * 3, text + 8, 3) != 0) month++;
+	int day = parseDigits(text + 5, 2);
+	int year = parseDigits(text + 12, 4);
+	int hour = parseDigits(text + 17, 2);
+	int minute = parseDigits(text + 20, 2);
+	int second = parseDigits(text + 23, 2);
+	if (month == 12 || year < 1970 || day < 1 || day > 31 ||
+	    hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 || second > 60) {
+		return 0;
+	}
+	int64_t seconds = (int64_t)daysFromCivil(year, month + 1, day) * 86400 + hour * 3600 + minute * 60 + second;
+	return seconds > 0 && seconds <= UINT32_MAX ? (uint32_t)seconds : 0;
+}
+
+size_t TaskFeed::formatDateTime(char* out, size_t size, uint32_t seconds) {
+	// Civil date from days since 1970-01-01
+	int32_t days = seconds / 86400;
+	uint32_t time = seconds % 86400;
+	days += 719468;
+	int era = days / 146097;
+	int dayOfEra = days - era * 146097;
+	int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+	int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+	int monthIndex = (5 * dayOfYear + 2) / 153;
+	int day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+	int month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+	int year = yearOfEra + era * 400 + (month <= 2);
+	int length = snprintf(out, size, "%04d-%02d-%02dT%02lu:%02lu:%02luZ", year, month, day,
+	                      (unsigned long)(time / 3600), (unsigned long)(time / 60 % 60),
+	                      (unsigned long)(time % 60));
+	return length > 0 ? (size_t)length : 0;
+}
+
+TaskType TaskFeed::parseType(const char* text) {
+	for (int i = 0; i <= TASK_TIMED_WITH_EARLY; i++) {
+		if (strcmp(text, TaskManager::typeName((TaskType)i)) == 0) return (TaskType)i;
+	}
+	return TASK_UNTIMED;
+}
+
+TaskState TaskFeed::parseState(const char* text) {
+	for (int i = 0; i <= TASK_AUTO_REMOVED; i++) {
+		if (strcmp(text, TaskManager::stateName((TaskState)i)) == 0) return (TaskState)i;
+	}
+	return TASK_PENDING;
+}
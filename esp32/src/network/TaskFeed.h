@@ -0,0 +1,141 @@
+#pragma once
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "../core/TaskManager.h"
+
+// ==============================================
+// Home Assistant task feed
+// ==============================================
+// Reads the task list HA returns (a JSON array of Task objects, see
+// shared/api/choretracker_api.yaml) straight off the HTTP body stream into
+// TaskManager's fixed slots. The body is never buffered: each array element
+// is deserialised on its own into a fixed-size document through a filter
+// that keeps only the Task fields, so everything else HA sends (calendar
+// descriptions, attendees, attributes) is skipped as it streams past. Peak
+// RAM is one element's document however long the response is.
+//
+// A full sync is a whole task list. Tasks it names are added or updated;
+// once the closing bracket has been read, tasks it no longer names are
+// removed. A response that breaks off part way leaves the tasks it did not
+// reach as they were.
+//
+// A delta sync carries only what changed since the sender's ETag the
+// receiver last saw: tasks added or updated, and {"id": ..., "removed":
+// true} for tasks removed, in the order it happened. Nothing else is
+// touched. The same format goes the other way, from TaskManager's change
+// log, for whoever asks the device what changed. Device ETags are
+// "<boot epoch>.<sequence>", so a tag from before a restart never passes
+// for a current one.
+//
+// sync() reads and applies in one go. The two halves are also there on
+// their own, for a list read on one FreeRTOS task and applied on another:
+// TaskFeedReader hands out the elements, TaskFeedApplier puts them into
+// TaskManager. Readers share nothing but a filter that never changes, so
+// each task can have its own.
+
+struct TaskFeedResult {
+	bool complete;            // Whole array read
+	uint16_t received;        // Array elements read
+	uint16_t applied;         // Added or updated in TaskManager
+	uint16_t rejected;        // No id, no free slot, or a fixed_time task already over
+	uint16_t removed;         // Missing from a full list, or marked in a delta
+	const char* error;        // Why a sync stopped early, or nullptr
+};
+
+// One element of a task list as read
+struct TaskFeedEntry {
+	bool removed;             // {"id": ..., "removed": true}
+	ChoreTask task;           // Only the id for a removal
+};
+
+// Where a task list being written has got to; see TaskFeed::writeNextTask()
+struct TaskListCursor {
+	bool delta;
+	bool first;               // No element written yet
+	int16_t next;             // Removal log entries, then task slots; -1 = before the "["
+	uint32_t since;
+};
+
+class TaskFeed {
+public:
+	// Filtered fields of one Task; sized for the schema with room to spare
+	static const size_t ELEMENT_CAPACITY = 768;
+	static const uint8_t NESTING_LIMIT = 10;
+
+	static TaskFeedResult sync(Stream& body, bool full = true);
+	static uint32_t getLastSyncTime();     // millis() of the last complete sync, 0 = never
+
+	// Most writeNextTask() writes at once: every string escaped as \u00XX
+	static const size_t MAX_ELEMENT_JSON = 6 * (sizeof(ChoreTask::id) + sizeof(ChoreTask::title) +
+	                                             sizeof(ChoreTask::personId) + sizeof(ChoreTask::reward)) + 256;
+
+	// Writes the device's tasks as a full list, or only the changes since
+	// a sequence number
+	static void writeTasks(Print& out, bool delta, uint32_t since = 0);
+	// The same one element at a time, for output that cannot take it all at
+	// once. writeNextTask() writes the next element, and the closing bracket
+	// after the last, returning false once it has.
+	static void beginTasks(TaskListCursor& cursor, bool delta, uint32_t since = 0);
+	static bool writeNextTask(Print& out, TaskListCursor& cursor);
+
+	// A JSON string, quoted and escaped
+	static void writeString(Print& out, const char* text);
+
+	// Current ETag, quotes included
+	static size_t formatTag(char* out, size_t size);
+	// True (and the sequence) when a tag the device gave out can still be
+	// answered with a delta
+	static bool parseTag(const char* tag, uint32_t& since);
+
+	// RFC 3339 date-time ("2024-05-01T18:30:00Z", "...+01:00") to Unix
+	// seconds; 0 for anything else
+	static uint32_t parseDateTime(const char* text);
+	// HTTP Date header ("Sun, 06 Nov 1994 08:49:37 GMT") to Unix seconds; 0
+	// for anything else
+	static uint32_t parseHttpDate(const char* text);
+	static size_t formatDateTime(char* out, size_t size, uint32_t seconds);   // UTC, "Z"
+	static TaskType parseType(const char* text);
+	static TaskState parseState(const char* text);
+};
+
+// Reads a task list off a stream one element at a time, each deserialised
+// into the document it was given
+class TaskFeedReader {
+public:
+	TaskFeedReader(Stream& body, JsonDocument& element);
+
+	// The next element; false at the end of the list, or when it cannot be
+	// read (see result()). Elements without an id are skipped.
+	bool next(TaskFeedEntry& entry);
+	// complete, received, rejected (no id) and error
+	const TaskFeedResult& result() const { return outcome; }
+
+	// For ArduinoJson: the body, with room to push back the one character
+	// looked at between elements. Reads honour the stream's timeout.
+	int read();
+	size_t readBytes(char* buffer, size_t length);
+
+private:
+	int nextCharacter();     // Skips whitespace; -1 at the end of the body
+
+	Stream& body;
+	JsonDocument& element;
+	int pending;
+	bool started;
+	TaskFeedResult outcome;
+};
+
+// Applies what a TaskFeedReader read to TaskManager, element by element
+class TaskFeedApplier {
+public:
+	void begin(bool full);
+	void apply(const TaskFeedEntry& entry);
+	// After the last element: a full list read to the end removes the tasks
+	// it did not name. The result of the whole sync.
+	TaskFeedResult finish(const TaskFeedResult& read);
+
+private:
+	bool full;
+	bool seen[TaskManager::MAX_TASKS];
+	TaskFeedResult result;
+};
@@ -1,21 +1,45 @@
 #include "DisplayManager.h"
+#include "../core/BootTrace.h"
 #include "../core/DemoManager.h"
+#include "../core/FrameScheduler.h"
+#include "../core/Metrics.h"
 #include "../config/GPIOConfig.h"
+#include "../utils/Log.h"
 #include <Arduino.h>
 
 // Static member definitions
-Adafruit_ST7789* DisplayManager::displays[8];
+St7789Panel* DisplayManager::displays[8];
 bool DisplayManager::displaysInitialized = false;
 uint8_t DisplayManager::currentBrightness = 200;
-unsigned long DisplayManager::lastUpdate = 0;
+FrameBuffer* DisplayManager::frameBuffer = nullptr;
+FrameCanvas* DisplayManager::canvas = nullptr;
+int DisplayManager::canvasDisplay = -1;
+uint16_t DisplayManager::canvasMask = 0;
+uint16_t DisplayManager::broadcastMask = 0;
+FlushStats DisplayManager::flushStats = {0, 0, 0, 0};
+SpiTransferQueue DisplayManager::transferQueue;
+SpiTransferBackend* DisplayManager::transferBackend = nullptr;
+Scene DisplayManager::scenes[8];
+int8_t DisplayManager::taskStatus[8] = {-1, -1, -1, -1, -1, -1, -1, -1};
+int DisplayManager::renderCursor = 0;
+uint32_t DisplayManager::demoVersion = 0;
+uint32_t DisplayManager::taskVersion = 0;
+int DisplayManager::animationFrame = -1;
+int DisplayManager::sparkleNodes[8] = {-1, -1, -1, -1, -1, -1, -1, -1};
+AnimationStats DisplayManager::animationStats = {0, 0};
+DisplayManager::Transition DisplayManager::transition = TRANSITION_NONE;
+int DisplayManager::transitionPhase = 0;
+int DisplayManager::transitionDisplay = 0;
+unsigned long DisplayManager::transitionResumeAt = 0;
+int DisplayManager::activationProgress = -1;
+
+// Transition timing
+static const int ACTIVATION_PHASES = 8;
+static const unsigned long ACTIVATION_PHASE_MS = 200;
+static const unsigned long EXIT_HOLD_MS = 1000;
 
 // Hardware pin assignments from GPIOConfig.h
-const int DisplayManager::CS_PINS[8] = {9, 10, 1, 3, 39, 36, 37, 38};
-const int DisplayManager::TFT_DC = 19;
-const int DisplayManager::TFT_RST = -1;  // Connected to ESP32 reset
-const int DisplayManager::TFT_SCK = 18;
-const int DisplayManager::TFT_MOSI = 23;
-const int DisplayManager::TFT_BL = 8;
+const int DisplayManager::CS_PINS[TOTAL_TFT_DISPLAYS] = TFT_CS_PINS;
 
 void DisplayManager::initialize() {
 	Serial.println("DisplayManager: Initializing TFT displays...");
@@ -29,28 +53,58 @@ void DisplayManager::initialize() {
 	// Turn on backlight
 	digitalWrite(TFT_BL, HIGH);
 	
-	// Initialize all CS pins
-	for (int i = 0; i < 8; i++) {
-		pinMode(CS_PINS[i], OUTPUT);
-		digitalWrite(CS_PINS[i], HIGH);  // CS is active low
-	}
+	// Chip-select lines belong to the arbiter, not the driver
+	BusArbiter::initialize(CS_PINS, 8);
 	
 	// Initialize display objects
 	for (int i = 0; i < 8; i++) {
-		displays[i] = new Adafruit_ST7789(CS_PINS[i], TFT_DC, TFT_RST);
+		displays[i] = new St7789Panel(-1, TFT_DC, TFT_RST);
+		scenes[i].setSize(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+	}
+#if DISPLAY_BROADCAST_INIT
+	initializeAllDisplays();
+#else
+	for (int i = 0; i < 8; i++) {
 		initializeDisplay(i);
 	}
+#endif
+	BootTrace::mark("panels");
+	
+	// Canvas flushes go through the transfer queue; DMA where the chip has it
+#ifdef ESP32
+	transferBackend = new Esp32DmaSpiBackend(displays, 8, TFT_SCK, TFT_MOSI, TFT_DC, TFT_SPI_FREQUENCY);
+	if (!transferBackend->begin()) {
+		delete transferBackend;
+		transferBackend = nullptr;
+	}
+#endif
+	if (!transferBackend) {
+		transferBackend = new PanelSpiBackend(displays, 8);
+	}
+	
+	// Off-screen canvas shared by all displays
+	frameBuffer = new FrameBuffer(DISPLAY_WIDTH, DISPLAY_HEIGHT, 8);
+	if (frameBuffer->allocate() && transferQueue.begin(transferBackend)) {
+		canvas = new FrameCanvas(*frameBuffer);
+		Serial.printf("DisplayManager: %dx%d canvas allocated (%u bytes)\n",
+		              DISPLAY_WIDTH, DISPLAY_HEIGHT, (unsigned)(DISPLAY_WIDTH * DISPLAY_HEIGHT * 2));
+	} else {
+		delete frameBuffer;
+		frameBuffer = nullptr;
+		Serial.println("DisplayManager: Not enough RAM for canvas - drawing directly to panels");
+	}
 	
 	displaysInitialized = true;
 	Serial.println("DisplayManager: All displays initialized with colourful demo support!");
 	
-	// Show startup pattern on all displays
-	for (int i = 0; i < 8; i++) {
-		clearDisplay(i, DemoColours::BLACK);
-		drawCenteredText(i, "ChoreTracker", 100, DemoColours::WHITE, 2);
-		drawCenteredText(i, "Ready!", 140, DemoColours::GREEN, 1);
-		drawPattern(i, DemoPatterns::STAR, DemoColours::YELLOW, DISPLAY_WIDTH/2, 200, 30);
-	}
+	// Show startup pattern on all displays - drawn once, sent once
+	beginBroadcast(ALL_DISPLAYS);
+	clearDisplay(0, DemoColours::BLACK);
+	drawCenteredText(0, "ChoreTracker", 100, DemoColours::WHITE, 2);
+	drawCenteredText(0, "Ready!", 140, DemoColours::GREEN, 1);
+	drawPattern(0, DemoPatterns::STAR, DemoColours::YELLOW, DISPLAY_WIDTH/2, 200, 30);
+	endBroadcast();
+	BootTrace::mark("splash");
 }
 
 void DisplayManager::initializeDisplay(int displayIndex) {
@@ -62,55 +116,337 @@ void DisplayManager::initializeDisplay(int displayIndex) {
 	displays[displayIndex]->fillScreen(ST77XX_BLACK);
 	deselectAllDisplays();
 	
-	Serial.printf("Display %d initialized (CS: GPIO %d)\n", displayIndex, CS_PINS[displayIndex]);
+	LOG_INFO(MODULE_DISPLAY, "Display %d initialized (CS: GPIO %d)\n", displayIndex, CS_PINS[displayIndex]);
+}
+
+void DisplayManager::initializeAllDisplays() {
+	// One init sequence and one clear, sent with every CS low, so the
+	// panels sit out the driver's reset and sleep-out waits together
+	transferQueue.drain();
+	BusArbiter::selectMask(BusArbiter::allDisplays());
+	displays[0]->init(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+	displays[0]->setRotation(1);  // Landscape orientation
+	displays[0]->fillScreen(ST77XX_BLACK);
+	deselectAllDisplays();
+	
+	// The others heard the same bytes; their drivers just need the state
+	for (int i = 1; i < 8; i++) {
+		displays[i]->adoptInit(*displays[0]);
+	}
+	
+	LOG_INFO(MODULE_DISPLAY, "Displays 0-7 initialized together (one broadcast init)\n");
+}
+
+void DisplayManager::beginBroadcast(uint16_t displayMask) {
+	displayMask &= ALL_DISPLAYS;
+	if (!(displayMask & (displayMask - 1))) displayMask = 0;  // One display is no broadcast
+	if (displayMask == broadcastMask) return;
+	
+	// What the canvas holds goes where it was drawn for
+	flushCanvas();
+	broadcastMask = displayMask;
+	if (canvasDisplay >= 0) canvasMask = targetMask(canvasDisplay);
+}
+
+void DisplayManager::endBroadcast() {
+	beginBroadcast(0);
+}
+
+uint16_t DisplayManager::targetMask(int displayIndex) {
+	if (broadcastMask && displayIndex == __builtin_ctz(broadcastMask)) return broadcastMask;
+	return 1u << displayIndex;
+}
+
+void DisplayManager::leaveBroadcast(int displayIndex) {
+	uint16_t bit = 1u << displayIndex;
+	if (!(broadcastMask & bit) || displayIndex == __builtin_ctz(broadcastMask)) return;
+	
+	// It still gets everything drawn for the group so far
+	if (canvasMask & bit) flushCanvas();
+	beginBroadcast(broadcastMask & ~bit);
+}
+
+uint16_t DisplayManager::matchingScenes(int displayIndex) {
+	// Other displays waiting to render exactly this scene. Unless the whole
+	// canvas is being rebuilt, their panels must match this one's as well,
+	// since only the invalidated regions are redrawn.
+	const Scene& scene = scenes[displayIndex];
+	bool rebuild = scene.needsFullRepaint() || canvasDisplay != displayIndex;
+	uint16_t mask = 0;
+	for (int i = 0; i < 8; i++) {
+		if (i == displayIndex || (broadcastMask & (1u << i)) || !scenes[i].needsRender()) continue;
+		if (!scenes[i].matches(scene)) continue;
+		if (!rebuild && !frameBuffer->sameContent(displayIndex, i)) continue;
+		mask |= 1u << i;
+	}
+	return mask;
 }
 
 void DisplayManager::selectDisplay(int displayIndex) {
 	if (displayIndex < 0 || displayIndex >= 8) return;
 	
-	// Deselect all displays first
-	deselectAllDisplays();
+	// Queued canvas pixels must be out before the driver touches the bus
+	transferQueue.drain();
 	
-	// Select the target display
-	digitalWrite(CS_PINS[displayIndex], LOW);
+	// Only toggles GPIO when the selection actually changes
+	BusArbiter::selectMask(targetMask(displayIndex));
 }
 
 void DisplayManager::deselectAllDisplays() {
-	for (int i = 0; i < 8; i++) {
-		digitalWrite(CS_PINS[i], HIGH);
+	transferQueue.drain();
+	BusArbiter::deselect();
+}
+
+Adafruit_GFX* DisplayManager::beginDraw(int displayIndex) {
+	leaveBroadcast(displayIndex);
+	if (canvas && canvasDisplay == displayIndex) {
+		return canvas;
+	}
+	
+	// Not resident in the canvas - draw straight to the panel and forget its
+	// tile signatures so the next canvas flush repaints whatever we touched
+	if (frameBuffer) {
+		for (uint16_t mask = targetMask(displayIndex); mask; mask &= mask - 1) {
+			frameBuffer->invalidate(__builtin_ctz(mask));
+		}
 	}
+	selectDisplay(displayIndex);
+	return displays[displayIndex];
+}
+
+void DisplayManager::endDraw() {
+	// Chip-select stays on the panel, so the next primitive on the same
+	// display goes out without another CS toggle
+}
+
+void DisplayManager::flushCanvas() {
+	if (!canvas || canvasDisplay < 0 || !frameBuffer->hasTouchedRegion()) return;
+	
+	// Tiles that differ on any of the panels go out once, to all of them
+	DirtyRect rects[MAX_FLUSH_RECTS];
+	int count = frameBuffer->collectDirtyRects(canvasMask, rects, MAX_FLUSH_RECTS);
+	if (count == 0) return;
+	
+	// Copied into the transfer queue, so the canvas is free again on return
+	St7789Panel* panel = displays[canvasDisplay];
+	for (int i = 0; i < count; i++) {
+		// Clip to the panel so we never address rows the controller doesn't show
+		int16_t x = rects[i].x;
+		int16_t y = rects[i].y;
+		int16_t w = min<int16_t>(rects[i].w, panel->width() - x);
+		int16_t h = min<int16_t>(rects[i].h, panel->height() - y);
+		if (w <= 0 || h <= 0) continue;
+		
+		transferQueue.enqueue(canvasMask, x, y, w, h, frameBuffer->row(y) + x, frameBuffer->width());
+		
+		flushStats.rects++;
+		flushStats.pixels += (uint32_t)w * h;
+		flushStats.bytes += (uint32_t)w * h * 2 + FrameBuffer::ADDR_WINDOW_BYTES;
+	}
+	flushStats.frames++;
+}
+
+FlushStats DisplayManager::getFlushStats() {
+	return flushStats;
+}
+
+void DisplayManager::resetFlushStats() {
+	flushStats = {0, 0, 0, 0};
+	transferQueue.resetStats();
+}
+
+SpiQueueStats DisplayManager::getTransferStats() {
+	return transferQueue.getStats();
+}
+
+AnimationStats DisplayManager::getAnimationStats() {
+	return animationStats;
 }
 
 void DisplayManager::update() {
 	if (!displaysInitialized) return;
+	METRIC_SCOPE(METRIC_DISPLAY_UPDATE);
 	
-	// Update displays periodically
-	unsigned long now = millis();
-	if (now - lastUpdate >= 50) {  // 20 FPS update rate
-		
-		if (DemoManager::isDemoActive()) {
-			// Update demo mode animations
-			for (int i = 0; i < 8; i++) {
-				// Add subtle animation effects in demo mode
-				if ((now / 100) % 20 == i) {  // Staggered updates
-					showSparkleEffect(i);
+	// Transitions draw at most a display per step and give way to input
+	stepTransition();
+	
+	// Re-declare screens bound to demo data when DemoManager publishes. The
+	// snapshots were taken at the start of the frame and hold still until
+	// the next one, so everything below reads the same state.
+	const DemoSnapshot& demo = DemoManager::readSnapshot();
+	if (demo.version != demoVersion) {
+		demoVersion = demo.version;
+		for (int i = 0; i < 8; i++) {
+			refreshScene(i);
+		}
+	}
+	
+	// Likewise task screens when TaskManager does
+	const TaskSnapshot& tasks = TaskManager::readSnapshot();
+	if (tasks.version != taskVersion) {
+		taskVersion = tasks.version;
+		for (int i = 0; i < 8; i++) {
+			if (scenes[i].screen() == SCREEN_TASK) declareTaskScreen(i);
+		}
+	}
+	
+	// Demo sparkles move on when their next frame is due
+	stepAnimation(demo);
+	
+	// Repaint invalidated scene regions while the tick has budget, starting
+	// where the last tick stopped
+	for (int n = 0; n < 8 && FrameScheduler::hasBudget(); n++) {
+		renderScene(renderCursor);
+		renderCursor = (renderCursor + 1) % 8;
+	}
+	
+	// Push whatever was composed
+	flushCanvas();
+	transferQueue.pump();
+	
+	// Close this tick's chip-select accounting
+	BusArbiter::endFrame();
+}
+
+void DisplayManager::claimCanvas(int displayIndex) {
+	leaveBroadcast(displayIndex);
+	if (canvasDisplay != displayIndex) {
+		flushCanvas();
+		canvasDisplay = displayIndex;
+	}
+	canvasMask = targetMask(displayIndex);
+}
+
+void DisplayManager::refreshScene(int displayIndex) {
+	uint16_t screen = scenes[displayIndex].screen();
+	if (screen == SCREEN_FAMILY) {
+		showDemoFamily(displayIndex);
+	} else if (screen >= SCREEN_PERSON && screen < SCREEN_PERSON + 2) {
+		showDemoPersonSummary(displayIndex, screen - SCREEN_PERSON);
+	}
+}
+
+void DisplayManager::renderScene(int displayIndex) {
+	Scene& scene = scenes[displayIndex];
+	if (!scene.needsRender()) return;
+	
+	// Displays declared the same are rendered with this one and flushed
+	// together; the canvas only ever holds this display's picture
+	uint16_t mirrors = canvas ? matchingScenes(displayIndex) : 0;
+	
+	if (!canvas) {
+		// No canvas to clip in, so repaint the whole panel
+		Adafruit_GFX* gfx = beginDraw(displayIndex);
+		gfx->fillScreen(scene.background());
+		endDraw();
+		for (int id = 0; id < scene.nodeCount(); id++) {
+			drawSceneNode(displayIndex, id);
+		}
+	} else if (scene.needsFullRepaint() || canvasDisplay != displayIndex) {
+		// The canvas doesn't hold this display: rebuild it in RAM. The tile
+		// signatures still limit the flush to what actually changed.
+		claimCanvas(displayIndex);
+		canvas->fillScreen(scene.background());
+		for (int id = 0; id < scene.nodeCount(); id++) {
+			drawSceneNode(displayIndex, id);
+		}
+	} else {
+		// Repaint each invalidated region with every node that overlaps it
+		for (int i = 0; i < scene.getDirtyCount(); i++) {
+			const DirtyRect& region = scene.getDirty(i);
+			frameBuffer->setClip(region.x, region.y, region.w, region.h);
+			canvas->fillRect(region.x, region.y, region.w, region.h, scene.background());
+			for (int id = 0; id < scene.nodeCount(); id++) {
+				DirtyRect b = scene.bounds(id);
+				if (b.x < region.x + region.w && region.x < b.x + b.w &&
+				    b.y < region.y + region.h && region.y < b.y + b.h) {
+					drawSceneNode(displayIndex, id);
 				}
 			}
+			frameBuffer->clearClip();
+		}
+	}
+	scene.clearDirty();
+	
+	if (mirrors) {
+		canvasMask |= mirrors;
+		flushCanvas();
+		canvasMask = targetMask(displayIndex);
+		for (int i = 0; i < 8; i++) {
+			if (mirrors & (1u << i)) scenes[i].clearDirty();
 		}
-		
-		lastUpdate = now;
+	}
+}
+
+void DisplayManager::drawSceneNode(int displayIndex, int nodeId) {
+	const Scene& scene = scenes[displayIndex];
+	const SceneNode& node = scene.node(nodeId);
+	if (!node.visible) return;
+	
+	switch (node.type) {
+		case SCENE_RECT: {
+			Adafruit_GFX* gfx = beginDraw(displayIndex);
+			gfx->fillRect(node.x, node.y, node.w, node.h, node.colour);
+			endDraw();
+			break;
+		}
+		case SCENE_TEXT: {
+			// Scene bounds already hold the aligned position
+			DirtyRect b = scene.bounds(nodeId);
+			drawTextSpan(displayIndex, node.text.c_str(), node.text.length(), b.x, b.y, node.colour, node.size);
+			break;
+		}
+		case SCENE_ICON:
+			drawPattern(displayIndex, node.pattern, node.colour, node.x, node.y, node.size);
+			break;
+		case SCENE_PROGRESS:
+			drawProgressBar(displayIndex, node.value, node.colour, node.x, node.y, node.w, node.h);
+			break;
+		case SCENE_COUNTER: {
+			// Each digit centred in its cell, then the suffix
+			DirtyRect b = scene.bounds(nodeId);
+			char digits[Scene::MAX_COUNTER_DIGITS];
+			Scene::counterDigits(node, digits);
+			int16_t pitch = Scene::counterPitch(node.size);
+			int cellWidth = TextEngine::digitWidth(node.size);
+			for (int i = 0; i < node.pattern; i++) {
+				if (digits[i] == ' ') continue;
+				int inset = (cellWidth - TextEngine::measure(&digits[i], 1, node.size)) / 2;
+				drawTextSpan(displayIndex, &digits[i], 1, b.x + i * pitch + inset, b.y, node.colour, node.size);
+			}
+			if (node.text.length()) {
+				drawTextSpan(displayIndex, node.text.c_str(), node.text.length(), b.x + node.pattern * pitch, b.y,
+				             node.colour, node.size);
+			}
+			break;
+		}
+		default:
+			break;
 	}
 }
 
 void DisplayManager::showDemoActivationProgress(int progress) {
-	if (!displaysInitialized) return;
+	if (!displaysInitialized || isAnimating()) return;
+	progress = constrain(progress, 0, 100);
+	
+	// Same whole percent as last time: nothing to declare
+	if (progress == activationProgress) {
+		bool shown = true;
+		for (int i = 0; i < 8; i++) {
+			if (scenes[i].screen() != SCREEN_ACTIVATION) shown = false;
+		}
+		if (shown) return;
+	}
+	activationProgress = progress;
 	
-	// Show progress on all displays
+	// Show progress on all displays; the bar fill, changed digits and star
+	// are all that get repainted
 	for (int i = 0; i < 8; i++) {
-		clearDisplay(i, DemoColours::BLACK);
+		Scene& scene = scenes[i];
+		scene.begin(SCREEN_ACTIVATION, DemoColours::BLACK);
 		
-		drawCenteredText(i, "DEMO MODE", 60, DemoColours::YELLOW, 2);
-		drawCenteredText(i, "Hold buttons...", 90, DemoColours::WHITE, 1);
+		scene.text(0, 60, "DEMO MODE", DemoColours::YELLOW, 2, ALIGN_CENTRE);
+		scene.text(0, 90, "Hold buttons...", DemoColours::WHITE, 1, ALIGN_CENTRE);
 		
 		// Progress bar
 		int barWidth = DISPLAY_WIDTH - 40;
@@ -118,74 +454,164 @@ void DisplayManager::showDemoActivationProgress(int progress) {
 		int barX = 20;
 		int barY = 120;
 		
-		drawProgressBar(i, progress, DemoColours::GREEN, barX, barY, barWidth, barHeight);
+		scene.progress(barX, barY, barWidth, barHeight, progress, DemoColours::GREEN);
 		
-		// Percentage text
-		String progressText = String(progress) + "%";
-		drawCenteredText(i, progressText, 160, DemoColours::CYAN, 1);
+		// Percentage
+		scene.counter(0, 160, progress, 3, "%", DemoColours::CYAN, 1, ALIGN_CENTRE);
 		
 		// Animated pattern
 		int patternSize = 15 + (progress / 10);
-		drawPattern(i, DemoPatterns::STAR, DemoColours::GOLD, DISPLAY_WIDTH/2, 200, patternSize);
+		scene.icon(DemoPatterns::STAR, DISPLAY_WIDTH/2, 200, patternSize, DemoColours::GOLD);
+		scene.end();
 	}
 }
 
 void DisplayManager::clearDemoActivationProgress() {
-	if (!displaysInitialized) return;
+	if (!displaysInitialized || isAnimating()) return;
 	
 	// Clear progress display and return to normal content
 	for (int i = 0; i < 8; i++) {
-		clearDisplay(i, DemoColours::BLACK);
-		drawCenteredText(i, "Ready", 160, DemoColours::GREEN, 1);
+		Scene& scene = scenes[i];
+		scene.begin(SCREEN_READY, DemoColours::BLACK);
+		scene.text(0, 160, "Ready", DemoColours::GREEN, 1, ALIGN_CENTRE);
+		scene.end();
 	}
 }
 
 void DisplayManager::showDemoModeActivation() {
 	if (!displaysInitialized) return;
 	
-	Serial.println("🎮 Showing demo mode activation animation!");
+	LOG_INFO(MODULE_DISPLAY, "🎮 Showing demo mode activation animation!\n");
 	
-	// Rainbow cascade animation
-	for (int phase = 0; phase < 8; phase++) {
-		for (int i = 0; i < 8; i++) {
-			uint16_t colour = DemoManager::DEMO_COLOURS[i % DemoManager::DEMO_COLOUR_COUNT];
-			
-			clearDisplay(i, colour);
-			drawCenteredText(i, "DEMO", 80, DemoColours::BLACK, 3);
-			drawCenteredText(i, "MODE", 120, DemoColours::BLACK, 3);
-			drawCenteredText(i, "ACTIVE!", 160, DemoColours::WHITE, 2);
+	// A different colour on every display
+	endBroadcast();
+	
+	// Rainbow cascade, played out by update()
+	transition = TRANSITION_DEMO_ACTIVATION;
+	transitionPhase = 0;
+	transitionDisplay = 0;
+	transitionResumeAt = millis();
+}
+
+void DisplayManager::showExitingDemoMode() {
+	if (!displaysInitialized) return;
+	
+	// Exit screen, held for a second before clearing - played out by update().
+	// Every display shows the same, so each phase is drawn and sent once.
+	beginBroadcast(ALL_DISPLAYS);
+	transition = TRANSITION_DEMO_EXIT;
+	transitionPhase = 0;
+	transitionDisplay = 0;
+	transitionResumeAt = millis();
+}
+
+bool DisplayManager::isAnimating() {
+	return transition != TRANSITION_NONE;
+}
+
+void DisplayManager::stepTransition() {
+	while (transition != TRANSITION_NONE && (long)(millis() - transitionResumeAt) >= 0) {
+		int i = transitionDisplay;
+		
+		if (transition == TRANSITION_DEMO_ACTIVATION) {
+			// Retained from here on, so the sparkles can move over it
+			declareDemoScreen(i);
+			renderScene(i);
+		} else if (transitionPhase == 0) {
+			clearDisplay(i, DemoColours::PURPLE);
+			drawCenteredText(i, "Exiting", 100, DemoColours::WHITE, 2);
+			drawCenteredText(i, "Demo Mode", 130, DemoColours::WHITE, 2);
+			drawPattern(i, DemoPatterns::CIRCLE, DemoColours::CYAN, DISPLAY_WIDTH/2, 200, 25);
+		} else {
+			// Clear to normal display
+			clearDisplay(i, DemoColours::BLACK);
+		}
+		
+		// One draw covers a broadcast phase
+		if (targetMask(i) == ALL_DISPLAYS) transitionDisplay = 7;
+		if (++transitionDisplay == 8) {
+			flushCanvas();
+			transitionDisplay = 0;
+			transitionPhase++;
 			
-			// Add sparkle pattern
-			drawPattern(i, DemoPatterns::STAR, DemoColours::WHITE, 50, 200, 20);
-			drawPattern(i, DemoPatterns::HEART, DemoColours::PINK, DISPLAY_WIDTH-50, 200, 20);
+			if (transition == TRANSITION_DEMO_ACTIVATION) {
+				transitionResumeAt = millis() + ACTIVATION_PHASE_MS;
+				if (transitionPhase == ACTIVATION_PHASES) transition = TRANSITION_NONE;
+			} else {
+				transitionResumeAt = millis() + EXIT_HOLD_MS;
+				if (transitionPhase == 2) {
+					transition = TRANSITION_NONE;
+					endBroadcast();
+				}
+			}
 		}
-		delay(200);
+		
+		if (!FrameScheduler::hasBudget()) break;
 	}
 }
 
-void DisplayManager::showExitingDemoMode() {
-	if (!displaysInitialized) return;
+void DisplayManager::declareDemoScreen(int displayIndex) {
+	// A different colour on every display
+	uint16_t colour = DemoManager::DEMO_COLOURS[displayIndex % DemoManager::DEMO_COLOUR_COUNT];
 	
-	// Show exit animation
-	for (int i = 0; i < 8; i++) {
-		clearDisplay(i, DemoColours::PURPLE);
-		drawCenteredText(i, "Exiting", 100, DemoColours::WHITE, 2);
-		drawCenteredText(i, "Demo Mode", 130, DemoColours::WHITE, 2);
-		drawPattern(i, DemoPatterns::CIRCLE, DemoColours::CYAN, DISPLAY_WIDTH/2, 200, 25);
+	Scene& scene = scenes[displayIndex];
+	scene.begin(SCREEN_DEMO, colour);
+	scene.text(0, 80, "DEMO", DemoColours::BLACK, 3, ALIGN_CENTRE);
+	scene.text(0, 120, "MODE", DemoColours::BLACK, 3, ALIGN_CENTRE);
+	scene.text(0, 160, "ACTIVE!", DemoColours::WHITE, 2, ALIGN_CENTRE);
+	scene.icon(DemoPatterns::STAR, 50, 200, 20, DemoColours::WHITE);
+	scene.icon(DemoPatterns::HEART, DISPLAY_WIDTH-50, 200, 20, DemoColours::PINK);
+	
+	// Sparkles last, so they pass over everything else
+	const DemoSnapshot& demo = DemoManager::readSnapshot();
+	int frame = DemoAnimation::frameAt(millis() - demo.startTime);
+	for (int s = 0; s < DemoAnimation::SPRITE_COUNT; s++) {
+		SpriteFrame sparkle = sparkleAt(displayIndex, frame, s);
+		int id = scene.icon(DemoAnimation::spritePattern(s), sparkle.x, sparkle.y, sparkle.size, sparkle.colour);
+		if (s == 0) sparkleNodes[displayIndex] = id;
 	}
-	delay(1000);
+	scene.end();
+}
+
+SpriteFrame DisplayManager::sparkleAt(int displayIndex, int frame, int sprite) {
+	// Each display plays the loop from its own point, odd ones mirrored
+	int count = DemoAnimation::getFrameCount();
+	SpriteFrame sparkle = DemoAnimation::sprite((frame + displayIndex * count / 8) % count, sprite);
+	if (displayIndex & 1) sparkle.x = DISPLAY_WIDTH - sparkle.x;
+	return sparkle;
+}
+
+void DisplayManager::stepAnimation(const DemoSnapshot& demo) {
+	if (!demo.active) {
+		animationFrame = -1;
+		return;
+	}
+	
+	// Nothing to do until the clock reaches the next frame; a late call
+	// goes straight to the one due
+	int frame = DemoAnimation::frameAt(millis() - demo.startTime);
+	if (frame == animationFrame) return;
+	if (animationFrame >= 0) {
+		int count = DemoAnimation::getFrameCount();
+		animationStats.skipped += (frame - animationFrame - 1 + count) % count;
+	}
+	animationFrame = frame;
+	animationStats.frames++;
 	
-	// Clear to normal display
+	// Each move invalidates the sparkle's old and new bounds, and only
+	// those regions are repainted
 	for (int i = 0; i < 8; i++) {
-		clearDisplay(i, DemoColours::BLACK);
+		if (scenes[i].screen() != SCREEN_DEMO) continue;
+		for (int s = 0; s < DemoAnimation::SPRITE_COUNT; s++) {
+			SpriteFrame sparkle = sparkleAt(i, frame, s);
+			scenes[i].setIcon(sparkleNodes[i] + s, sparkle.x, sparkle.y, sparkle.size, sparkle.colour);
+		}
 	}
 }
 
 void DisplayManager::showDemoContent(int displayIndex, int columnIndex, int position) {
 	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
 	
-	clearDisplay(displayIndex, DemoColours::BLACK);
-	
 	// Show different content based on column
 	switch (columnIndex) {
 		case 0:  // Emma
@@ -201,68 +627,63 @@ void DisplayManager::showDemoContent(int displayIndex, int columnIndex, int posi
 			showDemoFamily(displayIndex);
 			break;
 		default:
+			clearDisplay(displayIndex, DemoColours::BLACK);
 			drawCenteredText(displayIndex, "Demo", 160, DemoColours::WHITE, 2);
 			break;
 	}
 }
 
 void DisplayManager::showDemoPersonSummary(int displayIndex, int personIndex) {
-	DemoPerson* person = DemoManager::getDemoPerson(personIndex);
-	if (!person) return;
+	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
 	
-	// Header with person name and theme colour
-	clearDisplay(displayIndex, DemoColours::BLACK);
+	if (personIndex < 0 || personIndex >= 2) return;
+	const DemoPerson* person = &DemoManager::readSnapshot().persons[personIndex];
 	
-	// Name banner
-	fillDisplay(displayIndex, person->themeColour);
-	drawCenteredText(displayIndex, person->name, 25, DemoColours::WHITE, 3);
+	// Name banner in the person's theme colour
+	Scene& scene = scenes[displayIndex];
+	scene.begin(SCREEN_PERSON + personIndex, person->themeColour);
+	scene.text(0, 25, person->name, DemoColours::WHITE, 3, ALIGN_CENTRE);
 	
 	// Avatar pattern
-	drawPattern(displayIndex, person->avatar, DemoColours::WHITE, 30, 25, 25);
+	scene.icon(person->avatar, 30, 25, 25, DemoColours::WHITE);
 	
 	// Task summary area
 	int y = 70;
-	selectDisplay(displayIndex);
-	displays[displayIndex]->fillRect(0, y, DISPLAY_WIDTH, DISPLAY_HEIGHT-y, DemoColours::BLACK);
+	scene.rect(0, y, DISPLAY_WIDTH, DISPLAY_HEIGHT - y, DemoColours::BLACK);
 	
 	// Show first few tasks with colours and patterns
 	for (int i = 0; i < min(4, person->taskCount); i++) {
-		DemoTask& task = person->tasks[i];
+		const DemoTask& task = person->tasks[i];
 		int taskY = y + 15 + i * 35;
 		
 		// Task status indicator
 		uint16_t statusColour = task.isCompleted ? DemoColours::GREEN : task.colour;
-		drawPattern(displayIndex, task.iconPattern, statusColour, 20, taskY, 15);
+		scene.icon(task.iconPattern, 20, taskY, 15, statusColour);
 		
 		// Task name
 		uint16_t textColour = task.isCompleted ? DemoColours::GREY : DemoColours::WHITE;
 		String taskText = task.name;
 		if (task.isCompleted) taskText += " ✓";
-		
-		selectDisplay(displayIndex);
-		displays[displayIndex]->setCursor(45, taskY - 5);
-		displays[displayIndex]->setTextColor(textColour);
-		displays[displayIndex]->setTextSize(1);
-		displays[displayIndex]->print(taskText);
+		scene.text(45, taskY - 5, taskText, textColour);
 	}
 	
 	// Progress summary
-	int completed = DemoManager::getCompletedTaskCount(personIndex);
-	int total = DemoManager::getTotalTaskCount(personIndex);
+	int completed = 0;
+	int total = person->taskCount;
+	for (int i = 0; i < total; i++) {
+		if (person->tasks[i].isCompleted) completed++;
+	}
 	String summary = String(completed) + "/" + String(total) + " done";
-	
-	drawCenteredText(displayIndex, summary, DISPLAY_HEIGHT - 30, DemoColours::CYAN, 1);
+	scene.text(0, DISPLAY_HEIGHT - 30, summary, DemoColours::CYAN, 1, ALIGN_CENTRE);
 	
 	// Progress bar
-	int progress = (completed * 100) / total;
-	drawProgressBar(displayIndex, progress, DemoColours::GREEN, 20, DISPLAY_HEIGHT - 15, DISPLAY_WIDTH - 40, 8);
-	
-	deselectAllDisplays();
+	int progress = total > 0 ? (completed * 100) / total : 0;
+	scene.progress(20, DISPLAY_HEIGHT - 15, DISPLAY_WIDTH - 40, 8, progress, DemoColours::GREEN);
+	scene.end();
 }
 
 void DisplayManager::showDemoWeather(int displayIndex) {
-	DemoWeather* weather = DemoManager::getDemoWeather();
-	if (!weather) return;
+	const DemoWeather* weather = &DemoManager::readSnapshot().weather;
 	
 	clearDisplay(displayIndex, DemoColours::CYAN);
 	
@@ -288,44 +709,50 @@ void DisplayManager::showDemoWeather(int displayIndex) {
 }
 
 void DisplayManager::showDemoFamily(int displayIndex) {
-	clearDisplay(displayIndex, DemoColours::PURPLE);
+	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
+	
+	Scene& scene = scenes[displayIndex];
+	scene.begin(SCREEN_FAMILY, DemoColours::PURPLE);
 	
 	// Family header
-	drawCenteredText(displayIndex, "Family", 25, DemoColours::WHITE, 2);
+	scene.text(0, 25, "Family", DemoColours::WHITE, 2, ALIGN_CENTRE);
 	
 	// Show family events
-	DemoFamily* events = DemoManager::getDemoFamily();
+	const DemoFamily* events = DemoManager::readSnapshot().family;
 	int y = 70;
 	
-	for (int i = 0; i < 4 && i < 4; i++) {  // Show up to 4 events
-		DemoFamily& event = events[i];
+	for (int i = 0; i < 4; i++) {  // Show up to 4 events
+		const DemoFamily& event = events[i];
 		int eventY = y + i * 50;
 		
 		// Event icon
 		uint16_t iconColour = event.isActive ? event.colour : DemoColours::GREY;
-		drawPattern(displayIndex, event.icon, iconColour, 20, eventY, 20);
+		scene.icon(event.icon, 20, eventY, 20, iconColour);
 		
 		// Event text
 		uint16_t textColour = event.isActive ? DemoColours::WHITE : DemoColours::GREY;
-		
-		selectDisplay(displayIndex);
-		displays[displayIndex]->setCursor(50, eventY - 10);
-		displays[displayIndex]->setTextColor(textColour);
-		displays[displayIndex]->setTextSize(1);
-		displays[displayIndex]->print(event.event);
-		
-		displays[displayIndex]->setCursor(50, eventY + 5);
-		displays[displayIndex]->setTextColor(DemoColours::CYAN);
-		displays[displayIndex]->print(event.time);
-		deselectAllDisplays();
+		scene.text(50, eventY - 10, event.event, textColour);
+		scene.text(50, eventY + 5, event.time, DemoColours::CYAN);
 	}
 	
 	// Decorative hearts
-	drawPattern(displayIndex, DemoPatterns::HEART, DemoColours::PINK, DISPLAY_WIDTH/2, 280, 25);
+	scene.icon(DemoPatterns::HEART, DISPLAY_WIDTH/2, 280, 25, DemoColours::PINK);
+	scene.end();
 }
 
 void DisplayManager::drawPattern(int displayIndex, uint8_t patternId, uint16_t colour, int x, int y, int size) {
 	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
+	METRIC_SCOPE(METRIC_DRAW_PATTERN);
+	
+	// Atlas sizes are blitted from flash; anything else is drawn below
+	const IconMask* mask = IconAtlas::find(patternId, size);
+	if (!mask && patternId >= 16) {
+		mask = IconAtlas::find(DemoPatterns::CIRCLE, size);
+	}
+	if (mask) {
+		drawIcon(displayIndex, *mask, x, y, colour);
+		return;
+	}
 	
 	switch (patternId) {
 		case DemoPatterns::STAR: drawStar(displayIndex, x, y, size, colour); break;
@@ -348,59 +775,148 @@ void DisplayManager::drawPattern(int displayIndex, uint8_t patternId, uint16_t c
 	}
 }
 
+void DisplayManager::drawIcon(int displayIndex, const IconMask& mask, int x, int y, uint16_t colour) {
+	int left = x + mask.offsetX;
+	int top = y + mask.offsetY;
+	
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
+	if (gfx == canvas) {
+		frameBuffer->drawMask(left, top, mask.width, mask.height, mask.data, colour, DemoColours::BLACK);
+		endDraw();
+		return;
+	}
+	
+	// Straight to the panel: one horizontal run per stretch of equal pixels
+	gfx->startWrite();
+	for (int row = 0; row < mask.height; row++) {
+		int col = 0;
+		while (col < mask.width) {
+			uint8_t value = IconAtlas::pixel(mask, col, row);
+			int run = 1;
+			while (col + run < mask.width && IconAtlas::pixel(mask, col + run, row) == value) {
+				run++;
+			}
+			if (value != IconAtlas::TRANSPARENT) {
+				uint16_t runColour = (value == IconAtlas::PRIMARY) ? colour : DemoColours::BLACK;
+				gfx->writeFastHLine(left + col, top + row, run, runColour);
+			}
+			col += run;
+		}
+	}
+	gfx->endWrite();
+	endDraw();
+}
+
 void DisplayManager::drawProgressBar(int displayIndex, int progress, uint16_t colour, int x, int y, int width, int height) {
 	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
 	
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	
 	// Background
-	displays[displayIndex]->fillRect(x, y, width, height, DemoColours::GREY);
+	gfx->fillRect(x, y, width, height, DemoColours::GREY);
 	
 	// Progress fill
 	int fillWidth = (progress * width) / 100;
-	displays[displayIndex]->fillRect(x, y, fillWidth, height, colour);
+	gfx->fillRect(x, y, fillWidth, height, colour);
 	
 	// Border
-	displays[displayIndex]->drawRect(x, y, width, height, DemoColours::WHITE);
+	gfx->drawRect(x, y, width, height, DemoColours::WHITE);
 	
-	deselectAllDisplays();
+	endDraw();
 }
 
-void DisplayManager::drawCenteredText(int displayIndex, const String& text, int y, uint16_t colour, uint8_t textSize) {
+void DisplayManager::drawText(int displayIndex, const String& text, int x, int y, uint16_t colour, uint8_t textSize) {
 	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
 	
-	selectDisplay(displayIndex);
-	
-	displays[displayIndex]->setTextSize(textSize);
-	displays[displayIndex]->setTextColor(colour);
-	
-	// Calculate text width for centering
-	int textWidth = text.length() * 6 * textSize;  // Approximate
-	int x = (DISPLAY_WIDTH - textWidth) / 2;
-	
-	displays[displayIndex]->setCursor(x, y);
-	displays[displayIndex]->print(text);
+	drawTextSpan(displayIndex, text.c_str(), text.length(), x, y, colour, textSize);
+}
+
+void DisplayManager::drawCenteredText(int displayIndex, const String& text, int y, uint16_t colour, uint8_t textSize) {
+	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
 	
-	deselectAllDisplays();
+	int x = (DISPLAY_WIDTH - getTextWidth(text, textSize)) / 2;
+	drawTextSpan(displayIndex, text.c_str(), text.length(), x, y, colour, textSize);
 }
 
 void DisplayManager::drawWrappedText(int displayIndex, const String& text, int x, int y, int maxWidth, uint16_t colour, uint8_t textSize) {
 	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
 	
-	selectDisplay(displayIndex);
-	displays[displayIndex]->setTextSize(textSize);
-	displays[displayIndex]->setTextColor(colour);
-	displays[displayIndex]->setCursor(x, y);
-	displays[displayIndex]->print(text);  // Simple implementation for now
-	deselectAllDisplays();
+	// Never more lines than fit below y
+	const int MAX_LINES = 16;
+	TextSpan lines[MAX_LINES];
+	int lineHeight = LINE_HEIGHT * textSize;
+	int maxLines = constrain((DISPLAY_HEIGHT - y) / lineHeight, 0, MAX_LINES);
+	
+	int lineCount = TextEngine::wrap(text, maxWidth, textSize, lines, maxLines);
+	for (int i = 0; i < lineCount; i++) {
+		drawTextSpan(displayIndex, text.c_str() + lines[i].start, lines[i].length,
+		             x, y + i * lineHeight, colour, textSize);
+	}
+}
+
+int DisplayManager::getTextWidth(const String& text, uint8_t textSize) {
+	return TextEngine::measure(text, textSize);
+}
+
+int DisplayManager::getTextHeight(uint8_t textSize) {
+	return TextEngine::GLYPH_ROWS * textSize;
+}
+
+void DisplayManager::drawTextSpan(int displayIndex, const char* text, int length, int x, int y, uint16_t colour, uint8_t textSize) {
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
+	if (gfx != canvas) gfx->startWrite();
+	
+	while (length > 0) {
+		TextRun run = TextEngine::layout(text, length);
+		
+		if (gfx == canvas) {
+			frameBuffer->drawColumns(x, y, run.columns, run.width, textSize, colour);
+		} else {
+			// Straight to the panel: one block per horizontal stretch of ink in each row
+			for (int row = 0; row < TextEngine::GLYPH_ROWS; row++) {
+				uint8_t bit = 1 << row;
+				int col = 0;
+				while (col < run.width) {
+					if (!(run.columns[col] & bit)) { col++; continue; }
+					int start = col;
+					while (col < run.width && (run.columns[col] & bit)) col++;
+					gfx->writeFillRect(x + start * textSize, y + row * textSize,
+					                   (col - start) * textSize, textSize, colour);
+				}
+			}
+		}
+		
+		// Runs are capped in width; carry on after a one-column gap
+		x += (run.width + 1) * textSize;
+		text += run.consumed;
+		length -= run.consumed;
+	}
+	
+	if (gfx != canvas) gfx->endWrite();
+	endDraw();
 }
 
 void DisplayManager::clearDisplay(int displayIndex, uint16_t backgroundColour) {
 	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
 	
-	selectDisplay(displayIndex);
-	displays[displayIndex]->fillScreen(backgroundColour);
-	deselectAllDisplays();
+	// An imperative screen replaces whatever scene was retained here, and
+	// on every display a broadcast from here reaches
+	leaveBroadcast(displayIndex);
+	for (uint16_t mask = targetMask(displayIndex); mask; mask &= mask - 1) {
+		scenes[__builtin_ctz(mask)].reset();
+	}
+	
+	if (canvas) {
+		// A full clear makes the whole canvas valid for this display, so it
+		// can take over the canvas and the redraw happens in RAM
+		claimCanvas(displayIndex);
+		canvas->fillScreen(backgroundColour);
+		return;
+	}
+	
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
+	gfx->fillScreen(backgroundColour);
+	endDraw();
 }
 
 void DisplayManager::fillDisplay(int displayIndex, uint16_t colour) {
@@ -408,169 +924,156 @@ void DisplayManager::fillDisplay(int displayIndex, uint16_t colour) {
 }
 
 // Simple pattern implementations (basic geometric shapes)
+// These are the fallback for sizes outside the icon atlas; tools/gen_icon_atlas.py
+// rasterises the same shapes, so keep the two in sync.
 void DisplayManager::drawStar(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	// Simple 5-pointed star approximation using triangles
 	for (int i = 0; i < 5; i++) {
 		float angle = i * 2 * PI / 5;
 		int x1 = x + cos(angle) * size;
 		int y1 = y + sin(angle) * size;
-		displays[displayIndex]->drawLine(x, y, x1, y1, colour);
+		gfx->drawLine(x, y, x1, y1, colour);
 	}
-	deselectAllDisplays();
+	endDraw();
 }
 
 void DisplayManager::drawHeart(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	// Simple heart using circles and triangle
 	int halfSize = size / 2;
-	displays[displayIndex]->fillCircle(x - halfSize/2, y - halfSize/2, halfSize/2, colour);
-	displays[displayIndex]->fillCircle(x + halfSize/2, y - halfSize/2, halfSize/2, colour);
-	displays[displayIndex]->fillTriangle(x - halfSize, y, x + halfSize, y, x, y + halfSize, colour);
-	deselectAllDisplays();
+	gfx->fillCircle(x - halfSize/2, y - halfSize/2, halfSize/2, colour);
+	gfx->fillCircle(x + halfSize/2, y - halfSize/2, halfSize/2, colour);
+	gfx->fillTriangle(x - halfSize, y, x + halfSize, y, x, y + halfSize, colour);
+	endDraw();
 }
 
 void DisplayManager::drawCircle(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
-	displays[displayIndex]->fillCircle(x, y, size/2, colour);
-	deselectAllDisplays();
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
+	gfx->fillCircle(x, y, size/2, colour);
+	endDraw();
 }
 
 void DisplayManager::drawSquare(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
-	displays[displayIndex]->fillRect(x - size/2, y - size/2, size, size, colour);
-	deselectAllDisplays();
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
+	gfx->fillRect(x - size/2, y - size/2, size, size, colour);
+	endDraw();
 }
 
 void DisplayManager::drawTriangle(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
-	displays[displayIndex]->fillTriangle(x, y - size/2, x - size/2, y + size/2, x + size/2, y + size/2, colour);
-	deselectAllDisplays();
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
+	gfx->fillTriangle(x, y - size/2, x - size/2, y + size/2, x + size/2, y + size/2, colour);
+	endDraw();
 }
 
 void DisplayManager::drawCross(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	int halfSize = size / 2;
-	displays[displayIndex]->drawLine(x - halfSize, y, x + halfSize, y, colour);
-	displays[displayIndex]->drawLine(x, y - halfSize, x, y + halfSize, colour);
-	deselectAllDisplays();
+	gfx->drawLine(x - halfSize, y, x + halfSize, y, colour);
+	gfx->drawLine(x, y - halfSize, x, y + halfSize, colour);
+	endDraw();
 }
 
 void DisplayManager::drawDiamond(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	int halfSize = size / 2;
-	displays[displayIndex]->fillTriangle(x, y - halfSize, x - halfSize, y, x + halfSize, y, colour);
-	displays[displayIndex]->fillTriangle(x - halfSize, y, x, y + halfSize, x + halfSize, y, colour);
-	deselectAllDisplays();
+	gfx->fillTriangle(x, y - halfSize, x - halfSize, y, x + halfSize, y, colour);
+	gfx->fillTriangle(x - halfSize, y, x, y + halfSize, x + halfSize, y, colour);
+	endDraw();
 }
 
 void DisplayManager::drawFlower(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	// Simple flower with petals
 	int petalSize = size / 3;
-	displays[displayIndex]->fillCircle(x, y, petalSize, colour);  // Center
+	gfx->fillCircle(x, y, petalSize, colour);  // Center
 	for (int i = 0; i < 6; i++) {
 		float angle = i * PI / 3;
 		int px = x + cos(angle) * petalSize;
 		int py = y + sin(angle) * petalSize;
-		displays[displayIndex]->fillCircle(px, py, petalSize/2, colour);
+		gfx->fillCircle(px, py, petalSize/2, colour);
 	}
-	deselectAllDisplays();
+	endDraw();
 }
 
 void DisplayManager::drawSun(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	// Sun with rays
-	displays[displayIndex]->fillCircle(x, y, size/3, colour);
+	gfx->fillCircle(x, y, size/3, colour);
 	for (int i = 0; i < 8; i++) {
 		float angle = i * PI / 4;
 		int x1 = x + cos(angle) * size/2;
 		int y1 = y + sin(angle) * size/2;
 		int x2 = x + cos(angle) * size;
 		int y2 = y + sin(angle) * size;
-		displays[displayIndex]->drawLine(x1, y1, x2, y2, colour);
+		gfx->drawLine(x1, y1, x2, y2, colour);
 	}
-	deselectAllDisplays();
+	endDraw();
 }
 
 void DisplayManager::drawCloud(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	// Cloud made of overlapping circles
 	int cloudSize = size / 4;
-	displays[displayIndex]->fillCircle(x - cloudSize, y, cloudSize, colour);
-	displays[displayIndex]->fillCircle(x, y - cloudSize/2, cloudSize, colour);
-	displays[displayIndex]->fillCircle(x + cloudSize, y, cloudSize, colour);
-	displays[displayIndex]->fillCircle(x, y + cloudSize/2, cloudSize*2, colour);
-	deselectAllDisplays();
+	gfx->fillCircle(x - cloudSize, y, cloudSize, colour);
+	gfx->fillCircle(x, y - cloudSize/2, cloudSize, colour);
+	gfx->fillCircle(x + cloudSize, y, cloudSize, colour);
+	gfx->fillCircle(x, y + cloudSize/2, cloudSize*2, colour);
+	endDraw();
 }
 
 // Implement remaining pattern functions with simple geometric approximations
 void DisplayManager::drawRain(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	for (int i = 0; i < 5; i++) {
 		int rx = x + (i - 2) * size/4;
-		displays[displayIndex]->drawLine(rx, y - size/2, rx, y + size/2, colour);
+		gfx->drawLine(rx, y - size/2, rx, y + size/2, colour);
 	}
-	deselectAllDisplays();
+	endDraw();
 }
 
 void DisplayManager::drawSnow(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	// Snowflake pattern
 	int halfSize = size / 2;
-	displays[displayIndex]->drawLine(x - halfSize, y, x + halfSize, y, colour);
-	displays[displayIndex]->drawLine(x, y - halfSize, x, y + halfSize, colour);
-	displays[displayIndex]->drawLine(x - halfSize/2, y - halfSize/2, x + halfSize/2, y + halfSize/2, colour);
-	displays[displayIndex]->drawLine(x - halfSize/2, y + halfSize/2, x + halfSize/2, y - halfSize/2, colour);
-	deselectAllDisplays();
+	gfx->drawLine(x - halfSize, y, x + halfSize, y, colour);
+	gfx->drawLine(x, y - halfSize, x, y + halfSize, colour);
+	gfx->drawLine(x - halfSize/2, y - halfSize/2, x + halfSize/2, y + halfSize/2, colour);
+	gfx->drawLine(x - halfSize/2, y + halfSize/2, x + halfSize/2, y - halfSize/2, colour);
+	endDraw();
 }
 
 void DisplayManager::drawMusic(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	// Musical note
-	displays[displayIndex]->fillCircle(x, y + size/3, size/4, colour);
-	displays[displayIndex]->drawLine(x + size/4, y + size/3, x + size/4, y - size/2, colour);
-	deselectAllDisplays();
+	gfx->fillCircle(x, y + size/3, size/4, colour);
+	gfx->drawLine(x + size/4, y + size/3, x + size/4, y - size/2, colour);
+	endDraw();
 }
 
 void DisplayManager::drawBook(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	// Book representation
-	displays[displayIndex]->fillRect(x - size/2, y - size/3, size, size*2/3, colour);
-	displays[displayIndex]->drawLine(x, y - size/3, x, y + size/3, DemoColours::BLACK);
-	deselectAllDisplays();
+	gfx->fillRect(x - size/2, y - size/3, size, size*2/3, colour);
+	gfx->drawLine(x, y - size/3, x, y + size/3, DemoColours::BLACK);
+	endDraw();
 }
 
 void DisplayManager::drawGame(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	// Game controller approximation
-	displays[displayIndex]->fillRect(x - size/2, y - size/4, size, size/2, colour);
-	displays[displayIndex]->fillCircle(x - size/3, y, size/6, DemoColours::BLACK);
-	displays[displayIndex]->fillCircle(x + size/3, y, size/6, DemoColours::BLACK);
-	deselectAllDisplays();
+	gfx->fillRect(x - size/2, y - size/4, size, size/2, colour);
+	gfx->fillCircle(x - size/3, y, size/6, DemoColours::BLACK);
+	gfx->fillCircle(x + size/3, y, size/6, DemoColours::BLACK);
+	endDraw();
 }
 
 void DisplayManager::drawSport(int displayIndex, int x, int y, int size, uint16_t colour) {
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	// Simple ball
-	displays[displayIndex]->fillCircle(x, y, size/2, colour);
-	displays[displayIndex]->drawCircle(x, y, size/2, DemoColours::BLACK);
-	deselectAllDisplays();
-}
-
-void DisplayManager::showSparkleEffect(int displayIndex) {
-	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
-	
-	// Add small random sparkles
-	for (int i = 0; i < 3; i++) {
-		int x = random(DISPLAY_WIDTH);
-		int y = random(DISPLAY_HEIGHT);
-		uint16_t colour = DemoManager::DEMO_COLOURS[random(DemoManager::DEMO_COLOUR_COUNT)];
-		
-		selectDisplay(displayIndex);
-		displays[displayIndex]->fillCircle(x, y, 2, colour);
-		deselectAllDisplays();
-	}
+	gfx->fillCircle(x, y, size/2, colour);
+	gfx->drawCircle(x, y, size/2, DemoColours::BLACK);
+	endDraw();
 }
 
 // Colour helper implementations
@@ -602,30 +1105,64 @@ void DisplayManager::showColumnTitle(int displayIndex, const String& title, int
 	// Show column title with theme colours
 	uint16_t themeColour = DemoManager::DEMO_COLOURS[columnIndex % DemoManager::DEMO_COLOUR_COUNT];
 	
-	clearDisplay(displayIndex, themeColour);
-	drawCenteredText(displayIndex, title, DISPLAY_HEIGHT/2 - 10, DemoColours::WHITE, 3);
+	Scene& scene = scenes[displayIndex];
+	scene.begin(SCREEN_COLUMN_TITLE, themeColour);
+	scene.text(0, DISPLAY_HEIGHT/2 - 10, title, DemoColours::WHITE, 3, ALIGN_CENTRE);
 	
 	// Add decorative pattern
-	drawPattern(displayIndex, DemoPatterns::STAR, DemoColours::WHITE, DISPLAY_WIDTH/2, DISPLAY_HEIGHT/2 + 40, 30);
+	scene.icon(DemoPatterns::STAR, DISPLAY_WIDTH/2, DISPLAY_HEIGHT/2 + 40, 30, DemoColours::WHITE);
+	scene.end();
 }
 
 void DisplayManager::showTaskContent(int displayIndex, int columnIndex, int position) {
 	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
 	
-	if (DemoManager::isDemoActive()) {
+	if (DemoManager::readSnapshot().active) {
 		showDemoContent(displayIndex, columnIndex, position);
 	} else {
 		// Normal mode content
-		clearDisplay(displayIndex, DemoColours::BLACK);
-		String content = "Task " + String(displayIndex);
-		drawCenteredText(displayIndex, content, DISPLAY_HEIGHT/2, DemoColours::WHITE, 2);
+		declareTaskScreen(displayIndex);
 	}
 }
 
+void DisplayManager::declareTaskScreen(int displayIndex) {
+	Scene& scene = scenes[displayIndex];
+	scene.begin(SCREEN_TASK, DemoColours::BLACK);
+	
+	// The task TaskManager has for this display's switch, if any
+	const TaskSlotView& task = TaskManager::readSnapshot().displays[displayIndex];
+	if (task.present) {
+		String title = task.title;
+		uint8_t size = getTextWidth(title, 2) <= DISPLAY_WIDTH - 2 * MARGIN ? 2 : 1;
+		bool done = task.state == TASK_COMPLETED;
+		scene.text(0, DISPLAY_HEIGHT/2, title, done ? DemoColours::GREY : DemoColours::WHITE, size, ALIGN_CENTRE);
+		scene.text(0, DISPLAY_HEIGHT/2 + 30, done ? "Done!" : "To do", done ? DemoColours::GREEN : DemoColours::YELLOW, 1, ALIGN_CENTRE);
+	} else {
+		scene.text(0, DISPLAY_HEIGHT/2, "Task " + String(displayIndex), DemoColours::WHITE, 2, ALIGN_CENTRE);
+	}
+	
+	// Status indicator in the corner, once the button has reported
+	if (taskStatus[displayIndex] >= 0) {
+		bool completed = taskStatus[displayIndex] == 1;
+		scene.icon(DemoPatterns::CIRCLE, DISPLAY_WIDTH - 20, 20, 20, completed ? DemoColours::GREEN : DemoColours::RED);
+		if (completed) {
+			scene.text(DISPLAY_WIDTH - 22, 16, "✓", DemoColours::WHITE);
+		}
+	}
+	scene.end();
+}
+
 void DisplayManager::updateTaskDisplay(int displayIndex, bool taskCompleted) {
 	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
 	
 	// Update display based on task completion
+	taskStatus[displayIndex] = taskCompleted ? 1 : 0;
+	if (scenes[displayIndex].screen() == SCREEN_TASK) {
+		// Only the indicator's bounds get repainted
+		declareTaskScreen(displayIndex);
+		return;
+	}
+	
 	uint16_t statusColour = taskCompleted ? DemoColours::GREEN : DemoColours::RED;
 	drawTaskStatus(displayIndex, taskCompleted, statusColour);
 }
@@ -634,15 +1171,15 @@ void DisplayManager::drawTaskStatus(int displayIndex, bool completed, uint16_t c
 	if (!displaysInitialized || displayIndex < 0 || displayIndex >= 8) return;
 	
 	// Draw status indicator in corner
-	selectDisplay(displayIndex);
+	Adafruit_GFX* gfx = beginDraw(displayIndex);
 	if (completed) {
-		displays[displayIndex]->fillCircle(DISPLAY_WIDTH - 20, 20, 10, DemoColours::GREEN);
-		displays[displayIndex]->drawLine(DISPLAY_WIDTH - 25, 20, DISPLAY_WIDTH - 20, 25, DemoColours::WHITE);
-		displays[displayIndex]->drawLine(DISPLAY_WIDTH - 20, 25, DISPLAY_WIDTH - 15, 15, DemoColours::WHITE);
+		gfx->fillCircle(DISPLAY_WIDTH - 20, 20, 10, DemoColours::GREEN);
+		gfx->drawLine(DISPLAY_WIDTH - 25, 20, DISPLAY_WIDTH - 20, 25, DemoColours::WHITE);
+		gfx->drawLine(DISPLAY_WIDTH - 20, 25, DISPLAY_WIDTH - 15, 15, DemoColours::WHITE);
 	} else {
-		displays[displayIndex]->fillCircle(DISPLAY_WIDTH - 20, 20, 10, DemoColours::RED);
+		gfx->fillCircle(DISPLAY_WIDTH - 20, 20, 10, DemoColours::RED);
 	}
-	deselectAllDisplays();
+	endDraw();
 }
 
 void DisplayManager::setDisplayBrightness(uint8_t brightness) {
@@ -2,7 +2,23 @@
 #include <Arduino.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7789.h>
+#include "../core/DemoAnimation.h"
 #include "../core/DemoManager.h"
+#include "../core/TaskManager.h"
+#include "../config/GPIOConfig.h"
+#include "FrameBuffer.h"
+#include "FrameCanvas.h"
+#include "IconAtlas.h"
+#include "TextEngine.h"
+#include "Scene.h"
+#include "../hardware/SpiBackends.h"
+#include "../hardware/BusArbiter.h"
+
+// Demo sparkle playback
+struct AnimationStats {
+	uint32_t frames;        // Frames shown
+	uint32_t skipped;       // Frames that came due while an earlier one was still up
+};
 
 class DisplayManager {
 public:
@@ -11,6 +27,22 @@ public:
 	static void update();
 	static void setDisplayBrightness(uint8_t brightness);
 	
+	// Broadcast: while on, whatever is drawn for the lowest display in the
+	// mask (bit n = display n) goes to all of them, chip-selects asserted
+	// together, so a picture every panel shares is drawn and sent once.
+	// Drawing for another display in the mask takes it out. Retained screens
+	// need none of this: identical scenes are grouped when they render.
+	static const uint16_t ALL_DISPLAYS = 0xFF;
+	static void beginBroadcast(uint16_t displayMask);
+	static void endBroadcast();
+	
+	// Off-screen canvas
+	static void flushCanvas();                 // Send changed regions of the canvas to its panels
+	static FlushStats getFlushStats();         // Cumulative bus traffic from canvas flushes
+	static void resetFlushStats();
+	static SpiQueueStats getTransferStats();   // Transfer queue activity behind the flushes
+	static AnimationStats getAnimationStats(); // Since boot
+	
 	// Normal mode display functions
 	static void showColumnTitle(int displayIndex, const String& title, int columnIndex);
 	static void showTaskContent(int displayIndex, int columnIndex, int position);
@@ -21,6 +53,7 @@ public:
 	static void clearDemoActivationProgress();
 	static void showDemoModeActivation();
 	static void showExitingDemoMode();
+	static bool isAnimating();                 // A transition still owns the displays
 	static void showDemoContent(int displayIndex, int columnIndex, int position);
 	
 	// Visual effects and patterns
@@ -30,6 +63,7 @@ public:
 	static void showAnimatedBackground(int displayIndex, uint16_t colour);
 	
 	// Text and layout helpers
+	static void drawText(int displayIndex, const String& text, int x, int y, uint16_t colour, uint8_t textSize = 1);
 	static void drawCenteredText(int displayIndex, const String& text, int y, uint16_t colour, uint8_t textSize = 1);
 	static void drawWrappedText(int displayIndex, const String& text, int x, int y, int maxWidth, uint16_t colour, uint8_t textSize = 1);
 	static void clearDisplay(int displayIndex, uint16_t backgroundColour = 0x0000);
@@ -42,20 +76,61 @@ public:
 	static void showDemoFamily(int displayIndex);
 	
 private:
-	static Adafruit_ST7789* displays[8];
+	static St7789Panel* displays[8];
 	static bool displaysInitialized;
 	static uint8_t currentBrightness;
-	static unsigned long lastUpdate;
+	
+	// Shared RGB565 canvas; canvasDisplay is the display whose content it holds
+	static FrameBuffer* frameBuffer;
+	static FrameCanvas* canvas;
+	static int canvasDisplay;
+	static uint16_t canvasMask;     // Displays a flush sends the canvas to
+	static uint16_t broadcastMask;  // Set by beginBroadcast(); 0 = off
+	static FlushStats flushStats;
+	static const int MAX_FLUSH_RECTS = 32;
+	
+	// Canvas pixels stream out through the queue while loop() carries on
+	static SpiTransferQueue transferQueue;
+	static SpiTransferBackend* transferBackend;
+	
+	// Retained screens, repainted region by region from update()
+	static Scene scenes[8];
+	static int8_t taskStatus[8];   // -1 until the task button first reports
+	static int renderCursor;        // Next scene to repaint, so none starve
+	static uint32_t demoVersion;    // Last DemoSnapshot the scenes were declared from
+	static uint32_t taskVersion;    // Last TaskSnapshot the task screens were declared from
+	
+	// Demo sparkles: DemoAnimation frames played over SCREEN_DEMO as icon nodes
+	static int animationFrame;      // Last frame shown; -1 = none yet
+	static int sparkleNodes[8];     // First sparkle node on each display's scene
+	static AnimationStats animationStats;
+	
+	// Full-screen transitions, advanced one display at a time from update()
+	enum Transition : uint8_t {
+		TRANSITION_NONE = 0,
+		TRANSITION_DEMO_ACTIVATION,
+		TRANSITION_DEMO_EXIT
+	};
+	static Transition transition;
+	static int transitionPhase;
+	static int transitionDisplay;
+	static unsigned long transitionResumeAt;
+	static int activationProgress;   // Percent last declared on the activation screen
+	
+	enum SceneScreen : uint16_t {
+		SCREEN_COLUMN_TITLE = 1,
+		SCREEN_TASK,
+		SCREEN_FAMILY,
+		SCREEN_ACTIVATION,
+		SCREEN_READY,
+		SCREEN_DEMO,
+		SCREEN_PERSON            // + person index
+	};
 	
 	// Display configuration
 	static const int DISPLAY_WIDTH = 170;
 	static const int DISPLAY_HEIGHT = 320;
-	static const int CS_PINS[8];
-	static const int TFT_DC;
-	static const int TFT_RST;
-	static const int TFT_SCK;
-	static const int TFT_MOSI;
-	static const int TFT_BL;
+	static const int CS_PINS[TOTAL_TFT_DISPLAYS];
 	
 	// Layout constants
 	static const int MARGIN = 5;
@@ -65,8 +140,25 @@ private:
 	
 	// Helper methods
 	static void initializeDisplay(int displayIndex);
+	static void initializeAllDisplays();
+	static uint16_t targetMask(int displayIndex);  // Displays a draw for displayIndex reaches
+	static void leaveBroadcast(int displayIndex);
+	static uint16_t matchingScenes(int displayIndex);
 	static void selectDisplay(int displayIndex);
 	static void deselectAllDisplays();
+	static Adafruit_GFX* beginDraw(int displayIndex);  // Canvas if resident, otherwise the panel
+	static void endDraw();
+	static void claimCanvas(int displayIndex);
+	static void declareTaskScreen(int displayIndex);
+	static void declareDemoScreen(int displayIndex);
+	static SpriteFrame sparkleAt(int displayIndex, int frame, int sprite);
+	static void stepAnimation(const DemoSnapshot& demo);
+	static void refreshScene(int displayIndex);
+	static void stepTransition();
+	static void renderScene(int displayIndex);
+	static void drawSceneNode(int displayIndex, int nodeId);
+	static void drawIcon(int displayIndex, const IconMask& mask, int x, int y, uint16_t colour);
+	static void drawTextSpan(int displayIndex, const char* text, int length, int x, int y, uint16_t colour, uint8_t textSize);
 	static uint16_t scaleColour(uint16_t colour, float brightness);
 	static int getTextWidth(const String& text, uint8_t textSize = 1);
 	static int getTextHeight(uint8_t textSize = 1);
@@ -92,7 +184,6 @@ private:
 	// Animation helpers
 	static void showRainbowEffect(int displayIndex);
 	static void showPulseEffect(int displayIndex, uint16_t colour);
-	static void showSparkleEffect(int displayIndex);
 };
 
 // Colour helper functions
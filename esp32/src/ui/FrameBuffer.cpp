@@ -0,0 +1,257 @@
+#include "FrameBuffer.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef ESP32
+#include <esp_heap_caps.h>
+#endif
+
+// Signature value meaning "panel content unknown"; tileSignature() never returns it
+static const uint32_t SIGNATURE_INVALID = 0;
+
+FrameBuffer::FrameBuffer(int16_t width, int16_t height, uint8_t displayCount)
+	: bufferWidth(width), bufferHeight(height), displayCount(displayCount),
+	  tileCols((width + TILE_SIZE - 1) / TILE_SIZE),
+	  tileRows((height + TILE_SIZE - 1) / TILE_SIZE),
+	  pixelData(nullptr), signatures(nullptr),
+	  clipLeft(0), clipTop(0), clipRight(width), clipBottom(height),
+	  touchedX(0), touchedY(0), touchedW(0), touchedH(0) {
+}
+
+FrameBuffer::~FrameBuffer() {
+	free(pixelData);
+	free(signatures);
+}
+
+bool FrameBuffer::allocate() {
+	if (pixelData) return true;
+
+	size_t pixelBytes = (size_t)bufferWidth * bufferHeight * sizeof(uint16_t);
+#ifdef ESP32
+	// Prefer PSRAM when the board has it, keep internal RAM for WiFi
+	pixelData = (uint16_t*)heap_caps_malloc(pixelBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+	if (!pixelData) {
+		pixelData = (uint16_t*)heap_caps_malloc(pixelBytes, MALLOC_CAP_8BIT);
+	}
+#else
+	pixelData = (uint16_t*)malloc(pixelBytes);
+#endif
+	signatures = (uint32_t*)calloc((size_t)displayCount * tileCols * tileRows, sizeof(uint32_t));
+
+	if (!pixelData || !signatures) {
+		free(pixelData);
+		free(signatures);
+		pixelData = nullptr;
+		signatures = nullptr;
+		return false;
+	}
+	return true;
+}
+
+void FrameBuffer::setPixel(int16_t x, int16_t y, uint16_t colour) {
+	if (!pixelData || x < clipLeft || y < clipTop || x >= clipRight || y >= clipBottom) return;
+	pixelData[(size_t)y * bufferWidth + x] = colour;
+	markTouched(x, y, 1, 1);
+}
+
+void FrameBuffer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+	if (!pixelData) return;
+
+	// Clip to the buffer (or the current clip rectangle)
+	if (x < clipLeft) { w -= clipLeft - x; x = clipLeft; }
+	if (y < clipTop) { h -= clipTop - y; y = clipTop; }
+	if (x + w > clipRight) w = clipRight - x;
+	if (y + h > clipBottom) h = clipBottom - y;
+	if (w <= 0 || h <= 0) return;
+
+	for (int16_t j = 0; j < h; j++) {
+		uint16_t* dst = pixelData + (size_t)(y + j) * bufferWidth + x;
+		for (int16_t i = 0; i < w; i++) {
+			dst[i] = colour;
+		}
+	}
+	markTouched(x, y, w, h);
+}
+
+void FrameBuffer::fill(uint16_t colour) {
+	fillRect(0, 0, bufferWidth, bufferHeight, colour);
+}
+
+void FrameBuffer::drawMask(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* data,
+                           uint16_t colour1, uint16_t colour2) {
+	if (!pixelData) return;
+
+	int16_t stride = (w + 3) / 4;
+	int16_t left = x < clipLeft ? clipLeft - x : 0;
+	int16_t top = y < clipTop ? clipTop - y : 0;
+	int16_t right = (x + w > clipRight) ? clipRight - x : w;
+	int16_t bottom = (y + h > clipBottom) ? clipBottom - y : h;
+	if (left >= right || top >= bottom) return;
+
+	for (int16_t j = top; j < bottom; j++) {
+		const uint8_t* src = data + (size_t)j * stride;
+		uint16_t* dst = pixelData + (size_t)(y + j) * bufferWidth + x;
+		for (int16_t i = left; i < right; i++) {
+			uint8_t value = (src[i >> 2] >> (6 - 2 * (i & 3))) & 0x03;
+			if (value == 1) dst[i] = colour1;
+			else if (value == 2) dst[i] = colour2;
+		}
+	}
+	markTouched(x + left, y + top, right - left, bottom - top);
+}
+
+void FrameBuffer::drawColumns(int16_t x, int16_t y, const uint8_t* columns, int16_t count,
+                              uint8_t scale, uint16_t colour) {
+	if (!pixelData || count <= 0 || scale == 0) return;
+
+	int16_t w = count * scale;
+	int16_t h = 8 * scale;
+	int16_t left = x < clipLeft ? clipLeft - x : 0;
+	int16_t top = y < clipTop ? clipTop - y : 0;
+	int16_t right = (x + w > clipRight) ? clipRight - x : w;
+	int16_t bottom = (y + h > clipBottom) ? clipBottom - y : h;
+	if (left >= right || top >= bottom) return;
+
+	for (int16_t j = top; j < bottom; j++) {
+		uint8_t bit = 1 << (j / scale);
+		uint16_t* dst = pixelData + (size_t)(y + j) * bufferWidth + x;
+		for (int16_t i = left; i < right; i++) {
+			if (columns[i / scale] & bit) dst[i] = colour;
+		}
+	}
+	markTouched(x + left, y + top, right - left, bottom - top);
+}
+
+void FrameBuffer::setClip(int16_t x, int16_t y, int16_t w, int16_t h) {
+	clipLeft = x < 0 ? 0 : x;
+	clipTop = y < 0 ? 0 : y;
+	clipRight = (x + w > bufferWidth) ? bufferWidth : x + w;
+	clipBottom = (y + h > bufferHeight) ? bufferHeight : y + h;
+}
+
+void FrameBuffer::clearClip() {
+	clipLeft = 0;
+	clipTop = 0;
+	clipRight = bufferWidth;
+	clipBottom = bufferHeight;
+}
+
+void FrameBuffer::invalidate(uint8_t displayIndex) {
+	if (!signatures || displayIndex >= displayCount) return;
+	size_t tileCount = (size_t)tileCols * tileRows;
+	memset(signatures + displayIndex * tileCount, 0, tileCount * sizeof(uint32_t));
+}
+
+bool FrameBuffer::sameContent(uint8_t first, uint8_t second) const {
+	if (!signatures || first >= displayCount || second >= displayCount) return false;
+	size_t tileCount = (size_t)tileCols * tileRows;
+	return memcmp(signatures + first * tileCount, signatures + second * tileCount,
+	              tileCount * sizeof(uint32_t)) == 0;
+}
+
+void FrameBuffer::markTouched(int16_t x, int16_t y, int16_t w, int16_t h) {
+	if (touchedW <= 0) {
+		touchedX = x;
+		touchedY = y;
+		touchedW = w;
+		touchedH = h;
+		return;
+	}
+
+	int16_t right = (x + w > touchedX + touchedW) ? x + w : touchedX + touchedW;
+	int16_t bottom = (y + h > touchedY + touchedH) ? y + h : touchedY + touchedH;
+	if (x < touchedX) touchedX = x;
+	if (y < touchedY) touchedY = y;
+	touchedW = right - touchedX;
+	touchedH = bottom - touchedY;
+}
+
+uint32_t FrameBuffer::tileSignature(int16_t col, int16_t row) const {
+	int16_t x = col * TILE_SIZE;
+	int16_t y = row * TILE_SIZE;
+	int16_t w = (x + TILE_SIZE > bufferWidth) ? bufferWidth - x : TILE_SIZE;
+	int16_t h = (y + TILE_SIZE > bufferHeight) ? bufferHeight - y : TILE_SIZE;
+
+	// FNV-1a over the tile's pixels
+	uint32_t hash = 2166136261u;
+	for (int16_t j = 0; j < h; j++) {
+		const uint16_t* src = pixelData + (size_t)(y + j) * bufferWidth + x;
+		for (int16_t i = 0; i < w; i++) {
+			hash = (hash ^ src[i]) * 16777619u;
+		}
+	}
+	return hash == SIGNATURE_INVALID ? 1 : hash;
+}
+
+int FrameBuffer::appendRun(DirtyRect* rects, int count, int maxRects,
+                           int16_t x, int16_t y, int16_t w, int16_t h) {
+	// Extend a rectangle ending on the previous tile row with the same column span
+	for (int i = 0; i < count; i++) {
+		if (rects[i].x == x && rects[i].w == w && rects[i].y + rects[i].h == y) {
+			rects[i].h += h;
+			return count;
+		}
+	}
+
+	if (count < maxRects) {
+		rects[count] = {x, y, w, h};
+		return count + 1;
+	}
+
+	// Out of slots - grow the last rectangle to cover this run as well
+	DirtyRect& last = rects[maxRects - 1];
+	int16_t right = (x + w > last.x + last.w) ? x + w : last.x + last.w;
+	int16_t bottom = (y + h > last.y + last.h) ? y + h : last.y + last.h;
+	if (x < last.x) last.x = x;
+	if (y < last.y) last.y = y;
+	last.w = right - last.x;
+	last.h = bottom - last.y;
+	return count;
+}
+
+int FrameBuffer::collectDirtyRects(uint16_t displayMask, DirtyRect* rects, int maxRects) {
+	displayMask &= (1u << displayCount) - 1;
+	if (!pixelData || !displayMask || touchedW <= 0 || maxRects <= 0) {
+		return 0;
+	}
+
+	int16_t colStart = touchedX / TILE_SIZE;
+	int16_t colEnd = (touchedX + touchedW - 1) / TILE_SIZE;
+	int16_t rowStart = touchedY / TILE_SIZE;
+	int16_t rowEnd = (touchedY + touchedH - 1) / TILE_SIZE;
+	size_t tileCount = (size_t)tileCols * tileRows;
+
+	int count = 0;
+	for (int16_t row = rowStart; row <= rowEnd; row++) {
+		int16_t y = row * TILE_SIZE;
+		int16_t h = (y + TILE_SIZE > bufferHeight) ? bufferHeight - y : TILE_SIZE;
+		int16_t runStart = -1;
+
+		for (int16_t col = colStart; col <= colEnd + 1; col++) {
+			bool changed = false;
+			if (col <= colEnd) {
+				uint32_t signature = tileSignature(col, row);
+				uint32_t* stored = signatures + row * tileCols + col;
+				for (uint16_t mask = displayMask; mask; mask &= mask - 1) {
+					uint32_t& previous = stored[__builtin_ctz(mask) * tileCount];
+					changed |= (signature != previous);
+					previous = signature;
+				}
+			}
+
+			if (changed && runStart < 0) {
+				runStart = col;
+			} else if (!changed && runStart >= 0) {
+				// Close the run of changed tiles [runStart, col)
+				int16_t x = runStart * TILE_SIZE;
+				int16_t right = col * TILE_SIZE;
+				if (right > bufferWidth) right = bufferWidth;
+				count = appendRun(rects, count, maxRects, x, y, right - x, h);
+				runStart = -1;
+			}
+		}
+	}
+
+	touchedW = 0;
+	touchedH = 0;
+	return count;
+}
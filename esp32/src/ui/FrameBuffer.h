@@ -0,0 +1,100 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// ==============================================
+// Off-screen RGB565 framebuffer
+// ==============================================
+// Plain C++ (no Arduino dependencies) so it also builds in the native env.
+// One buffer is shared by all displays: it holds the content of whichever
+// display was last cleared into it. Per-display tile signatures remember what
+// is already on each panel, so a flush only emits the tiles that changed.
+
+// Axis-aligned rectangle in display coordinates
+struct DirtyRect {
+	int16_t x;
+	int16_t y;
+	int16_t w;
+	int16_t h;
+};
+
+// Bus traffic accounting for flushed frames
+struct FlushStats {
+	uint32_t frames;        // Flushes that sent at least one rectangle
+	uint32_t rects;         // setAddrWindow calls
+	uint32_t pixels;        // RGB565 pixels written
+	uint32_t bytes;         // Pixel bytes plus address window overhead
+};
+
+class FrameBuffer {
+public:
+	static const int TILE_SIZE = 16;
+	// CASET + 4 bytes, RASET + 4 bytes, RAMWR
+	static const uint32_t ADDR_WINDOW_BYTES = 11;
+
+	FrameBuffer(int16_t width, int16_t height, uint8_t displayCount);
+	~FrameBuffer();
+
+	bool allocate();
+	bool isAllocated() const { return pixelData != nullptr; }
+
+	int16_t width() const { return bufferWidth; }
+	int16_t height() const { return bufferHeight; }
+	uint16_t* pixels() { return pixelData; }
+	const uint16_t* row(int16_t y) const { return pixelData + (size_t)y * bufferWidth; }
+
+	// Drawing primitives (clipped to the buffer and the clip rectangle)
+	void setPixel(int16_t x, int16_t y, uint16_t colour);
+	void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+	void fill(uint16_t colour);
+	// 2-bpp mask, MSB first, rows padded to whole bytes: 0 leaves the pixel,
+	// 1 writes colour1, 2 writes colour2
+	void drawMask(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* data,
+	              uint16_t colour1, uint16_t colour2);
+	// 1-bpp column bitmap, one byte per column with bit 0 at the top (GFX font
+	// layout); each set bit becomes a scale x scale block of colour
+	void drawColumns(int16_t x, int16_t y, const uint8_t* columns, int16_t count,
+	                 uint8_t scale, uint16_t colour);
+
+	// Restricts every primitive to a rectangle until clearClip()
+	void setClip(int16_t x, int16_t y, int16_t w, int16_t h);
+	void clearClip();
+
+	// Dirty tracking
+	// Compares the touched tiles against the signatures stored for each
+	// display in displayMask (bit n = display n), records the new signatures
+	// for all of them and writes merged rectangles into rects. A tile is dirty
+	// if any of those displays differs, so one broadcast of the rectangles
+	// leaves them all showing the buffer. Returns the number of rectangles
+	// written (never more than maxRects).
+	int collectDirtyRects(uint16_t displayMask, DirtyRect* rects, int maxRects);
+	void invalidate(uint8_t displayIndex);  // Panel content unknown - repaint next flush
+	bool sameContent(uint8_t first, uint8_t second) const;  // Signatures match tile for tile
+	bool hasTouchedRegion() const { return touchedW > 0; }
+
+private:
+	int16_t bufferWidth;
+	int16_t bufferHeight;
+	uint8_t displayCount;
+	int16_t tileCols;
+	int16_t tileRows;
+	uint16_t* pixelData;
+	uint32_t* signatures;   // displayCount * tileCols * tileRows
+
+	// Clip rectangle (right/bottom exclusive)
+	int16_t clipLeft;
+	int16_t clipTop;
+	int16_t clipRight;
+	int16_t clipBottom;
+
+	// Union of all writes since the last collectDirtyRects()
+	int16_t touchedX;
+	int16_t touchedY;
+	int16_t touchedW;
+	int16_t touchedH;
+
+	void markTouched(int16_t x, int16_t y, int16_t w, int16_t h);
+	uint32_t tileSignature(int16_t col, int16_t row) const;
+	static int appendRun(DirtyRect* rects, int count, int maxRects,
+	                     int16_t x, int16_t y, int16_t w, int16_t h);
+};
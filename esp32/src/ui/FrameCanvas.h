@@ -0,0 +1,36 @@
+#pragma once
+#include <Adafruit_GFX.h>
+#include "FrameBuffer.h"
+
+// Adafruit_GFX front end for FrameBuffer so the existing draw helpers
+// (lines, circles, triangles, text) can render into RAM unchanged.
+class FrameCanvas : public Adafruit_GFX {
+public:
+	explicit FrameCanvas(FrameBuffer& buffer)
+		: Adafruit_GFX(buffer.width(), buffer.height()), buffer(buffer) {}
+
+	void drawPixel(int16_t x, int16_t y, uint16_t colour) override {
+		buffer.setPixel(x, y, colour);
+	}
+
+	void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t colour) override {
+		buffer.fillRect(x, y, 1, h, colour);
+	}
+
+	void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t colour) override {
+		buffer.fillRect(x, y, w, 1, colour);
+	}
+
+	void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) override {
+		buffer.fillRect(x, y, w, h, colour);
+	}
+
+	void fillScreen(uint16_t colour) override {
+		buffer.fill(colour);
+	}
+
+	FrameBuffer& frameBuffer() { return buffer; }
+
+private:
+	FrameBuffer& buffer;
+};
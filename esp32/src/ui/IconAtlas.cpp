@@ -0,0 +1,13 @@
+#include "IconAtlas.h"
+#include "IconAtlasData.h"
+
+const IconMask* IconAtlas::find(uint8_t patternId, int size) {
+	if (patternId >= IconAtlasData::PATTERN_COUNT) return nullptr;
+
+	for (int slot = 0; slot < IconAtlasData::SIZE_COUNT; slot++) {
+		if (IconAtlasData::SIZES[slot] == size) {
+			return &IconAtlasData::MASKS[patternId * IconAtlasData::SIZE_COUNT + slot];
+		}
+	}
+	return nullptr;
+}
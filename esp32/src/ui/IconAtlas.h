@@ -0,0 +1,37 @@
+#pragma once
+#include <stdint.h>
+
+// ==============================================
+// Pre-rasterised DemoPatterns icons
+// ==============================================
+// Masks are generated at build time by tools/gen_icon_atlas.py into
+// IconAtlasData.h (flash, constexpr). Each pixel is 2 bits, MSB first, rows
+// padded to whole bytes. Sizes outside the atlas fall back to the GFX
+// drawing code in DisplayManager.
+
+struct IconMask {
+	int8_t offsetX;          // Top-left corner relative to the pattern centre
+	int8_t offsetY;
+	uint8_t width;
+	uint8_t height;
+	const uint8_t* data;
+};
+
+class IconAtlas {
+public:
+	// Mask pixel values
+	static const uint8_t TRANSPARENT = 0;
+	static const uint8_t PRIMARY = 1;     // Pattern colour
+	static const uint8_t DETAIL = 2;      // Black detail (book spine, controller buttons)
+
+	static const IconMask* find(uint8_t patternId, int size);
+
+	static uint8_t pixel(const IconMask& mask, int x, int y) {
+		uint8_t packed = mask.data[y * stride(mask) + (x >> 2)];
+		return (packed >> (6 - 2 * (x & 3))) & 0x03;
+	}
+
+	static int stride(const IconMask& mask) {
+		return (mask.width + 3) >> 2;
+	}
+};
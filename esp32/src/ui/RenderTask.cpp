@@ -0,0 +1,162 @@
+#include "RenderTask.h"
+#include "DisplayManager.h"
+#include "../core/DemoManager.h"
+#include "../core/TaskManager.h"
+
+// Static member definitions
+SpscQueue<RenderCommand, RenderTask::QUEUE_DEPTH> RenderTask::commands;
+StateSnapshot<RenderStatus> RenderTask::status;
+bool RenderTask::running = false;
+uint32_t RenderTask::posted = 0;
+uint32_t RenderTask::transitionPosted = 0;
+uint32_t RenderTask::stalls = 0;
+uint32_t RenderTask::executed = 0;
+uint32_t RenderTask::frames = 0;
+
+// Render task timing: a frame every period, and never less than a tick of
+// sleep so the idle task on that core still runs
+static const uint32_t RENDER_PERIOD_MS = 10;
+static const uint32_t RENDER_STACK_BYTES = 8192;
+static const int RENDER_TASK_PRIORITY = 2;
+
+bool RenderTask::start(int core) {
+#ifdef ESP32
+	if (running) return true;
+	
+	// Set first: the task may run before xTaskCreatePinnedToCore returns
+	running = true;
+	if (xTaskCreatePinnedToCore(taskMain, "render", RENDER_STACK_BYTES, nullptr,
+	                            RENDER_TASK_PRIORITY, nullptr, core) != pdPASS) {
+		running = false;
+		Serial.println("RenderTask: Could not create task - rendering inline");
+		return false;
+	}
+	
+	Serial.printf("RenderTask: Rendering on core %d, input on core %d\n", core, xPortGetCoreID());
+	return true;
+#else
+	(void)core;
+	return false;
+#endif
+}
+
+bool RenderTask::isRunning() {
+	return running;
+}
+
+void RenderTask::taskMain(void* parameter) {
+	(void)parameter;
+#ifdef ESP32
+	for (;;) {
+		unsigned long start = millis();
+		run();
+		unsigned long elapsed = millis() - start;
+		delay(elapsed < RENDER_PERIOD_MS ? RENDER_PERIOD_MS - elapsed : 1);
+	}
+#endif
+}
+
+void RenderTask::run() {
+	// Demo and task state hold still for the whole frame, commands included
+	DemoManager::refreshSnapshot();
+	TaskManager::refreshSnapshot();
+	
+	RenderCommand command;
+	while (commands.pop(command)) {
+		execute(command);
+		executed++;
+	}
+	
+	DisplayManager::update();
+	frames++;
+	
+	if (running) {
+		status.publish({executed, frames, DisplayManager::isAnimating()});
+	}
+}
+
+void RenderTask::submit(const RenderCommand& command) {
+	if (!running) {
+		execute(command);
+		return;
+	}
+	
+	posted++;
+	while (!commands.push(command)) {
+		// The render core is behind; wait rather than drop a screen
+		stalls++;
+		delay(1);
+	}
+}
+
+void RenderTask::execute(const RenderCommand& command) {
+	switch (command.type) {
+		case RENDER_COLUMN_TITLE:
+			DisplayManager::showColumnTitle(command.display, String(command.text), command.column);
+			break;
+		case RENDER_TASK_CONTENT:
+			DisplayManager::showTaskContent(command.display, command.column, command.position);
+			break;
+		case RENDER_TASK_STATUS:
+			DisplayManager::updateTaskDisplay(command.display, command.value != 0);
+			break;
+		case RENDER_ACTIVATION_PROGRESS:
+			DisplayManager::showDemoActivationProgress(command.value);
+			break;
+		case RENDER_CLEAR_ACTIVATION:
+			DisplayManager::clearDemoActivationProgress();
+			break;
+		case RENDER_DEMO_ACTIVATION:
+			DisplayManager::showDemoModeActivation();
+			break;
+		case RENDER_EXIT_DEMO:
+			DisplayManager::showExitingDemoMode();
+			break;
+	}
+}
+
+void RenderTask::showColumnTitle(int displayIndex, const String& title, int columnIndex) {
+	RenderCommand command = {RENDER_COLUMN_TITLE, (int8_t)displayIndex, (int8_t)columnIndex, 0, 0, {0}};
+	strncpy(command.text, title.c_str(), sizeof(command.text) - 1);
+	submit(command);
+}
+
+void RenderTask::showTaskContent(int displayIndex, int columnIndex, int position) {
+	submit({RENDER_TASK_CONTENT, (int8_t)displayIndex, (int8_t)columnIndex, (int8_t)position, 0, {0}});
+}
+
+void RenderTask::updateTaskDisplay(int displayIndex, bool taskCompleted) {
+	submit({RENDER_TASK_STATUS, (int8_t)displayIndex, 0, 0, (int16_t)taskCompleted, {0}});
+}
+
+void RenderTask::showDemoActivationProgress(int progress) {
+	submit({RENDER_ACTIVATION_PROGRESS, 0, 0, 0, (int16_t)progress, {0}});
+}
+
+void RenderTask::clearDemoActivationProgress() {
+	submit({RENDER_CLEAR_ACTIVATION, 0, 0, 0, 0, {0}});
+}
+
+void RenderTask::showDemoModeActivation() {
+	submit({RENDER_DEMO_ACTIVATION, 0, 0, 0, 0, {0}});
+	transitionPosted = posted;
+}
+
+void RenderTask::showExitingDemoMode() {
+	submit({RENDER_EXIT_DEMO, 0, 0, 0, 0, {0}});
+	transitionPosted = posted;
+}
+
+bool RenderTask::isAnimating() {
+	if (!running) return DisplayManager::isAnimating();
+	
+	// Queued but not yet started counts as animating, so row content isn't
+	// drawn underneath a transition that is about to clear it
+	status.refresh();
+	const RenderStatus& state = status.current();
+	return state.animating || (int32_t)(transitionPosted - state.executed) > 0;
+}
+
+uint32_t RenderTask::getStalls() {
+	return stalls;
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <Arduino.h>
+#include "../utils/SpscQueue.h"
+#include "../utils/StateSnapshot.h"
+
+// ==============================================
+// Rendering on its own core
+// ==============================================
+// When started, DisplayManager and the SPI bus belong to a FreeRTOS task
+// pinned to one core, while loop() keeps input, navigation and networking on
+// the other. The control side never calls DisplayManager directly: screen
+// changes go through a lock-free command queue, and the render side answers
+// with a status snapshot. Demo content reaches the render side through
+// DemoManager's own snapshot. Until start() succeeds (and always on the
+// host build) every call runs inline on the caller's thread.
+
+enum RenderCommandType : uint8_t {
+	RENDER_COLUMN_TITLE = 0,
+	RENDER_TASK_CONTENT,
+	RENDER_TASK_STATUS,
+	RENDER_ACTIVATION_PROGRESS,
+	RENDER_CLEAR_ACTIVATION,
+	RENDER_DEMO_ACTIVATION,
+	RENDER_EXIT_DEMO
+};
+
+struct RenderCommand {
+	RenderCommandType type;
+	int8_t display;
+	int8_t column;
+	int8_t position;
+	int16_t value;          // Progress in percent, or task completed
+	char text[24];          // Column title
+};
+
+// Published by the render side after every frame
+struct RenderStatus {
+	uint32_t executed;      // Commands run so far
+	uint32_t frames;
+	bool animating;         // A transition owns the displays
+};
+
+class RenderTask {
+public:
+	static const size_t QUEUE_DEPTH = 32;
+
+	// Pins the render task to core; false (and rendering stays inline) when
+	// threading is unavailable
+	static bool start(int core);
+	static bool isRunning();
+
+	// Control side: same meaning as the DisplayManager calls
+	static void showColumnTitle(int displayIndex, const String& title, int columnIndex);
+	static void showTaskContent(int displayIndex, int columnIndex, int position);
+	static void updateTaskDisplay(int displayIndex, bool taskCompleted);
+	static void showDemoActivationProgress(int progress);
+	static void clearDemoActivationProgress();
+	static void showDemoModeActivation();
+	static void showExitingDemoMode();
+
+	// Control side: true from the moment a transition is queued until the
+	// render side has played it out
+	static bool isAnimating();
+
+	// Render side: runs queued commands, then one DisplayManager frame. Called
+	// by the render task, or by the render job when running inline.
+	static void run();
+
+	// Times the control side waited on a full queue
+	static uint32_t getStalls();
+
+private:
+	static void submit(const RenderCommand& command);
+	static void execute(const RenderCommand& command);
+	static void taskMain(void* parameter);
+
+	static SpscQueue<RenderCommand, QUEUE_DEPTH> commands;
+	static StateSnapshot<RenderStatus> status;
+	static bool running;
+
+	// Control side
+	static uint32_t posted;
+	static uint32_t transitionPosted;   // Sequence of the last queued transition
+	static uint32_t stalls;
+
+	// Render side
+	static uint32_t executed;
+	static uint32_t frames;
+};
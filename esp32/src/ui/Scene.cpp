@@ -0,0 +1,292 @@
+#include "Scene.h"
+#include "TextEngine.h"
+#include "IconAtlas.h"
+
+static bool sameNode(const SceneNode& a, const SceneNode& b) {
+	return a.type == b.type && a.visible == b.visible &&
+	       a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h &&
+	       a.colour == b.colour && a.size == b.size && a.pattern == b.pattern &&
+	       a.value == b.value && a.align == b.align && a.text == b.text;
+}
+
+static bool overlaps(const DirtyRect& a, const DirtyRect& b) {
+	return a.x <= b.x + b.w && b.x <= a.x + a.w && a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+static DirtyRect unite(const DirtyRect& a, const DirtyRect& b) {
+	int16_t left = min(a.x, b.x);
+	int16_t top = min(a.y, b.y);
+	int16_t right = max(a.x + a.w, b.x + b.w);
+	int16_t bottom = max(a.y + a.h, b.y + b.h);
+	return {left, top, (int16_t)(right - left), (int16_t)(bottom - top)};
+}
+
+Scene::Scene()
+	: count(0), cursor(0), screenId(NO_SCREEN), backgroundColour(0),
+	  width(0), height(0), dirtyCount(0), fullRepaint(false) {
+}
+
+void Scene::setSize(int16_t w, int16_t h) {
+	width = w;
+	height = h;
+}
+
+void Scene::reset() {
+	count = 0;
+	cursor = 0;
+	screenId = NO_SCREEN;
+	clearDirty();
+}
+
+void Scene::begin(uint16_t screen, uint16_t background) {
+	if (screen != screenId || background != backgroundColour) {
+		// Different screen: nothing on the panel can be reused
+		count = 0;
+		screenId = screen;
+		backgroundColour = background;
+		fullRepaint = true;
+		dirtyCount = 0;
+	}
+	cursor = 0;
+}
+
+void Scene::end() {
+	// Nodes the screen no longer declares
+	for (int i = cursor; i < count; i++) {
+		invalidateNode(i);
+		nodes[i].text = String();
+	}
+	count = cursor;
+}
+
+int Scene::declare(const SceneNode& node) {
+	if (cursor >= MAX_NODES) return -1;
+
+	int id = cursor++;
+	if (id >= count) {
+		nodes[id] = node;
+		count = id + 1;
+		invalidateNode(id);
+	} else if (!sameNode(nodes[id], node)) {
+		update(id, node);
+	}
+	return id;
+}
+
+void Scene::update(int id, const SceneNode& node) {
+	if (updateValue(id, node)) return;
+	invalidateNode(id);
+	nodes[id] = node;
+	invalidateNode(id);
+}
+
+bool Scene::updateValue(int id, const SceneNode& node) {
+	SceneNode& old = nodes[id];
+	if (old.value == node.value || !old.visible) return false;
+	if (node.type != SCENE_PROGRESS && node.type != SCENE_COUNTER) return false;
+
+	// Anything besides the value changed: repaint the whole node
+	uint16_t oldValue = old.value;
+	old.value = node.value;
+	bool onlyValue = sameNode(old, node);
+	old.value = oldValue;
+	if (!onlyValue) return false;
+
+	if (node.type == SCENE_PROGRESS) {
+		// The columns between the two fills, inside the border
+		int from = (oldValue * node.w) / 100;
+		int to = (node.value * node.w) / 100;
+		int left = node.x + max(min(from, to), 1);
+		int right = node.x + min(max(from, to), node.w - 1);
+		if (right > left) {
+			invalidate({(int16_t)left, (int16_t)(node.y + 1), (int16_t)(right - left), (int16_t)(node.h - 2)});
+		}
+	} else {
+		// The cells whose digit changed
+		char before[MAX_COUNTER_DIGITS];
+		char after[MAX_COUNTER_DIGITS];
+		counterDigits(old, before);
+		counterDigits(node, after);
+		DirtyRect b = bounds(id);
+		int16_t pitch = counterPitch(node.size);
+		for (int i = 0; i < node.pattern; i++) {
+			if (before[i] == after[i]) continue;
+			invalidate({(int16_t)(b.x + i * pitch), b.y, (int16_t)(pitch - node.size),
+			            (int16_t)(TextEngine::GLYPH_ROWS * node.size)});
+		}
+	}
+	old.value = node.value;
+	return true;
+}
+
+int Scene::rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+	SceneNode node = {SCENE_RECT, true, x, y, w, h, colour, 0, 0, 0, ALIGN_LEFT, String()};
+	return declare(node);
+}
+
+int Scene::text(int16_t x, int16_t y, const String& text, uint16_t colour, uint8_t size, SceneAlign align) {
+	SceneNode node = {SCENE_TEXT, true, x, y, 0, 0, colour, size, 0, 0, align, text};
+	return declare(node);
+}
+
+int Scene::icon(uint8_t pattern, int16_t x, int16_t y, uint8_t size, uint16_t colour) {
+	SceneNode node = {SCENE_ICON, true, x, y, 0, 0, colour, size, pattern, 0, ALIGN_LEFT, String()};
+	return declare(node);
+}
+
+int Scene::progress(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t value, uint16_t colour) {
+	SceneNode node = {SCENE_PROGRESS, true, x, y, w, h, colour, 0, 0, min<uint8_t>(value, 100), ALIGN_LEFT, String()};
+	return declare(node);
+}
+
+int Scene::counter(int16_t x, int16_t y, uint16_t value, uint8_t digits, const String& suffix, uint16_t colour,
+                   uint8_t size, SceneAlign align) {
+	digits = constrain(digits, 1, MAX_COUNTER_DIGITS);
+	SceneNode node = {SCENE_COUNTER, true, x, y, 0, 0, colour, size, digits, value, align, suffix};
+	return declare(node);
+}
+
+void Scene::setText(int id, const String& text) {
+	if (id < 0 || id >= count || nodes[id].text == text) return;
+	SceneNode node = nodes[id];
+	node.text = text;
+	update(id, node);
+}
+
+void Scene::setColour(int id, uint16_t colour) {
+	if (id < 0 || id >= count || nodes[id].colour == colour) return;
+	SceneNode node = nodes[id];
+	node.colour = colour;
+	update(id, node);
+}
+
+void Scene::setValue(int id, uint16_t value) {
+	if (id < 0 || id >= count) return;
+	if (nodes[id].type == SCENE_PROGRESS) value = min<uint16_t>(value, 100);
+	if (nodes[id].value == value) return;
+	SceneNode node = nodes[id];
+	node.value = value;
+	update(id, node);
+}
+
+void Scene::setVisible(int id, bool visible) {
+	if (id < 0 || id >= count || nodes[id].visible == visible) return;
+	SceneNode node = nodes[id];
+	node.visible = visible;
+	update(id, node);
+}
+
+void Scene::setIcon(int id, int16_t x, int16_t y, uint8_t size, uint16_t colour) {
+	if (id < 0 || id >= count || nodes[id].type != SCENE_ICON) return;
+	SceneNode node = nodes[id];
+	node.x = x;
+	node.y = y;
+	node.size = size;
+	node.colour = colour;
+	if (!sameNode(nodes[id], node)) update(id, node);
+}
+
+DirtyRect Scene::bounds(int id) const {
+	const SceneNode& node = nodes[id];
+	switch (node.type) {
+		case SCENE_RECT:
+		case SCENE_PROGRESS:
+			return {node.x, node.y, node.w, node.h};
+
+		case SCENE_TEXT: {
+			int16_t w = TextEngine::measure(node.text, node.size);
+			int16_t x = (node.align == ALIGN_CENTRE) ? (width - w) / 2 : node.x;
+			return {x, node.y, w, (int16_t)(TextEngine::GLYPH_ROWS * node.size)};
+		}
+
+		case SCENE_COUNTER: {
+			int16_t w = node.pattern * counterPitch(node.size);
+			w += node.text.length() ? TextEngine::measure(node.text, node.size) : -node.size;
+			int16_t x = (node.align == ALIGN_CENTRE) ? (width - w) / 2 : node.x;
+			return {x, node.y, w, (int16_t)(TextEngine::GLYPH_ROWS * node.size)};
+		}
+
+		case SCENE_ICON: {
+			const IconMask* mask = IconAtlas::find(node.pattern, node.size);
+			if (mask) {
+				return {(int16_t)(node.x + mask->offsetX), (int16_t)(node.y + mask->offsetY),
+				        mask->width, mask->height};
+			}
+			// Outside the atlas: no shape reaches further than size from its centre
+			int16_t reach = node.size + 1;
+			return {(int16_t)(node.x - reach), (int16_t)(node.y - reach),
+			        (int16_t)(reach * 2 + 1), (int16_t)(reach * 2 + 1)};
+		}
+
+		default:
+			return {0, 0, 0, 0};
+	}
+}
+
+int16_t Scene::counterPitch(uint8_t size) {
+	return TextEngine::digitWidth(size) + size;
+}
+
+void Scene::counterDigits(const SceneNode& node, char* digits) {
+	uint32_t limit = 1;
+	for (int i = 0; i < node.pattern; i++) limit *= 10;
+	uint32_t value = min<uint32_t>(node.value, limit - 1);
+
+	// Right to left; a zero still shows its last digit
+	for (int i = node.pattern - 1; i >= 0; i--) {
+		digits[i] = (value || i == node.pattern - 1) ? '0' + value % 10 : ' ';
+		value /= 10;
+	}
+}
+
+bool Scene::matches(const Scene& other) const {
+	if (screenId != other.screenId || backgroundColour != other.backgroundColour || count != other.count) {
+		return false;
+	}
+	for (int i = 0; i < count; i++) {
+		if (!sameNode(nodes[i], other.nodes[i])) return false;
+	}
+	return true;
+}
+
+void Scene::invalidateNode(int id) {
+	if (nodes[id].visible) {
+		invalidate(bounds(id));
+	}
+}
+
+void Scene::invalidate(DirtyRect rect) {
+	if (fullRepaint) return;
+
+	// Clip to the display
+	if (rect.x < 0) { rect.w += rect.x; rect.x = 0; }
+	if (rect.y < 0) { rect.h += rect.y; rect.y = 0; }
+	if (rect.x + rect.w > width) rect.w = width - rect.x;
+	if (rect.y + rect.h > height) rect.h = height - rect.y;
+	if (rect.w <= 0 || rect.h <= 0) return;
+
+	// Grow an overlapping region rather than painting the overlap twice
+	for (int i = 0; i < dirtyCount; i++) {
+		if (overlaps(dirty[i], rect)) {
+			dirty[i] = unite(dirty[i], rect);
+			return;
+		}
+	}
+
+	if (dirtyCount < MAX_DIRTY) {
+		dirty[dirtyCount++] = rect;
+	} else {
+		dirty[dirtyCount - 1] = unite(dirty[dirtyCount - 1], rect);
+	}
+}
+
+void Scene::clearDirty() {
+	dirtyCount = 0;
+	fullRepaint = false;
+}
+
+void Scene::repaintAll() {
+	if (!isActive()) return;
+	dirtyCount = 0;
+	fullRepaint = true;
+}
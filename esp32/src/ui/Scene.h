@@ -0,0 +1,121 @@
+#pragma once
+#include <Arduino.h>
+#include "FrameBuffer.h"
+
+// ==============================================
+// Retained scene for one display
+// ==============================================
+// A screen declares its nodes in paint order between begin() and end(),
+// every time it is shown. Nodes are matched by position against the last
+// declaration: unchanged nodes cost nothing, a changed node invalidates its
+// old and new bounds, and DisplayManager::update() repaints only those
+// regions. A new screen id (or background) repaints the whole display.
+//
+// Progress bars and counters keep that region small when only their value
+// moves: a bar invalidates just the columns between its old and new fill,
+// and a counter - digits in fixed-width cells, so the layout never shifts -
+// just the cells whose digit changed.
+
+enum SceneNodeType : uint8_t {
+	SCENE_NONE = 0,
+	SCENE_RECT,
+	SCENE_TEXT,
+	SCENE_ICON,
+	SCENE_PROGRESS,
+	SCENE_COUNTER
+};
+
+enum SceneAlign : uint8_t {
+	ALIGN_LEFT = 0,
+	ALIGN_CENTRE          // Centred on the display; x is ignored
+};
+
+struct SceneNode {
+	SceneNodeType type;
+	bool visible;
+	int16_t x;            // Top-left, or the centre for icons
+	int16_t y;
+	int16_t w;            // Rect and progress bar size
+	int16_t h;
+	uint16_t colour;
+	uint8_t size;         // Text size, or icon size in pixels
+	uint8_t pattern;      // Icon pattern id, or counter digits
+	uint16_t value;       // Progress in percent, or the counter's number
+	SceneAlign align;
+	String text;          // Text, or the counter's suffix
+};
+
+class Scene {
+public:
+	static const int MAX_NODES = 24;
+	static const int MAX_DIRTY = 6;
+	static const uint16_t NO_SCREEN = 0;
+	static const int MAX_COUNTER_DIGITS = 5;
+
+	Scene();
+
+	void setSize(int16_t width, int16_t height);
+
+	// Drops the scene; the display is being drawn imperatively
+	void reset();
+	bool isActive() const { return screenId != NO_SCREEN; }
+	uint16_t screen() const { return screenId; }
+	uint16_t background() const { return backgroundColour; }
+
+	// Declaration
+	void begin(uint16_t screen, uint16_t background);
+	int rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+	int text(int16_t x, int16_t y, const String& text, uint16_t colour, uint8_t size = 1, SceneAlign align = ALIGN_LEFT);
+	int icon(uint8_t pattern, int16_t x, int16_t y, uint8_t size, uint16_t colour);
+	int progress(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t value, uint16_t colour);
+	// Right-aligned in digits cells, blank-padded; larger values show all 9s
+	int counter(int16_t x, int16_t y, uint16_t value, uint8_t digits, const String& suffix, uint16_t colour,
+	            uint8_t size = 1, SceneAlign align = ALIGN_LEFT);
+	void end();
+
+	// Direct property changes on a declared node
+	void setText(int id, const String& text);
+	void setColour(int id, uint16_t colour);
+	void setValue(int id, uint16_t value);
+	void setVisible(int id, bool visible);
+	void setIcon(int id, int16_t x, int16_t y, uint8_t size, uint16_t colour);   // Moves a sprite
+
+	int nodeCount() const { return count; }
+	const SceneNode& node(int id) const { return nodes[id]; }
+	DirtyRect bounds(int id) const;
+
+	// Counter layout: cell i starts pitch * i from the left of its bounds;
+	// digits get one char per cell, ' ' for blanks
+	static int16_t counterPitch(uint8_t size);
+	static void counterDigits(const SceneNode& node, char* digits);
+
+	// Same screen, background and nodes - the two displays show one picture
+	bool matches(const Scene& other) const;
+
+	// Regions waiting for DisplayManager to repaint
+	bool needsRender() const { return fullRepaint || dirtyCount > 0; }
+	bool needsFullRepaint() const { return fullRepaint; }
+	int getDirtyCount() const { return dirtyCount; }
+	const DirtyRect& getDirty(int index) const { return dirty[index]; }
+	void clearDirty();
+	void repaintAll();      // Panel content unknown; render the whole scene again
+
+private:
+	int declare(const SceneNode& node);
+	void update(int id, const SceneNode& node);
+	bool updateValue(int id, const SceneNode& node);
+	void invalidateNode(int id);
+	void invalidate(DirtyRect rect);
+
+	SceneNode nodes[MAX_NODES];
+	int count;
+	int cursor;             // Next node to match during a declaration
+	uint16_t screenId;
+	uint16_t backgroundColour;
+	int16_t width;
+	int16_t height;
+
+	DirtyRect dirty[MAX_DIRTY];
+	int dirtyCount;
+	bool fullRepaint;
+};
@@ -0,0 +1,204 @@
+#include "TextEngine.h"
+#include <Adafruit_GFX.h>
+
+// Static member definitions
+TextEngine::Glyph TextEngine::glyphs[256];
+TextEngine::CacheEntry TextEngine::cache[CACHE_ENTRIES];
+uint8_t TextEngine::scratch[MAX_RUN_WIDTH];
+uint32_t TextEngine::useCounter = 0;
+TextCacheStats TextEngine::stats = {0, 0};
+
+// Blank glyphs (space) still need an advance
+static const uint8_t BLANK_WIDTH = 3;
+
+// Non-ASCII characters we have glyphs for, mapped to the font's CP437 index
+struct CodepointMapping {
+	uint16_t codepoint;
+	uint8_t glyph;
+};
+
+static const CodepointMapping CODEPOINT_MAP[] = {
+	{0x00A3, 0x9C},   // £
+	{0x00B0, 0xF8},   // °
+	{0x00B5, 0xE6},   // µ
+	{0x00B7, 0xFA},   // ·
+	{0x00E4, 0x84},   // ä
+	{0x00E8, 0x8A},   // è
+	{0x00E9, 0x82},   // é
+	{0x00F6, 0x94},   // ö
+	{0x00FC, 0x81},   // ü
+	{0x2022, 0x07},   // •
+	{0x2713, 0xFB},   // ✓ (CP437 square root)
+	{0x2714, 0xFB},   // ✔
+};
+
+uint8_t TextEngine::decode(const char* text, int length, int& index) {
+	uint8_t lead = text[index++];
+	if (lead < 0x80) {
+		return lead < 0x20 ? ' ' : lead;
+	}
+
+	int extra;
+	uint32_t codepoint;
+	if ((lead & 0xE0) == 0xC0) { extra = 1; codepoint = lead & 0x1F; }
+	else if ((lead & 0xF0) == 0xE0) { extra = 2; codepoint = lead & 0x0F; }
+	else if ((lead & 0xF8) == 0xF0) { extra = 3; codepoint = lead & 0x07; }
+	else return '?';  // Stray continuation byte
+
+	for (int i = 0; i < extra; i++) {
+		if (index >= length || ((uint8_t)text[index] & 0xC0) != 0x80) return '?';
+		codepoint = (codepoint << 6) | ((uint8_t)text[index++] & 0x3F);
+	}
+
+	for (const CodepointMapping& mapping : CODEPOINT_MAP) {
+		if (mapping.codepoint == codepoint) return mapping.glyph;
+	}
+	return '?';
+}
+
+const TextEngine::Glyph& TextEngine::glyph(uint8_t code) {
+	Glyph& g = glyphs[code];
+	if (g.measured) return g;
+
+	// Draw the glyph once and keep only the columns with ink
+	static GFXcanvas1* cell = nullptr;
+	if (!cell) {
+		cell = new GFXcanvas1(6, GLYPH_ROWS);
+		cell->cp437(true);
+	}
+	cell->fillScreen(0);
+	cell->drawChar(0, 0, code, 1, 0, 1);
+
+	g.width = 0;
+	int first = -1;
+	for (int x = 0; x < 5; x++) {
+		uint8_t bits = 0;
+		for (int y = 0; y < GLYPH_ROWS; y++) {
+			if (cell->getPixel(x, y)) bits |= 1 << y;
+		}
+		if (bits && first < 0) first = x;
+		if (first >= 0) g.columns[x - first] = bits;
+		if (bits) g.width = x - first + 1;
+	}
+	if (g.width == 0) {
+		g.width = BLANK_WIDTH;
+		memset(g.columns, 0, sizeof(g.columns));
+	}
+	g.measured = true;
+	return g;
+}
+
+int TextEngine::measure(const char* text, int length, uint8_t size) {
+	int width = 0;
+	int index = 0;
+	while (index < length) {
+		width += glyph(decode(text, length, index)).width + 1;
+	}
+	// No spacing after the last glyph
+	return width > 0 ? (width - 1) * size : 0;
+}
+
+int TextEngine::digitWidth(uint8_t size) {
+	int widest = 0;
+	for (uint8_t code = '0'; code <= '9'; code++) {
+		widest = max<int>(widest, glyph(code).width);
+	}
+	return widest * size;
+}
+
+int TextEngine::render(const char* text, int length, uint8_t* columns, int16_t& consumed) {
+	int width = 0;
+	int index = 0;
+	while (index < length) {
+		int next = index;
+		const Glyph& g = glyph(decode(text, length, next));
+		int spacing = width > 0 ? 1 : 0;
+		if (width > 0 && width + spacing + g.width > MAX_RUN_WIDTH) break;
+
+		if (spacing) columns[width++] = 0;
+		memcpy(columns + width, g.columns, g.width);
+		width += g.width;
+		index = next;
+	}
+	consumed = index;
+	return width;
+}
+
+TextRun TextEngine::layout(const char* text, int length) {
+	if (length > MAX_CACHED_BYTES) {
+		TextRun run = {scratch, 0, 0};
+		run.width = render(text, length, scratch, run.consumed);
+		return run;
+	}
+
+	CacheEntry* victim = &cache[0];
+	for (CacheEntry& entry : cache) {
+		if (entry.lastUse && entry.length == length && memcmp(entry.text, text, length) == 0) {
+			entry.lastUse = ++useCounter;
+			stats.hits++;
+			return entry.run;
+		}
+		if (entry.lastUse < victim->lastUse) victim = &entry;
+	}
+
+	stats.misses++;
+	victim->lastUse = ++useCounter;
+	victim->length = length;
+	memcpy(victim->text, text, length);
+	victim->run.columns = victim->columns;
+	victim->run.width = render(text, length, victim->columns, victim->run.consumed);
+	return victim->run;
+}
+
+int TextEngine::wrap(const String& text, int maxWidth, uint8_t size, TextSpan* lines, int maxLines) {
+	const char* s = text.c_str();
+	int length = text.length();
+	int count = 0;
+	int pos = 0;
+
+	while (pos < length && count < maxLines) {
+		while (pos < length && s[pos] == ' ') pos++;
+		if (pos >= length) break;
+
+		int lineStart = pos;
+		int lineEnd = pos;   // End of the last word that fits
+		int index = pos;
+		while (index < length && s[index] != '\n') {
+			int wordStart = index;
+			while (index < length && s[index] != ' ' && s[index] != '\n') index++;
+			int wordEnd = index;
+
+			if (measure(s + lineStart, wordEnd - lineStart, size) <= maxWidth) {
+				lineEnd = wordEnd;
+				while (index < length && s[index] == ' ') index++;
+				continue;
+			}
+
+			if (lineEnd == lineStart) {
+				// The word alone is too wide: break it between glyphs, keeping at least one
+				int probe = wordStart;
+				while (probe < wordEnd) {
+					int next = probe;
+					decode(s, wordEnd, next);
+					if (probe > lineStart && measure(s + lineStart, next - lineStart, size) > maxWidth) break;
+					probe = next;
+				}
+				lineEnd = probe;
+			}
+			break;
+		}
+
+		lines[count].start = lineStart;
+		lines[count].length = lineEnd - lineStart;
+		count++;
+
+		pos = lineEnd;
+		while (pos < length && s[pos] == ' ') pos++;
+		if (pos < length && s[pos] == '\n') pos++;
+	}
+	return count;
+}
+
+TextCacheStats TextEngine::getCacheStats() {
+	return stats;
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <Arduino.h>
+
+// ==============================================
+// Proportional text layout for the classic GFX font
+// ==============================================
+// Glyph ink extents are measured once from the built-in 5x7 font, so text is
+// spaced by what each glyph actually draws rather than a fixed 6px cell.
+// Strings are decoded as UTF-8 and mapped onto the font's CP437 glyphs.
+// Laid-out runs are kept as 1-bpp column bitmaps (bit 0 = top row, as in the
+// font itself) in a small LRU cache; scale and colour are applied when the
+// run is drawn, so one entry serves every size and colour.
+
+// A laid-out line of glyphs at size 1
+struct TextRun {
+	const uint8_t* columns;   // One byte per pixel column
+	int16_t width;            // Columns in use (no trailing spacing)
+	int16_t consumed;         // Source bytes covered by this run
+};
+
+// A line produced by wrap(), as a byte range of the source text
+struct TextSpan {
+	uint16_t start;
+	uint16_t length;
+};
+
+struct TextCacheStats {
+	uint32_t hits;
+	uint32_t misses;
+};
+
+class TextEngine {
+public:
+	static const int GLYPH_ROWS = 8;          // Cell height at size 1
+	static const int MAX_RUN_WIDTH = 192;     // Longer text is drawn as several runs
+	static const int MAX_CACHED_BYTES = 32;   // Longer strings are laid out uncached
+	static const int CACHE_ENTRIES = 16;
+
+	// Width in pixels of text drawn at the given size
+	static int measure(const char* text, int length, uint8_t size = 1);
+	static int measure(const String& text, uint8_t size = 1) {
+		return measure(text.c_str(), text.length(), size);
+	}
+
+	// Width of the widest digit; a cell this wide (plus spacing) fits any
+	static int digitWidth(uint8_t size = 1);
+
+	// Lays out as much of text as fits in MAX_RUN_WIDTH. The returned
+	// columns stay valid until the next call.
+	static TextRun layout(const char* text, int length);
+
+	// Greedy word wrap; words wider than maxWidth are broken between glyphs.
+	// Returns the number of spans written (never more than maxLines).
+	static int wrap(const String& text, int maxWidth, uint8_t size, TextSpan* lines, int maxLines);
+
+	static TextCacheStats getCacheStats();
+
+private:
+	struct Glyph {
+		bool measured;
+		uint8_t width;
+		uint8_t columns[5];
+	};
+
+	struct CacheEntry {
+		uint32_t lastUse;         // 0 = empty
+		uint8_t length;
+		char text[MAX_CACHED_BYTES];
+		TextRun run;
+		uint8_t columns[MAX_RUN_WIDTH];
+	};
+
+	static uint8_t decode(const char* text, int length, int& index);
+	static const Glyph& glyph(uint8_t code);
+	static int render(const char* text, int length, uint8_t* columns, int16_t& consumed);
+
+	static Glyph glyphs[256];
+	static CacheEntry cache[CACHE_ENTRIES];
+	static uint8_t scratch[MAX_RUN_WIDTH];
+	static uint32_t useCounter;
+	static TextCacheStats stats;
+};
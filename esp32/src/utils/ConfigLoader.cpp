@@ -0,0 +1,456 @@
+#include "ConfigLoader.h"
+#include <ArduinoJson.h>
+#include <stddef.h>
+#include <string.h>
+#ifdef ESP32
+#include <SPIFFS.h>
+#endif
+#include "Log.h"
+
+// Static member definitions
+Preferences ConfigLoader::prefs;
+bool ConfigLoader::initialized = false;
+ConfigLoader::RuntimeConfig ConfigLoader::config = {};
+ConfigLoader::RuntimeConfig ConfigLoader::defaults = {};
+ConfigLoader::ConfigSource ConfigLoader::currentSource = ConfigLoader::SOURCE_DEFAULT;
+uint16_t ConfigLoader::loadedVersion = 0;
+uint32_t ConfigLoader::loadMicros = 0;
+uint32_t ConfigLoader::storedCrc = 0;
+bool ConfigLoader::stored = false;
+
+static const char* const SOURCE_NAMES[] = {"defaults", "NVS record", "migrated record", "imported", "runtime"};
+
+// Room for every key of parseConfigJSON at its longest
+static const size_t CONFIG_JSON_CAPACITY = 1536;
+
+// ==============================================
+// Initialization and Loading
+// ==============================================
+
+bool ConfigLoader::initialize() {
+	if (!prefs.begin(PREF_NAMESPACE, false)) {
+		LOG_WARN(MODULE_SYSTEM, "Config: NVS unavailable, using defaults\n");
+		setDefaults();
+		currentSource = SOURCE_DEFAULT;
+		return false;
+	}
+	initialized = true;
+	loadConfiguration();
+	LOG_INFO(MODULE_SYSTEM, "Config: %s (schema %u) in %lu us\n", SOURCE_NAMES[currentSource],
+	         (unsigned)loadedVersion, (unsigned long)loadMicros);
+	return true;
+}
+
+void ConfigLoader::loadConfiguration() {
+	uint32_t started = micros();
+	setDefaults();
+	stored = false;
+	loadedVersion = 0;
+
+	if (loadRecord()) {
+		currentSource = stored ? SOURCE_PREFERENCES : SOURCE_MIGRATED;
+	} else if (importFromPreferences() || importFromSPIFFS()) {
+		currentSource = SOURCE_IMPORTED;
+	} else {
+		currentSource = SOURCE_DEFAULT;
+	}
+	validateConfiguration();
+
+	// Defaults are never written: Config.h has them, and a later build may
+	// change them. Anything else is written back in the current schema.
+	if (!stored && currentSource != SOURCE_DEFAULT) saveRecord();
+	loadMicros = micros() - started;
+}
+
+bool ConfigLoader::saveConfiguration() {
+	if (!initialized) return false;
+	config.overridden = overrides();
+	if (stored && crc32((const uint8_t*)&config, sizeof(config)) == storedCrc) return true;
+	if (!saveRecord()) return false;
+	currentSource = SOURCE_RUNTIME;
+	return true;
+}
+
+void ConfigLoader::resetToDefaults() {
+	setDefaults();
+	saveConfiguration();
+	currentSource = SOURCE_DEFAULT;
+}
+
+// ==============================================
+// NVS Record
+// ==============================================
+
+bool ConfigLoader::loadRecord() {
+	static_assert(sizeof(RecordHeader) + sizeof(RuntimeConfig) <= CONFIG_RECORD_MAX,
+	              "RuntimeConfig has outgrown CONFIG_RECORD_MAX");
+
+	// Big enough for a record from a newer schema, too
+	union {
+		RecordHeader header;
+		uint8_t bytes[CONFIG_RECORD_MAX];
+	} record;
+	size_t length = prefs.getBytes(PREF_CONFIG_RECORD, record.bytes, sizeof(record.bytes));
+	if (length == 0) return false;
+
+	const RecordHeader& header = record.header;
+	const uint8_t* data = record.bytes + sizeof(RecordHeader);
+	if (length < sizeof(RecordHeader) || header.magic != CONFIG_RECORD_MAGIC ||
+	    sizeof(RecordHeader) + header.size != length) {
+		LOG_WARN(MODULE_SYSTEM, "Config: NVS record is malformed\n");
+		return false;
+	}
+	if (crc32(data, header.size) != header.crc) {
+		LOG_WARN(MODULE_SYSTEM, "Config: NVS record fails its CRC\n");
+		return false;
+	}
+
+	// Fields an older schema did not have keep their defaults
+	memcpy(&config, data, header.size < sizeof(config) ? header.size : sizeof(config));
+	terminateFields();
+
+	// A record from before the mask: whatever differs from Config.h was set
+	if (header.size < offsetof(RuntimeConfig, overridden) + sizeof(config.overridden)) {
+		config.overridden = overrides();
+	}
+	followDefaults();
+	loadedVersion = header.version;
+	if (header.version == CONFIG_SCHEMA_VERSION && header.size == sizeof(config)) {
+		storedCrc = header.crc;
+		stored = true;
+	}
+	return true;
+}
+
+bool ConfigLoader::saveRecord() {
+	if (!initialized) return false;
+	config.overridden = overrides();
+	uint8_t record[sizeof(RecordHeader) + sizeof(RuntimeConfig)];
+	RecordHeader header = {CONFIG_RECORD_MAGIC, CONFIG_SCHEMA_VERSION, (uint16_t)sizeof(RuntimeConfig),
+	                       crc32((const uint8_t*)&config, sizeof(config))};
+	memcpy(record, &header, sizeof(header));
+	memcpy(record + sizeof(header), &config, sizeof(config));
+
+	if (prefs.putBytes(PREF_CONFIG_RECORD, record, sizeof(record)) != sizeof(record)) {
+		LOG_WARN(MODULE_SYSTEM, "Config: Could not write the NVS record\n");
+		return false;
+	}
+	storedCrc = header.crc;
+	stored = true;
+	return true;
+}
+
+// ==============================================
+// Import and Export
+// ==============================================
+
+// Setting by setting, as kept before the record
+static const struct {
+	const char* key;
+	bool (*set)(const char*);
+} LEGACY_STRINGS[] = {
+	{PREF_WIFI_SSID, ConfigLoader::setWiFiSSID},
+	{PREF_WIFI_PASS, ConfigLoader::setWiFiPassword},
+	{PREF_HA_SERVER, ConfigLoader::setHAServer},
+	{PREF_HA_TOKEN, ConfigLoader::setHAToken},
+	{PREF_DEVICE_NAME, ConfigLoader::setDeviceName}
+};
+
+static const struct {
+	const char* key;
+	void (*set)(bool);
+} LEGACY_FLAGS[] = {
+	{PREF_DEBUG_MODE, ConfigLoader::setDebugMode},
+	{PREF_AUDIO_ENABLED, ConfigLoader::setAudioEnabled}
+};
+
+bool ConfigLoader::importFromPreferences() {
+	if (!initialized) return false;
+	bool found = false;
+	char text[CONFIG_TOKEN_SIZE];
+	for (const auto& legacy : LEGACY_STRINGS) {
+		if (prefs.getString(legacy.key, text, sizeof(text)) > 0) {
+			found = true;
+			legacy.set(text);
+		}
+	}
+	for (const auto& legacy : LEGACY_FLAGS) {
+		if (prefs.isKey(legacy.key)) {
+			found = true;
+			legacy.set(prefs.getBool(legacy.key));
+		}
+	}
+	if (prefs.isKey(PREF_DISPLAY_COUNT)) {
+		found = true;
+		setDisplayCount(prefs.getInt(PREF_DISPLAY_COUNT, DISPLAY_COUNT));
+	}
+	if (!found) return false;
+
+	// The old keys go only once the record holding them is written
+	validateConfiguration();
+	if (saveRecord()) {
+		for (const auto& legacy : LEGACY_STRINGS) prefs.remove(legacy.key);
+		for (const auto& legacy : LEGACY_FLAGS) prefs.remove(legacy.key);
+		prefs.remove(PREF_DISPLAY_COUNT);
+	}
+	LOG_INFO(MODULE_SYSTEM, "Config: Imported settings from single NVS keys\n");
+	return true;
+}
+
+bool ConfigLoader::importFromSPIFFS() {
+#ifdef ESP32
+	if (!SPIFFS.begin(false)) return false;
+	String json;
+	File file = SPIFFS.open(CONFIG_FILE_PATH, "r");
+	if (file) {
+		json = file.readString();
+		file.close();
+	}
+	SPIFFS.end();
+	if (json.length() == 0) return false;
+
+	if (!parseConfigJSON(json)) {
+		LOG_WARN(MODULE_SYSTEM, "Config: %s is not a valid config\n", CONFIG_FILE_PATH);
+		return false;
+	}
+	LOG_INFO(MODULE_SYSTEM, "Config: Imported %s\n", CONFIG_FILE_PATH);
+	return true;
+#else
+	return false;
+#endif
+}
+
+static void appendJsonString(String& out, const char* text) {
+	out += '"';
+	for (; *text; text++) {
+		if (*text == '"' || *text == '\\') {
+			out += '\\';
+			out += *text;
+		} else if ((uint8_t)*text < 0x20) {
+			char escaped[8];
+			snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned)*text);
+			out += escaped;
+		} else {
+			out += *text;
+		}
+	}
+	out += '"';
+}
+
+static void appendJsonField(String& out, const char* key, const char* value) {
+	out += out.length() > 1 ? ",\"" : "\"";
+	out += key;
+	out += "\":";
+	out += value;
+}
+
+String ConfigLoader::generateConfigJSON(bool includeSecrets) {
+	const struct {
+		const char* key;
+		const char* value;
+		bool secret;
+	} STRINGS[] = {
+		{"device_name", config.deviceName, false},
+		{"wifi_ssid", config.wifiSSID, false},
+		{"wifi_password", config.wifiPassword, true},
+		{"ha_server", config.haServer, false},
+		{"ha_token", config.haToken, true},
+		{"weather_api_key", config.weatherAPIKey, true}
+	};
+
+	String json = "{";
+	for (const auto& field : STRINGS) {
+		if (field.secret && !includeSecrets) continue;
+		String quoted;
+		appendJsonString(quoted, field.value);
+		appendJsonField(json, field.key, quoted.c_str());
+	}
+	char number[12];
+	snprintf(number, sizeof(number), "%lu", (unsigned long)config.updateInterval);
+	appendJsonField(json, "update_interval", number);
+	snprintf(number, sizeof(number), "%u", (unsigned)config.displayCount);
+	appendJsonField(json, "display_count", number);
+	appendJsonField(json, "debug_mode", config.debugMode ? "true" : "false");
+	appendJsonField(json, "audio_enabled", config.audioEnabled ? "true" : "false");
+	appendJsonField(json, "weather_enabled", config.weatherEnabled ? "true" : "false");
+	json += "}";
+	return json;
+}
+
+bool ConfigLoader::parseConfigJSON(const String& json) {
+	static const struct {
+		const char* key;
+		bool (*set)(const char*);
+	} STRINGS[] = {
+		{"device_name", setDeviceName},
+		{"wifi_ssid", setWiFiSSID},
+		{"wifi_password", setWiFiPassword},
+		{"ha_server", setHAServer},
+		{"ha_token", setHAToken},
+		{"weather_api_key", setWeatherAPIKey}
+	};
+	static const struct {
+		const char* key;
+		void (*set)(bool);
+	} FLAGS[] = {
+		{"debug_mode", setDebugMode},
+		{"audio_enabled", setAudioEnabled},
+		{"weather_enabled", setWeatherEnabled}
+	};
+
+	StaticJsonDocument<CONFIG_JSON_CAPACITY> document;
+	if (deserializeJson(document, json.c_str()) || document.isNull()) return false;
+	JsonObjectConst settings = document.as<JsonObjectConst>();
+
+	// All or nothing
+	RuntimeConfig previous = config;
+	bool valid = true;
+	for (const auto& field : STRINGS) {
+		if (settings[field.key].isNull()) continue;
+		const char* value = settings[field.key] | (const char*)nullptr;
+		valid = valid && value && field.set(value);
+	}
+	for (const auto& field : FLAGS) {
+		if (!settings[field.key].isNull()) field.set(settings[field.key] | false);
+	}
+	if (!settings["update_interval"].isNull()) {
+		long interval = settings["update_interval"] | 0L;
+		valid = valid && interval > 0 && setUpdateInterval(interval);
+	}
+	if (!settings["display_count"].isNull()) {
+		int count = settings["display_count"] | 0;
+		valid = valid && count >= 1 && count <= 8;
+		setDisplayCount(count);
+	}
+
+	if (!valid) config = previous;
+	return valid;
+}
+
+// ==============================================
+// Validation and Utilities
+// ==============================================
+
+bool ConfigLoader::validateConfiguration() {
+	bool valid = true;
+	if (config.displayCount < 1 || config.displayCount > 8) {
+		config.displayCount = DISPLAY_COUNT;
+		valid = false;
+	}
+	if (config.updateInterval < MIN_UPDATE_INTERVAL_MS) {
+		config.updateInterval = UPDATE_INTERVAL_MS;
+		valid = false;
+	}
+	if (!config.deviceName[0]) {
+		setDeviceName(DEVICE_NAME);
+		valid = false;
+	}
+	if (!valid) LOG_WARN(MODULE_SYSTEM, "Config: Values out of range reset to defaults\n");
+	return valid;
+}
+
+void ConfigLoader::printConfiguration() {
+	Serial.printf("Config from %s, schema %u (current %u), %u bytes, loaded in %lu us\n",
+	              SOURCE_NAMES[currentSource], (unsigned)loadedVersion, (unsigned)CONFIG_SCHEMA_VERSION,
+	              (unsigned)sizeof(RuntimeConfig), (unsigned long)loadMicros);
+	Serial.println(generateConfigJSON());
+}
+
+// ==============================================
+// Helper functions
+// ==============================================
+
+void ConfigLoader::setDefaults() {
+	// Cleared first, so equal settings are equal records
+	memset(&config, 0, sizeof(config));
+	setWiFiSSID(WIFI_SSID);
+	setWiFiPassword(WIFI_PASSWORD);
+	setHAServer(HA_SERVER);
+	setHAToken(HA_TOKEN);
+	setDeviceName(DEVICE_NAME);
+	setWeatherAPIKey(WEATHER_API_KEY);
+	config.updateInterval = UPDATE_INTERVAL_MS;
+	config.displayCount = DISPLAY_COUNT;
+	config.debugMode = DEBUG_MODE;
+	config.audioEnabled = AUDIO_ENABLED;
+	config.weatherEnabled = false;
+	defaults = config;
+}
+
+// Bit i of overridden stands for entry i; new settings go at the end
+#define CONFIG_FIELD(name) {offsetof(RuntimeConfig, name), sizeof(RuntimeConfig::name)}
+
+const ConfigLoader::Field ConfigLoader::FIELDS[] = {
+	CONFIG_FIELD(wifiSSID),
+	CONFIG_FIELD(wifiPassword),
+	CONFIG_FIELD(haServer),
+	CONFIG_FIELD(haToken),
+	CONFIG_FIELD(deviceName),
+	CONFIG_FIELD(weatherAPIKey),
+	CONFIG_FIELD(updateInterval),
+	CONFIG_FIELD(displayCount),
+	CONFIG_FIELD(debugMode),
+	CONFIG_FIELD(audioEnabled),
+	CONFIG_FIELD(weatherEnabled)
+};
+#undef CONFIG_FIELD
+
+uint32_t ConfigLoader::overrides() {
+	static_assert(sizeof(FIELDS) / sizeof(FIELDS[0]) <= 32, "More settings than bits in overridden");
+	uint32_t mask = 0;
+	for (size_t i = 0; i < sizeof(FIELDS) / sizeof(FIELDS[0]); i++) {
+		if (memcmp((const uint8_t*)&config + FIELDS[i].offset, (const uint8_t*)&defaults + FIELDS[i].offset,
+		           FIELDS[i].size)) {
+			mask |= 1UL << i;
+		}
+	}
+	return mask;
+}
+
+void ConfigLoader::followDefaults() {
+	for (size_t i = 0; i < sizeof(FIELDS) / sizeof(FIELDS[0]); i++) {
+		if (config.overridden & (1UL << i)) continue;
+		memcpy((uint8_t*)&config + FIELDS[i].offset, (const uint8_t*)&defaults + FIELDS[i].offset,
+		       FIELDS[i].size);
+	}
+}
+
+bool ConfigLoader::copyField(char* field, const char* value, size_t size) {
+	size_t length = value ? strlen(value) : size;
+	if (length >= size) return false;
+	memcpy(field, value, length);
+	memset(field + length, 0, size - length);
+	return true;
+}
+
+bool ConfigLoader::isPlainText(const char* text) {
+	if (!text) return false;
+	for (; *text; text++) {
+		if (*text == '"' || *text == '\\' || (uint8_t)*text < 0x20) return false;
+	}
+	return true;
+}
+
+void ConfigLoader::terminateFields() {
+	config.wifiSSID[sizeof(config.wifiSSID) - 1] = '\0';
+	config.wifiPassword[sizeof(config.wifiPassword) - 1] = '\0';
+	config.haServer[sizeof(config.haServer) - 1] = '\0';
+	config.haToken[sizeof(config.haToken) - 1] = '\0';
+	config.deviceName[sizeof(config.deviceName) - 1] = '\0';
+	config.weatherAPIKey[sizeof(config.weatherAPIKey) - 1] = '\0';
+}
+
+uint32_t ConfigLoader::crc32(const uint8_t* data, size_t length) {
+	// Reflected CRC-32 as in zlib, a nibble at a time
+	static const uint32_t TABLE[16] = {
+		0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+		0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+	};
+	uint32_t crc = 0xFFFFFFFF;
+	while (length--) {
+		crc ^= *data++;
+		crc = (crc >> 4) ^ TABLE[crc & 0x0F];
+		crc = (crc >> 4) ^ TABLE[crc & 0x0F];
+	}
+	return ~crc;
+}
@@ -2,150 +2,205 @@
 
 #include <Arduino.h>
 #include <Preferences.h>
-#ifdef ESP32
-#include <SPIFFS.h>
-#endif
 #include "../config/Config.h"
 
 // ==============================================
 // Configuration Loader for ChoreTracker
 // ==============================================
-// Handles loading configuration from multiple sources:
-// 1. Environment variables (compile-time)
-// 2. SPIFFS configuration file
-// 3. Preferences (NVS)
-// 4. Default values
+// Runtime settings live in NVS as one binary record: a header (magic,
+// schema version, size, CRC-32) followed by RuntimeConfig, a plain struct
+// of fixed-size fields. Boot reads the record with one getBytes(), checks
+// the CRC and copies it into place - no parsing and no heap. Config.h
+// provides the defaults, used for anything the record does not hold.
+//
+// The record marks which fields were set away from the defaults; the others
+// are taken from Config.h again on every boot, so new defaults in a new
+// build take effect. A boot on defaults alone writes nothing.
+//
+// RuntimeConfig only ever grows at the end, with CONFIG_SCHEMA_VERSION
+// bumped each time. A record from an older schema is read as far as it goes
+// and the fields added since keep their defaults; one from a newer schema
+// (after a firmware downgrade) gives the fields this one knows. Either way
+// it is written back in the current schema. Settings from before the
+// record - one NVS key each (PREF_* below), or SPIFFS /config.json - are
+// imported on the first boot without one.
+//
+// JSON is only for import and export: generateConfigJSON/parseConfigJSON.
+
+#define CONFIG_SCHEMA_VERSION 2
+#define CONFIG_RECORD_MAGIC 0x47464343   // "CCFG"
+#define CONFIG_RECORD_MAX 1024           // Header and config, any schema
+
+// Field sizes include the terminator
+#define CONFIG_SSID_SIZE 33
+#define CONFIG_PASSWORD_SIZE 65
+#define CONFIG_SERVER_SIZE 96
+#define CONFIG_TOKEN_SIZE 256
+#define CONFIG_NAME_SIZE 32
+#define CONFIG_API_KEY_SIZE 48
 
 class ConfigLoader {
 private:
     static Preferences prefs;
     static bool initialized;
-    
-    // Configuration storage
+
+    // Configuration storage; fields are only ever appended (see above)
     struct RuntimeConfig {
-        String wifiSSID;
-        String wifiPassword;
-        String haServer;
-        String haToken;
-        String deviceName;
-        int displayCount;
+        char wifiSSID[CONFIG_SSID_SIZE];
+        char wifiPassword[CONFIG_PASSWORD_SIZE];
+        char haServer[CONFIG_SERVER_SIZE];
+        char haToken[CONFIG_TOKEN_SIZE];
+        char deviceName[CONFIG_NAME_SIZE];
+        char weatherAPIKey[CONFIG_API_KEY_SIZE];
+        uint32_t updateInterval;      // ms
+        uint8_t displayCount;
         bool debugMode;
         bool audioEnabled;
-        String weatherAPIKey;
         bool weatherEnabled;
+        uint32_t overridden;          // Fields that differ from Config.h, bit per FIELDS entry (schema 2)
     };
-    
+
+    struct RecordHeader {
+        uint32_t magic;
+        uint16_t version;             // CONFIG_SCHEMA_VERSION it was written with
+        uint16_t size;                // Bytes of config that follow
+        uint32_t crc;                 // CRC-32 of those bytes
+    };
+
+    // Where each setting sits in RuntimeConfig
+    struct Field {
+        uint16_t offset;
+        uint16_t size;
+    };
+
+    static const Field FIELDS[];
     static RuntimeConfig config;
+    static RuntimeConfig defaults;    // Config.h, as setDefaults() left it
 
 public:
     // ==============================================
     // Initialization and Loading
     // ==============================================
-    
+
+    // Opens NVS and loads; false when NVS could not be opened, leaving the
+    // defaults in place
     static bool initialize();
     static void loadConfiguration();
+
+    // Writes the record, unless NVS already holds exactly this
     static bool saveConfiguration();
     static void resetToDefaults();
-    
+
     // ==============================================
     // Configuration Getters
     // ==============================================
-    
-    static String getWiFiSSID() { return config.wifiSSID; }
-    static String getWiFiPassword() { return config.wifiPassword; }
-    static String getHAServer() { return config.haServer; }
-    static String getHAToken() { return config.haToken; }
-    static String getDeviceName() { return config.deviceName; }
+
+    static const char* getWiFiSSID() { return config.wifiSSID; }
+    static const char* getWiFiPassword() { return config.wifiPassword; }
+    static const char* getHAServer() { return config.haServer; }
+    static const char* getHAToken() { return config.haToken; }
+    static const char* getDeviceName() { return config.deviceName; }
     static int getDisplayCount() { return config.displayCount; }
     static bool isDebugMode() { return config.debugMode; }
     static bool isAudioEnabled() { return config.audioEnabled; }
-    static String getWeatherAPIKey() { return config.weatherAPIKey; }
+    static const char* getWeatherAPIKey() { return config.weatherAPIKey; }
     static bool isWeatherEnabled() { return config.weatherEnabled; }
-    
+    static uint32_t getUpdateInterval() { return config.updateInterval; }
+
     // ==============================================
     // Configuration Setters
     // ==============================================
-    
-    static void setWiFiSSID(const String& ssid) { config.wifiSSID = ssid; }
-    static void setWiFiPassword(const String& password) { config.wifiPassword = password; }
-    static void setHAServer(const String& server) { config.haServer = server; }
-    static void setHAToken(const String& token) { config.haToken = token; }
-    static void setDeviceName(const String& name) { config.deviceName = name; }
-    static void setDisplayCount(int count) { 
+    // Strings too long for their field, and intervals below
+    // MIN_UPDATE_INTERVAL_MS, are refused (false)
+
+    static bool setWiFiSSID(const char* ssid) { return copyField(config.wifiSSID, ssid, sizeof(config.wifiSSID)); }
+    static bool setWiFiPassword(const char* password) {
+        return copyField(config.wifiPassword, password, sizeof(config.wifiPassword));
+    }
+    static bool setHAServer(const char* server) { return copyField(config.haServer, server, sizeof(config.haServer)); }
+    static bool setHAToken(const char* token) { return copyField(config.haToken, token, sizeof(config.haToken)); }
+
+    // Goes out in JSON as it is, so no quotes, backslashes or control characters
+    static bool setDeviceName(const char* name) {
+        return isPlainText(name) && copyField(config.deviceName, name, sizeof(config.deviceName));
+    }
+    static void setDisplayCount(int count) {
         if (count >= 1 && count <= 8) {
-            config.displayCount = count; 
+            config.displayCount = count;
         }
     }
     static void setDebugMode(bool enabled) { config.debugMode = enabled; }
     static void setAudioEnabled(bool enabled) { config.audioEnabled = enabled; }
-    static void setWeatherAPIKey(const String& key) { config.weatherAPIKey = key; }
+    static bool setWeatherAPIKey(const char* key) {
+        return copyField(config.weatherAPIKey, key, sizeof(config.weatherAPIKey));
+    }
     static void setWeatherEnabled(bool enabled) { config.weatherEnabled = enabled; }
-    
-    // ==============================================
-    // SPIFFS Configuration File
-    // ==============================================
-    
-    static bool loadFromSPIFFS();
-    static bool saveToSPIFFS();
-    static bool fileExists(const String& filename);
-    
+    static bool setUpdateInterval(uint32_t ms) {
+        if (ms < MIN_UPDATE_INTERVAL_MS) return false;
+        config.updateInterval = ms;
+        return true;
+    }
+
     // ==============================================
-    // Preferences (NVS) Storage
+    // NVS Record
     // ==============================================
-    
-    static bool loadFromPreferences();
-    static bool saveToPreferences();
-    static void clearPreferences();
-    
+
+    static bool loadRecord();
+    static bool saveRecord();
+
     // ==============================================
-    // Environment Variable Loading
+    // Import and Export
     // ==============================================
-    
-    static void loadFromEnvironment();
-    static String getEnvVar(const String& varName, const String& defaultValue = "");
-    static int getEnvVarInt(const String& varName, int defaultValue = 0);
-    static bool getEnvVarBool(const String& varName, bool defaultValue = false);
-    
+
+    // Older storage, read once when there is no record yet
+    static bool importFromPreferences();
+    static bool importFromSPIFFS();
+
+    // DeviceConfig-style keys (shared/api); secrets only when asked for
+    static String generateConfigJSON(bool includeSecrets = false);
+
+    // Applies the keys present; false, changing nothing, when the JSON is
+    // not an object or a value does not fit
+    static bool parseConfigJSON(const String& json);
+
     // ==============================================
     // Validation and Utilities
     // ==============================================
-    
+
     static bool validateConfiguration();
     static void printConfiguration();
-    static String generateConfigJSON();
-    static bool parseConfigJSON(const String& json);
-    
-    // ==============================================
-    // GPIO Pin Configuration Loading
-    // ==============================================
-    
-    static bool loadGPIOConfiguration();
-    static void parseGPIOPins(const String& pinString, int* pinArray, int maxPins);
-    
+
     // ==============================================
-    // Configuration Source Priority
+    // Configuration Source
     // ==============================================
-    
+
     enum ConfigSource {
-        SOURCE_DEFAULT = 0,
-        SOURCE_ENVIRONMENT = 1,
-        SOURCE_SPIFFS = 2,
-        SOURCE_PREFERENCES = 3,
-        SOURCE_RUNTIME = 4
+        SOURCE_DEFAULT = 0,           // Config.h
+        SOURCE_PREFERENCES = 1,       // The NVS record
+        SOURCE_MIGRATED = 2,          // A record from another schema
+        SOURCE_IMPORTED = 3,          // Legacy NVS keys or /config.json
+        SOURCE_RUNTIME = 4            // Changed since boot
     };
-    
+
     static ConfigSource getConfigSource() { return currentSource; }
-    static void setConfigSource(ConfigSource source) { currentSource = source; }
-    
+    static uint16_t getLoadedVersion() { return loadedVersion; }
+    static uint32_t getLoadMicros() { return loadMicros; }
+
 private:
     static ConfigSource currentSource;
-    
+    static uint16_t loadedVersion;    // Schema of the record read at boot; 0 = none
+    static uint32_t loadMicros;       // How long loadConfiguration() took
+    static uint32_t storedCrc;        // Of the record in NVS; saves skip when unchanged
+    static bool stored;
+
     // Helper functions
     static void setDefaults();
-    static String sanitizeString(const String& input);
-    static bool isValidSSID(const String& ssid);
-    static bool isValidURL(const String& url);
-    static bool isValidToken(const String& token);
+    static uint32_t overrides();
+    static void followDefaults();
+    static bool copyField(char* field, const char* value, size_t size);
+    static bool isPlainText(const char* text);
+    static void terminateFields();
+    static uint32_t crc32(const uint8_t* data, size_t length);
 };
 
 // ==============================================
@@ -161,35 +216,22 @@ private:
 #define CONFIG_DISPLAY_COUNT() ConfigLoader::getDisplayCount()
 #define CONFIG_DEBUG_MODE() ConfigLoader::isDebugMode()
 #define CONFIG_AUDIO_ENABLED() ConfigLoader::isAudioEnabled()
-
-// ==============================================
-// Environment Variable Names
-// ==============================================
-
-#define ENV_WIFI_SSID "WIFI_SSID"
-#define ENV_WIFI_PASSWORD "WIFI_PASSWORD"
-#define ENV_HA_SERVER "HA_SERVER"
-#define ENV_HA_TOKEN "HA_TOKEN"
-#define ENV_DEVICE_NAME "DEVICE_NAME"
-#define ENV_DISPLAY_COUNT "DISPLAY_COUNT"
-#define ENV_DEBUG_MODE "DEBUG_MODE"
-#define ENV_AUDIO_ENABLED "AUDIO_ENABLED"
-#define ENV_WEATHER_API_KEY "WEATHER_API_KEY"
-#define ENV_WEATHER_ENABLED "WEATHER_ENABLED"
+#define CONFIG_UPDATE_INTERVAL() ConfigLoader::getUpdateInterval()
 
 // ==============================================
 // Configuration File Paths
 // ==============================================
 
 #define CONFIG_FILE_PATH "/config.json"
-#define GPIO_CONFIG_FILE_PATH "/gpio_config.json"
-#define BACKUP_CONFIG_PATH "/config_backup.json"
 
 // ==============================================
 // Preference Keys
 // ==============================================
 
 #define PREF_NAMESPACE "choretracker"
+#define PREF_CONFIG_RECORD "config"
+
+// One key per setting, before the record; imported, then removed
 #define PREF_WIFI_SSID "wifi_ssid"
 #define PREF_WIFI_PASS "wifi_pass"
 #define PREF_HA_SERVER "ha_server"
@@ -197,4 +239,4 @@ private:
 #define PREF_DEVICE_NAME "device_name"
 #define PREF_DISPLAY_COUNT "display_count"
 #define PREF_DEBUG_MODE "debug_mode"
-#define PREF_AUDIO_ENABLED "audio_enabled" 
\ No newline at end of file
+#define PREF_AUDIO_ENABLED "audio_enabled"
@@ -0,0 +1,254 @@
+#include "Log.h"
+#ifdef ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+static_assert((LOG_BUFFER_BYTES & (LOG_BUFFER_BYTES - 1)) == 0, "LOG_BUFFER_BYTES must be a power of two");
+
+// Static member definitions
+constexpr uint8_t Log::LEVELS[MODULE_COUNT];
+const int Log::MAX_STRING;
+uint8_t Log::ring[BUFFER_BYTES];
+uint32_t Log::head = 0;
+uint32_t Log::tail = 0;
+LogStats Log::stats = {0, 0, 0};
+
+// Producers run on both cores and in timer callbacks; the copy is short
+#ifdef ESP32
+static portMUX_TYPE ringLock = portMUX_INITIALIZER_UNLOCKED;
+#define LOCK_RING() portENTER_CRITICAL(&ringLock)
+#define UNLOCK_RING() portEXIT_CRITICAL(&ringLock)
+#else
+#define LOCK_RING()
+#define UNLOCK_RING()
+#endif
+
+// Record header: length, module/level, millis, format pointer
+static const int HEADER_BYTES = 2 + 4 + sizeof(const char*);
+
+// Drain task: low priority, wakes every period
+static const uint32_t DRAIN_PERIOD_MS = 20;
+static const int DRAIN_BATCH = 32;
+
+static const char* const MODULE_NAMES[MODULE_COUNT] = {
+	"SYSTEM", "GPIO", "NAV", "DISPLAY", "DEMO", "SCHED", "NET"
+};
+
+void Log::Record::begin(LogModule module, LogLevel level, const char* format) {
+	length = 0;
+	uint8_t header[2] = {0, (uint8_t)((module << 4) | level)};
+	uint32_t now = millis();
+	putBytes(header, 2);
+	putBytes(&now, 4);
+	putBytes(&format, sizeof(format));
+}
+
+void Log::Record::putBytes(const void* data, int count) {
+	if (length + count > MAX_RECORD) return;
+	memcpy(bytes + length, data, count);
+	length += count;
+}
+
+void Log::Record::putTagged(uint8_t tag, uint32_t value) {
+	if (length + 5 > MAX_RECORD) return;
+	bytes[length++] = tag;
+	memcpy(bytes + length, &value, 4);
+	length += 4;
+}
+
+void Log::Record::put(double value) {
+	float narrow = (float)value;
+	uint32_t raw;
+	memcpy(&raw, &narrow, 4);
+	putTagged(LOG_ARG_FLOAT, raw);
+}
+
+void Log::Record::put(const char* value) {
+	if (!value) value = "(null)";
+	int count = min<int>(strlen(value), MAX_STRING);
+	if (length + 2 + count > MAX_RECORD) return;
+	bytes[length++] = LOG_ARG_STRING;
+	bytes[length++] = (uint8_t)count;
+	memcpy(bytes + length, value, count);
+	length += count;
+}
+
+void Log::commit(const Record& record) {
+	uint8_t length = (uint8_t)record.length;
+	
+	LOCK_RING();
+	uint32_t used = head - tail;
+	if (used + length > BUFFER_BYTES) {
+		stats.dropped++;
+		UNLOCK_RING();
+		return;
+	}
+	
+	// Byte ring: the record may wrap around the end
+	uint32_t start = head & (BUFFER_BYTES - 1);
+	uint32_t first = min<uint32_t>(length, BUFFER_BYTES - start);
+	memcpy(ring + start, record.bytes, first);
+	memcpy(ring, record.bytes + first, length - first);
+	ring[start] = length;
+	head += length;
+	
+	stats.records++;
+	if (used + length > stats.highWater) stats.highWater = used + length;
+	UNLOCK_RING();
+}
+
+int Log::drain(int maxRecords) {
+	uint8_t record[MAX_RECORD];
+	int drained = 0;
+	
+	while (drained < maxRecords) {
+		LOCK_RING();
+		if (head == tail) {
+			UNLOCK_RING();
+			break;
+		}
+		uint32_t start = tail & (BUFFER_BYTES - 1);
+		int length = ring[start];
+		uint32_t first = min<uint32_t>(length, BUFFER_BYTES - start);
+		memcpy(record, ring + start, first);
+		memcpy(record + first, ring, length - first);
+		tail += length;
+		UNLOCK_RING();
+		
+		if (LOG_BINARY_OUTPUT) {
+			emitBinary(record, length);
+		} else {
+			emitText(record, length);
+		}
+		drained++;
+	}
+	return drained;
+}
+
+void Log::flush() {
+	while (drain(DRAIN_BATCH) > 0) {}
+}
+
+bool Log::startDrainTask() {
+#ifdef ESP32
+	if (xTaskCreate(taskMain, "log", 4096, nullptr, 1, nullptr) == pdPASS) {
+		return true;
+	}
+	Serial.println("Log: Could not create drain task - draining from loop()");
+#endif
+	return false;
+}
+
+void Log::taskMain(void* parameter) {
+	(void)parameter;
+	for (;;) {
+		drain(DRAIN_BATCH);
+		delay(DRAIN_PERIOD_MS);
+	}
+}
+
+LogStats Log::getStats() {
+	LOCK_RING();
+	LogStats copy = stats;
+	UNLOCK_RING();
+	return copy;
+}
+
+uint32_t Log::formatId(const char* format) {
+	uint32_t hash = 2166136261u;
+	for (const uint8_t* p = (const uint8_t*)format; *p; p++) {
+		hash = (hash ^ *p) * 16777619u;
+	}
+	return hash;
+}
+
+void Log::emitBinary(const uint8_t* record, int length) {
+	// Sync, payload length, then the record with the pointer swapped for the id
+	const char* format;
+	memcpy(&format, record + 6, sizeof(format));
+	uint32_t id = formatId(format);
+	
+	uint8_t header[2 + 1 + 4 + 4];
+	int payload = length - HEADER_BYTES + 1 + 4 + 4;
+	header[0] = BINARY_SYNC;
+	header[1] = (uint8_t)payload;
+	header[2] = record[1];
+	memcpy(header + 3, record + 2, 4);
+	memcpy(header + 7, &id, 4);
+	Serial.write(header, sizeof(header));
+	Serial.write(record + HEADER_BYTES, length - HEADER_BYTES);
+}
+
+void Log::emitText(const uint8_t* record, int length) {
+	const char* format;
+	memcpy(&format, record + 6, sizeof(format));
+	const uint8_t* arg = record + HEADER_BYTES;
+	const uint8_t* end = record + length;
+	
+	// printf one conversion at a time, taking each argument from the record
+	char line[192];
+	int out = 0;
+	const char* p = format;
+	while (*p && out < (int)sizeof(line) - 1) {
+		if (*p != '%') {
+			line[out++] = *p++;
+			continue;
+		}
+		if (p[1] == '%') {
+			line[out++] = '%';
+			p += 2;
+			continue;
+		}
+		
+		// Copy the conversion spec, noting a long modifier
+		char spec[16];
+		int n = 0;
+		bool isLong = false;
+		spec[n++] = *p++;
+		while (*p && !strchr("diuxXcsfeEgGp", *p) && n < (int)sizeof(spec) - 2) {
+			if (*p == 'l') isLong = true;
+			spec[n++] = *p++;
+		}
+		if (!*p) break;
+		char conversion = *p++;
+		spec[n++] = conversion;
+		spec[n] = '\0';
+		
+		int room = sizeof(line) - out;
+		int written = 0;
+		if (arg >= end) {
+			written = snprintf(line + out, room, "?");
+		} else if (*arg == LOG_ARG_STRING) {
+			char text[MAX_STRING + 1];
+			int count = arg[1];
+			memcpy(text, arg + 2, count);
+			text[count] = '\0';
+			arg += 2 + count;
+			written = snprintf(line + out, room, spec, text);
+		} else {
+			uint32_t raw;
+			memcpy(&raw, arg + 1, 4);
+			uint8_t tag = *arg;
+			arg += 5;
+			if (tag == LOG_ARG_FLOAT) {
+				float value;
+				memcpy(&value, &raw, 4);
+				written = snprintf(line + out, room, spec, (double)value);
+			} else if (isLong) {
+				if (tag == LOG_ARG_INT) written = snprintf(line + out, room, spec, (long)(int32_t)raw);
+				else written = snprintf(line + out, room, spec, (unsigned long)raw);
+			} else {
+				if (tag == LOG_ARG_INT) written = snprintf(line + out, room, spec, (int)(int32_t)raw);
+				else written = snprintf(line + out, room, spec, (unsigned int)raw);
+			}
+		}
+		out += max(0, min(written, room - 1));
+	}
+	line[out] = '\0';
+	
+	if (record[1] >> 4 < MODULE_COUNT && (record[1] & 0x0F) <= LEVEL_WARN) {
+		Serial.printf("[%s] ", MODULE_NAMES[record[1] >> 4]);
+	}
+	Serial.print(line);
+}
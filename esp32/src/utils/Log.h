@@ -0,0 +1,138 @@
+#pragma once
+#include <Arduino.h>
+#include <type_traits>
+#include "../config/LogConfig.h"
+
+// ==============================================
+// Deferred, compile-time filtered logging
+// ==============================================
+// LOG_INFO(MODULE_GPIO, "Task %d done\n", i) costs nothing when GPIO is
+// below info: the level test is a constant, so the call and its format
+// string compile out. An enabled message is stored as a binary record - the
+// format string pointer and its arguments, each tagged with its type - in a
+// RAM ring buffer, and never waits for the UART. A low-priority task drains
+// the ring to Serial, either formatted as text or, with LOG_BINARY_OUTPUT,
+// as raw records keyed by a hash of the format string, which
+// tools/log_decode.py turns back into text using the sources.
+// A full ring drops records (and counts them) rather than block.
+
+enum LogModule : uint8_t {
+	MODULE_SYSTEM = 0,
+	MODULE_GPIO,
+	MODULE_NAV,
+	MODULE_DISPLAY,
+	MODULE_DEMO,
+	MODULE_SCHED,
+	MODULE_NET,
+	MODULE_COUNT
+};
+
+enum LogLevel : uint8_t {
+	LEVEL_OFF = 0,
+	LEVEL_ERROR,
+	LEVEL_WARN,
+	LEVEL_INFO,
+	LEVEL_DEBUG
+};
+
+// Argument type tags, shared with tools/log_decode.py
+enum LogArgTag : uint8_t {
+	LOG_ARG_INT = 'i',        // int32
+	LOG_ARG_UINT = 'u',       // uint32
+	LOG_ARG_FLOAT = 'f',      // float
+	LOG_ARG_STRING = 's'      // uint8 length, then bytes
+};
+
+struct LogStats {
+	uint32_t records;
+	uint32_t dropped;         // Ring was full
+	uint32_t highWater;       // Most bytes ever waiting
+};
+
+class Log {
+public:
+	static const size_t BUFFER_BYTES = LOG_BUFFER_BYTES;
+	static const int MAX_RECORD = 128;
+	static const int MAX_STRING = 48;         // Longer string arguments are cut
+	static const uint8_t BINARY_SYNC = 0xA5;  // Starts every binary record
+
+	static constexpr uint8_t LEVELS[MODULE_COUNT] = {
+		LOG_LEVEL_SYSTEM, LOG_LEVEL_GPIO, LOG_LEVEL_NAV,
+		LOG_LEVEL_DISPLAY, LOG_LEVEL_DEMO, LOG_LEVEL_SCHED, LOG_LEVEL_NET
+	};
+
+	static constexpr bool enabled(LogModule module, LogLevel level) {
+		return level <= LEVELS[module];
+	}
+
+	// Starts the drain task; false where there is none (drain() from loop)
+	static bool startDrainTask();
+
+	// Writes out up to maxRecords waiting records; returns how many
+	static int drain(int maxRecords);
+	static void flush();
+
+	static LogStats getStats();
+
+	// FNV-1a of the format string, the record id in binary output
+	static uint32_t formatId(const char* format);
+
+	template <typename... Args>
+	static void write(LogModule module, LogLevel level, const char* format, Args... args) {
+		Record record;
+		record.begin(module, level, format);
+		record.add(args...);
+		commit(record);
+	}
+
+private:
+	struct Record {
+		uint8_t bytes[MAX_RECORD];
+		int length;             // Arguments that do not fit are left off
+
+		void begin(LogModule module, LogLevel level, const char* format);
+		void add() {}
+		template <typename T, typename... Rest>
+		void add(T value, Rest... rest) {
+			put(value);
+			add(rest...);
+		}
+
+		template <typename T>
+		typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type put(T value) {
+			if (std::is_signed<T>::value) {
+				putTagged(LOG_ARG_INT, (uint32_t)(int32_t)value);
+			} else {
+				putTagged(LOG_ARG_UINT, (uint32_t)value);
+			}
+		}
+		void put(double value);
+		void put(const char* value);
+		void put(const String& value) { put(value.c_str()); }
+		void putTagged(uint8_t tag, uint32_t value);
+		void putBytes(const void* data, int count);
+	};
+
+	static void commit(const Record& record);
+	static void emitText(const uint8_t* record, int length);
+	static void emitBinary(const uint8_t* record, int length);
+	static void taskMain(void* parameter);
+
+	static uint8_t ring[BUFFER_BYTES];
+	static uint32_t head;       // Producers, under the lock
+	static uint32_t tail;       // Drain only
+	static LogStats stats;
+};
+
+// Level test is a template argument, so it is always settled at compile time
+#define LOG_AT(module, level, format, ...) \
+	do { \
+		if (std::integral_constant<bool, Log::enabled(module, level)>::value) { \
+			Log::write(module, level, format, ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+#define LOG_ERROR(module, format, ...) LOG_AT(module, LEVEL_ERROR, format, ##__VA_ARGS__)
+#define LOG_WARN(module, format, ...) LOG_AT(module, LEVEL_WARN, format, ##__VA_ARGS__)
+#define LOG_INFO(module, format, ...) LOG_AT(module, LEVEL_INFO, format, ##__VA_ARGS__)
+#define LOG_DEBUG(module, format, ...) LOG_AT(module, LEVEL_DEBUG, format, ##__VA_ARGS__)
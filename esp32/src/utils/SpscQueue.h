@@ -0,0 +1,52 @@
+#pragma once
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// ==============================================
+// Lock-free single-producer/single-consumer queue
+// ==============================================
+// One thread (or core) pushes, one other pops; neither ever blocks or takes
+// a lock. The counters only ever grow, so full and empty are told apart
+// without a spare slot. Plain C++ with no Arduino dependency, so the same
+// header builds for the ESP32 and for host threads.
+
+template <typename T, size_t Capacity>
+class SpscQueue {
+	static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+	SpscQueue() : head(0), tail(0) {}
+
+	// Producer side. False (and nothing written) when the queue is full.
+	bool push(const T& item) {
+		uint32_t write = head.load(std::memory_order_relaxed);
+		if (write - tail.load(std::memory_order_acquire) == Capacity) return false;
+		slots[write & MASK] = item;
+		head.store(write + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer side. False when there is nothing to take.
+	bool pop(T& item) {
+		uint32_t read = tail.load(std::memory_order_relaxed);
+		if (read == head.load(std::memory_order_acquire)) return false;
+		item = slots[read & MASK];
+		tail.store(read + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Either side; exact only from the consumer
+	size_t size() const {
+		return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+	}
+	bool empty() const { return size() == 0; }
+	static constexpr size_t capacity() { return Capacity; }
+
+private:
+	static const uint32_t MASK = Capacity - 1;
+
+	T slots[Capacity];
+	std::atomic<uint32_t> head;   // Next slot to write (producer owned)
+	std::atomic<uint32_t> tail;   // Next slot to read (consumer owned)
+};
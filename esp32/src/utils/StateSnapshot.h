@@ -0,0 +1,47 @@
+#pragma once
+#include <atomic>
+#include <stdint.h>
+
+// ==============================================
+// Latest-value snapshot between two threads
+// ==============================================
+// Triple buffer: the writer fills its back buffer and swaps it into the
+// middle; the reader swaps the middle out for its front buffer. Each buffer
+// is only ever touched by one side at a time, so T may own heap data
+// (Strings) and neither side waits. The reader always sees a whole,
+// consistent value - the newest one, with older ones skipped. Plain C++ with
+// no Arduino dependency, so it builds for the ESP32 and for host threads.
+
+template <typename T>
+class StateSnapshot {
+public:
+	StateSnapshot() : middle(1), back(0), front(2) {}
+
+	// Writer side
+	void publish(const T& value) {
+		buffers[back] = value;
+		uint8_t previous = middle.exchange(back | FRESH, std::memory_order_acq_rel);
+		back = previous & INDEX;
+	}
+
+	// Reader side: takes the newest value if there is one. True when the
+	// value returned by current() changed.
+	bool refresh() {
+		if (!(middle.load(std::memory_order_relaxed) & FRESH)) return false;
+		uint8_t previous = middle.exchange(front, std::memory_order_acq_rel);
+		front = previous & INDEX;
+		return true;
+	}
+
+	// Reader side: stays valid and unchanged until the next refresh()
+	const T& current() const { return buffers[front]; }
+
+private:
+	static const uint8_t INDEX = 0x03;
+	static const uint8_t FRESH = 0x04;
+
+	T buffers[3];
+	std::atomic<uint8_t> middle;   // Index of the hand-over buffer, plus FRESH
+	uint8_t back;                  // Writer owned
+	uint8_t front;                 // Reader owned
+};
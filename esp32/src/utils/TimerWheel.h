@@ -0,0 +1,177 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// ==============================================
+// Hierarchical timer wheel
+// ==============================================
+// One timer per id (0 to Capacity-1), at a resolution of one tick. Four
+// levels of 64 slots reach 64, 4096, 262144 and 16.7M ticks ahead. A timer
+// is filed in the level its distance falls in, and moves down a level each
+// time the wheel turns past its slot. schedule() and cancel() are O(1).
+// Each tick of advance() visits one slot, plus a cascade every 64 ticks,
+// however many timers are pending. Slots are linked lists threaded through
+// per-id nodes, so nothing allocates. Plain C++ with no Arduino dependency,
+// so it builds for the ESP32 and for host tests.
+
+template <size_t Capacity>
+class TimerWheel {
+	static_assert(Capacity > 0 && Capacity < 255, "TimerWheel ids must fit in a byte");
+
+public:
+	static const uint8_t NONE = 0xFF;
+
+	TimerWheel() { reset(0); }
+
+	// Drops every timer and sets the current tick
+	void reset(uint32_t now) {
+		current = now;
+		count = 0;
+		for (int i = 0; i < LEVELS * SLOTS; i++) heads[i] = NONE;
+		for (size_t i = 0; i < Capacity; i++) nodes[i].slot = NO_SLOT;
+	}
+
+	uint32_t now() const { return current; }
+	size_t size() const { return count; }
+	bool pending(uint8_t id) const { return nodes[id].slot != NO_SLOT; }
+	uint32_t expiry(uint8_t id) const { return nodes[id].expires; }
+
+	// Replaces any timer id already had. False (and nothing scheduled) when
+	// expires is not in the future; the caller handles that itself.
+	bool schedule(uint8_t id, uint32_t expires) {
+		cancel(id);
+		if ((int32_t)(expires - current) <= 0) return false;
+		nodes[id].expires = expires;
+		file(id);
+		count++;
+		return true;
+	}
+
+	void cancel(uint8_t id) {
+		Node& node = nodes[id];
+		if (node.slot == NO_SLOT) return;
+		unlink(id);
+		node.slot = NO_SLOT;
+		count--;
+	}
+
+	// Moves time forward to the given tick, calling expired(id) for each timer
+	// that comes due, in expiry order. The callback may schedule and cancel.
+	template <typename Callback>
+	void advance(uint32_t to, Callback expired) {
+		while ((int32_t)(to - current) > 0) {
+			if (count == 0) {
+				current = to;
+				return;
+			}
+			step(expired);
+		}
+	}
+
+	// Jumps to a new current tick without walking the ticks in between (a
+	// clock being set). Timers already due expire now; the rest are re-filed.
+	template <typename Callback>
+	void rebase(uint32_t now, Callback expired) {
+		uint8_t due[Capacity];
+		size_t dueCount = 0;
+		current = now;
+		for (size_t id = 0; id < Capacity; id++) {
+			if (nodes[id].slot == NO_SLOT) continue;
+			unlink(id);
+			if ((int32_t)(nodes[id].expires - current) <= 0) {
+				nodes[id].slot = NO_SLOT;
+				count--;
+				due[dueCount++] = id;
+			} else {
+				file(id);
+			}
+		}
+		for (size_t i = 0; i < dueCount; i++) expired(due[i]);
+	}
+
+private:
+	static const int LEVELS = 4;
+	static const int SLOTS = 64;
+	static const int SLOT_BITS = 6;
+	static const uint16_t NO_SLOT = 0xFFFF;
+	static const uint32_t HORIZON = 1u << (LEVELS * SLOT_BITS);
+
+	struct Node {
+		uint32_t expires;
+		uint16_t slot;      // Index into heads, or NO_SLOT
+		uint8_t next;
+		uint8_t prev;
+	};
+
+	template <typename Callback>
+	void step(Callback expired) {
+		current++;
+
+		// Coarse levels first, so their timers can cascade all the way down
+		for (int level = LEVELS - 1; level > 0; level--) {
+			uint32_t span = 1u << (level * SLOT_BITS);
+			if (current & (span - 1)) continue;
+			uint16_t slot = level * SLOTS + ((current >> (level * SLOT_BITS)) & (SLOTS - 1));
+			uint8_t id = heads[slot];
+			heads[slot] = NONE;
+			while (id != NONE) {
+				uint8_t next = nodes[id].next;
+				file(id);
+				id = next;
+			}
+		}
+
+		// Everything left in this slot is due now. Detach the list first so
+		// the callback can reschedule freely.
+		uint16_t slot = current & (SLOTS - 1);
+		uint8_t id = heads[slot];
+		heads[slot] = NONE;
+		while (id != NONE) {
+			uint8_t next = nodes[id].next;
+			if (nodes[id].expires == current) {
+				nodes[id].slot = NO_SLOT;
+				count--;
+				expired(id);
+			} else {
+				file(id);
+			}
+			id = next;
+		}
+	}
+
+	void file(uint8_t id) {
+		Node& node = nodes[id];
+		uint32_t delta = node.expires - current;
+		uint32_t target = node.expires;
+		if (delta >= HORIZON) {
+			// Beyond the wheel: park in the furthest slot and re-file from there
+			target = current + HORIZON - 1;
+			delta = HORIZON - 1;
+		}
+
+		int level = 0;
+		while (level < LEVELS - 1 && delta >= (1u << ((level + 1) * SLOT_BITS))) level++;
+		uint16_t slot = level * SLOTS + ((target >> (level * SLOT_BITS)) & (SLOTS - 1));
+
+		node.slot = slot;
+		node.prev = NONE;
+		node.next = heads[slot];
+		if (node.next != NONE) nodes[node.next].prev = id;
+		heads[slot] = id;
+	}
+
+	void unlink(uint8_t id) {
+		Node& node = nodes[id];
+		if (node.prev != NONE) {
+			nodes[node.prev].next = node.next;
+		} else {
+			heads[node.slot] = node.next;
+		}
+		if (node.next != NONE) nodes[node.next].prev = node.prev;
+	}
+
+	Node nodes[Capacity];
+	uint8_t heads[LEVELS * SLOTS];
+	uint32_t current;
+	size_t count;
+};
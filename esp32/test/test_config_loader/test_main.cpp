@@ -0,0 +1,115 @@
+#include <unity.h>
+#include <Preferences.h>
+#include <string.h>
+#include "../../src/utils/ConfigLoader.h"
+
+// ==============================================
+// ConfigLoader's NVS record across reboots
+// ==============================================
+// initialize() is a boot: it reads whatever the record in NVS holds. A
+// build with other Config.h defaults is stood in for by rewriting the
+// record's defaults, as that build would have written them.
+
+// As ConfigLoader writes it
+struct RecordHeader {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t size;
+	uint32_t crc;
+};
+
+static const char* const OLD_SSID = "OLD_DEFAULT_SSID";
+
+static Preferences nvs;
+
+static uint32_t crc32(const uint8_t* data, size_t length) {
+	uint32_t crc = 0xFFFFFFFF;
+	while (length--) {
+		crc ^= *data++;
+		for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+	}
+	return ~crc;
+}
+
+// The SSID is the record's first field
+static void writeOldDefaultSSID() {
+	uint8_t record[CONFIG_RECORD_MAX];
+	size_t length = nvs.getBytes(PREF_CONFIG_RECORD, record, sizeof(record));
+	TEST_ASSERT_GREATER_THAN(sizeof(RecordHeader), length);
+	RecordHeader header;
+	memcpy(&header, record, sizeof(header));
+	uint8_t* config = record + sizeof(header);
+	memset(config, 0, CONFIG_SSID_SIZE);
+	strcpy((char*)config, OLD_SSID);
+	header.crc = crc32(config, header.size);
+	memcpy(record, &header, sizeof(header));
+	TEST_ASSERT_EQUAL(length, nvs.putBytes(PREF_CONFIG_RECORD, record, length));
+}
+
+void setUp() {
+	nvs.begin(PREF_NAMESPACE, false);
+	nvs.clear();
+}
+
+void tearDown() {
+	nvs.end();
+}
+
+void test_boot_on_defaults_writes_no_record() {
+	TEST_ASSERT_TRUE(ConfigLoader::initialize());
+	TEST_ASSERT_EQUAL(ConfigLoader::SOURCE_DEFAULT, ConfigLoader::getConfigSource());
+	TEST_ASSERT_FALSE(nvs.isKey(PREF_CONFIG_RECORD));
+	TEST_ASSERT_EQUAL_STRING(WIFI_SSID, ConfigLoader::getWiFiSSID());
+}
+
+void test_changed_default_takes_effect_after_a_reboot() {
+	ConfigLoader::initialize();
+	ConfigLoader::setUpdateInterval(300000);
+	TEST_ASSERT_TRUE(ConfigLoader::saveConfiguration());
+	writeOldDefaultSSID();
+
+	ConfigLoader::initialize();
+	TEST_ASSERT_EQUAL(ConfigLoader::SOURCE_PREFERENCES, ConfigLoader::getConfigSource());
+	TEST_ASSERT_EQUAL_STRING(WIFI_SSID, ConfigLoader::getWiFiSSID());
+	TEST_ASSERT_EQUAL_UINT32(300000, ConfigLoader::getUpdateInterval());
+}
+
+void test_setting_changed_at_runtime_outlives_new_defaults() {
+	ConfigLoader::initialize();
+	TEST_ASSERT_TRUE(ConfigLoader::setWiFiSSID("home"));
+	TEST_ASSERT_TRUE(ConfigLoader::saveConfiguration());
+
+	ConfigLoader::initialize();
+	TEST_ASSERT_EQUAL_STRING("home", ConfigLoader::getWiFiSSID());
+	TEST_ASSERT_EQUAL_STRING(HA_SERVER, ConfigLoader::getHAServer());
+}
+
+void test_reset_follows_the_defaults_again() {
+	ConfigLoader::initialize();
+	ConfigLoader::setWiFiSSID("home");
+	ConfigLoader::saveConfiguration();
+	ConfigLoader::resetToDefaults();
+	writeOldDefaultSSID();
+
+	ConfigLoader::initialize();
+	TEST_ASSERT_EQUAL_STRING(WIFI_SSID, ConfigLoader::getWiFiSSID());
+}
+
+void test_update_interval_below_the_floor_is_refused() {
+	ConfigLoader::initialize();
+	TEST_ASSERT_FALSE(ConfigLoader::setUpdateInterval(1));
+	TEST_ASSERT_FALSE(ConfigLoader::parseConfigJSON("{\"update_interval\":1}"));
+	TEST_ASSERT_EQUAL_UINT32(UPDATE_INTERVAL_MS, ConfigLoader::getUpdateInterval());
+	TEST_ASSERT_TRUE(ConfigLoader::setUpdateInterval(MIN_UPDATE_INTERVAL_MS));
+	TEST_ASSERT_EQUAL_UINT32(MIN_UPDATE_INTERVAL_MS, ConfigLoader::getUpdateInterval());
+}
+
+int main(int argc, char** argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_boot_on_defaults_writes_no_record);
+	RUN_TEST(test_changed_default_takes_effect_after_a_reboot);
+	RUN_TEST(test_setting_changed_at_runtime_outlives_new_defaults);
+	RUN_TEST(test_reset_follows_the_defaults_again);
+	RUN_TEST(test_update_interval_below_the_floor_is_refused);
+	return UNITY_END();
+}
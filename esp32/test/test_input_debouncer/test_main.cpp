@@ -0,0 +1,232 @@
+#include <unity.h>
+#include <stdio.h>
+#include "../../src/config/GPIOConfig.h"
+#include "../../src/hardware/InputDebouncer.h"
+
+// ==============================================
+// InputDebouncer replaying recorded port samples
+// ==============================================
+// Each sequence is what GPIOManager feeds the debouncer: whole-port masks
+// (bit i = input i, 1 = active) with their timestamps in microseconds, from
+// edge interrupts and tick samples alike. Every step lists the inputs whose
+// debounced state must change on that sample. Windows are the firmware's:
+// 50 ms for the task switches, 200 ms for the row selects.
+
+static const int INPUTS = TOTAL_TASK_BUTTONS + TOTAL_ROW_SELECT_BUTTONS;
+static const uint32_t SWITCH_WINDOW = BUTTON_DEBOUNCE_MS * 1000UL;
+static const uint32_t ROW_WINDOW = ROW_SELECT_DEBOUNCE_MS * 1000UL;
+static const InputMask ROW_0 = 1u << TOTAL_TASK_BUTTONS;
+
+struct RecordedSample {
+	uint32_t at;
+	InputMask sample;
+	InputMask changed;        // Expected from step()
+};
+
+static InputDebouncer debouncer;
+
+static void replay(const RecordedSample* samples, int count) {
+	for (int i = 0; i < count; i++) {
+		InputMask changed = debouncer.step(samples[i].sample, samples[i].at);
+		char message[48];
+		snprintf(message, sizeof(message), "sample %d at %lu us", i, (unsigned long)samples[i].at);
+		TEST_ASSERT_EQUAL_HEX32_MESSAGE(samples[i].changed, changed, message);
+	}
+}
+
+#define REPLAY(samples) replay(samples, sizeof(samples) / sizeof(samples[0]))
+
+void setUp() {
+	uint32_t windows[INPUTS];
+	for (int i = 0; i < INPUTS; i++) {
+		windows[i] = i < TOTAL_TASK_BUTTONS ? SWITCH_WINDOW : ROW_WINDOW;
+	}
+	debouncer.begin(INPUTS, windows);
+}
+
+void tearDown() {}
+
+void test_clean_press_is_taken_on_its_leading_edge() {
+	const RecordedSample samples[] = {
+		{1000, 0x000, 0x000},
+		{5000, 0x004, 0x004},
+		{15000, 0x004, 0x000},
+	};
+	REPLAY(samples);
+	TEST_ASSERT_EQUAL_HEX32(0x004, debouncer.state());
+	TEST_ASSERT_EQUAL_UINT32(5000, debouncer.changedAt(2));
+}
+
+void test_press_bounce_is_held_off() {
+	// Contact chatter for 3 ms after the switch closes, then ticks
+	const RecordedSample samples[] = {
+		{10000, 0x001, 0x001},
+		{10400, 0x000, 0x000},
+		{10900, 0x001, 0x000},
+		{11600, 0x000, 0x000},
+		{12100, 0x001, 0x000},
+		{13000, 0x001, 0x000},
+		{20000, 0x001, 0x000},
+		{70000, 0x001, 0x000},
+		{200000, 0x001, 0x000},
+	};
+	REPLAY(samples);
+	TEST_ASSERT_EQUAL_HEX32(0x001, debouncer.state());
+	TEST_ASSERT_EQUAL_UINT32(10000, debouncer.changedAt(0));
+	TEST_ASSERT_EQUAL_HEX32(0x000, debouncer.pending());
+}
+
+void test_release_bounce_is_held_off() {
+	const RecordedSample samples[] = {
+		{0, 0x010, 0x010},
+		{300000, 0x000, 0x010},
+		{300500, 0x010, 0x000},
+		{301200, 0x000, 0x000},
+		{301800, 0x010, 0x000},
+		{302500, 0x000, 0x000},
+		{310000, 0x000, 0x000},
+		{400000, 0x000, 0x000},
+	};
+	REPLAY(samples);
+	TEST_ASSERT_EQUAL_HEX32(0x000, debouncer.state());
+	TEST_ASSERT_EQUAL_UINT32(300000, debouncer.changedAt(4));
+}
+
+void test_level_that_settles_inside_the_window_is_taken_when_it_closes() {
+	// Released 20 ms into the press window: nothing until the window runs
+	// out, then the release is stamped with the time it happened
+	const RecordedSample samples[] = {
+		{0, 0x002, 0x002},
+		{20000, 0x000, 0x000},
+		{30000, 0x000, 0x000},
+		{49999, 0x000, 0x000},
+		{50000, 0x000, 0x002},
+		{60000, 0x000, 0x000},
+	};
+	REPLAY(samples);
+	TEST_ASSERT_EQUAL_HEX32(0x000, debouncer.state());
+	TEST_ASSERT_EQUAL_UINT32(20000, debouncer.changedAt(1));
+}
+
+void test_noise_spike_while_released() {
+	// A 200 us spike is a leading edge like any other; it is released
+	// again once the window closes, stamped with when it fell
+	const RecordedSample samples[] = {
+		{1000, 0x080, 0x080},
+		{1200, 0x000, 0x000},
+		{51000, 0x000, 0x080},
+	};
+	REPLAY(samples);
+	TEST_ASSERT_EQUAL_HEX32(0x000, debouncer.state());
+	TEST_ASSERT_EQUAL_UINT32(1200, debouncer.changedAt(7));
+}
+
+void test_row_select_hold_and_release() {
+	// Both row selects held for 5 s (demo activation), with tick samples
+	// every 10 ms and bounce on both edges
+	const InputMask rows = ROW_0 | (ROW_0 << 1);
+	RecordedSample samples[520];
+	int count = 0;
+	samples[count++] = {500000, ROW_0, ROW_0};
+	samples[count++] = {500300, 0x000, 0x000};
+	samples[count++] = {500700, rows, (InputMask)(ROW_0 << 1)};
+	samples[count++] = {501000, ROW_0, 0x000};
+	samples[count++] = {501500, rows, 0x000};
+	for (uint32_t t = 510000; t < 5500000; t += 10000) {
+		samples[count++] = {t, rows, 0x000};
+	}
+	samples[count++] = {5500000, 0x000, rows};
+	samples[count++] = {5500400, rows, 0x000};
+	samples[count++] = {5501000, 0x000, 0x000};
+	samples[count++] = {5600000, 0x000, 0x000};
+	samples[count++] = {5800000, 0x000, 0x000};
+	replay(samples, count);
+
+	TEST_ASSERT_EQUAL_HEX32(0x000, debouncer.state());
+	TEST_ASSERT_EQUAL_UINT32(5500000, debouncer.changedAt(TOTAL_TASK_BUTTONS));
+	TEST_ASSERT_EQUAL_UINT32(5500000, debouncer.changedAt(TOTAL_TASK_BUTTONS + 1));
+}
+
+void test_row_select_window_is_longer_than_a_switch_window() {
+	// Both released 100 ms after being pressed: past the switch window,
+	// still inside the row select one
+	const InputMask both = 0x001 | ROW_0;
+	const RecordedSample samples[] = {
+		{0, both, both},
+		{100000, 0x000, 0x001},
+		{150000, 0x000, 0x000},
+		{200000, 0x000, ROW_0},
+	};
+	REPLAY(samples);
+	TEST_ASSERT_EQUAL_UINT32(100000, debouncer.changedAt(TOTAL_TASK_BUTTONS));
+}
+
+void test_inputs_debounce_independently() {
+	// Switch 0 bounces while switch 3 is pressed cleanly in between
+	const RecordedSample samples[] = {
+		{0, 0x001, 0x001},
+		{1000, 0x000, 0x000},
+		{2000, 0x009, 0x008},
+		{3000, 0x008, 0x000},
+		{50000, 0x008, 0x001},
+		{52000, 0x008, 0x000},
+		{60000, 0x000, 0x008},
+	};
+	REPLAY(samples);
+	TEST_ASSERT_EQUAL_HEX32(0x000, debouncer.state());
+}
+
+void test_edge_replayed_after_a_later_tick_sample() {
+	// The tick saw the press at 2000 before the queued ISR edge stamped 1500
+	// was replayed; time never runs backwards
+	const RecordedSample samples[] = {
+		{2000, 0x020, 0x020},
+		{1500, 0x020, 0x000},
+		{40000, 0x000, 0x000},
+		{52000, 0x000, 0x020},
+	};
+	REPLAY(samples);
+	TEST_ASSERT_EQUAL_UINT32(40000, debouncer.changedAt(5));
+}
+
+void test_micros_wraparound() {
+	// micros() wraps every 71 minutes; tick samples keep the debouncer's
+	// idea of now close behind it
+	const uint32_t start = 0xFFFFF000;
+	const RecordedSample samples[] = {
+		{0x40000000, 0x000, 0x000},
+		{0x80000000, 0x000, 0x000},
+		{0xC0000000, 0x000, 0x000},
+		{start, 0x040, 0x040},
+		{start + 2000, 0x000, 0x000},
+		{start + 30000, 0x000, 0x000},
+		{start + 50000, 0x000, 0x040},
+	};
+	REPLAY(samples);
+	TEST_ASSERT_EQUAL_UINT32(start + 2000, debouncer.changedAt(6));
+}
+
+void test_bits_beyond_the_inputs_are_ignored() {
+	const RecordedSample samples[] = {
+		{0, 0xFC00, 0x000},
+		{100000, 0xFFFF, 0x3FF},
+	};
+	REPLAY(samples);
+	TEST_ASSERT_EQUAL_HEX32(0x3FF, debouncer.state());
+}
+
+int main(int argc, char** argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_clean_press_is_taken_on_its_leading_edge);
+	RUN_TEST(test_press_bounce_is_held_off);
+	RUN_TEST(test_release_bounce_is_held_off);
+	RUN_TEST(test_level_that_settles_inside_the_window_is_taken_when_it_closes);
+	RUN_TEST(test_noise_spike_while_released);
+	RUN_TEST(test_row_select_hold_and_release);
+	RUN_TEST(test_row_select_window_is_longer_than_a_switch_window);
+	RUN_TEST(test_inputs_debounce_independently);
+	RUN_TEST(test_edge_replayed_after_a_later_tick_sample);
+	RUN_TEST(test_micros_wraparound);
+	RUN_TEST(test_bits_beyond_the_inputs_are_ignored);
+	return UNITY_END();
+}
@@ -0,0 +1,157 @@
+#include <unity.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include "../../src/utils/SpscQueue.h"
+#include "../../src/utils/StateSnapshot.h"
+
+// ==============================================
+// Cross-core hand-over under real threads
+// ==============================================
+// SpscQueue and StateSnapshot are the contract between the control core and
+// the render core. Here one host thread writes while another reads, as
+// hard as they can, and every value is checked for loss, reordering and
+// tearing. Waiting sides yield, so the test also runs on a single CPU.
+// Build with -fsanitize=thread to have data races reported too.
+
+static const uint32_t QUEUE_ITEMS = 300000;
+static const uint32_t SNAPSHOT_VALUES = 200000;
+
+// Both halves carry the sequence number, so a torn copy shows
+struct Item {
+	uint32_t sequence;
+	uint32_t check;
+};
+
+struct State {
+	uint32_t sequence;
+	uint32_t words[15];
+	std::string text;       // Heap data, like the Strings in DemoSnapshot
+};
+
+void setUp() {}
+void tearDown() {}
+
+void test_queue_delivers_every_item_in_order() {
+	static SpscQueue<Item, 8> queue;
+
+	std::thread producer([&] {
+		for (uint32_t i = 1; i <= QUEUE_ITEMS; i++) {
+			while (!queue.push({i, ~i})) std::this_thread::yield();
+		}
+	});
+
+	uint32_t expected = 1;
+	uint32_t bad = 0;
+	Item item;
+	while (expected <= QUEUE_ITEMS) {
+		if (!queue.pop(item)) {
+			std::this_thread::yield();
+			continue;
+		}
+		if (item.sequence != expected || item.check != ~expected) bad++;
+		expected++;
+	}
+	producer.join();
+
+	TEST_ASSERT_EQUAL_UINT32(0, bad);
+	TEST_ASSERT_TRUE(queue.empty());
+	TEST_ASSERT_FALSE(queue.pop(item));
+}
+
+void test_queue_full_and_empty_at_capacity() {
+	SpscQueue<Item, 4> queue;
+	Item item;
+	for (uint32_t i = 0; i < 4; i++) TEST_ASSERT_TRUE(queue.push({i, ~i}));
+	TEST_ASSERT_FALSE(queue.push({4, ~4u}));
+	TEST_ASSERT_EQUAL(4, queue.size());
+
+	// Counters run past the wrap many times over
+	for (uint32_t i = 4; i < 1000; i++) {
+		TEST_ASSERT_TRUE(queue.pop(item));
+		TEST_ASSERT_EQUAL_UINT32(i - 4, item.sequence);
+		TEST_ASSERT_TRUE(queue.push({i, ~i}));
+	}
+	for (int i = 0; i < 4; i++) TEST_ASSERT_TRUE(queue.pop(item));
+	TEST_ASSERT_FALSE(queue.pop(item));
+}
+
+static bool consistent(const State& state) {
+	for (int i = 0; i < 15; i++) {
+		if (state.words[i] != state.sequence) return false;
+	}
+	return state.text == std::to_string(state.sequence);
+}
+
+void test_snapshot_is_whole_newest_and_stable() {
+	static StateSnapshot<State> snapshot;
+	std::atomic<bool> done(false);
+
+	std::thread writer([&] {
+		State state;
+		for (uint32_t i = 1; i <= SNAPSHOT_VALUES; i++) {
+			state.sequence = i;
+			for (int w = 0; w < 15; w++) state.words[w] = i;
+			state.text = std::to_string(i);
+			snapshot.publish(state);
+		}
+		done.store(true, std::memory_order_release);
+	});
+
+	uint32_t last = 0;
+	uint32_t torn = 0;
+	uint32_t backwards = 0;
+	uint32_t moved = 0;
+	uint32_t refreshes = 0;
+	while (!done.load(std::memory_order_acquire)) {
+		if (!snapshot.refresh()) {
+			std::this_thread::yield();
+			continue;
+		}
+		refreshes++;
+		const State& state = snapshot.current();
+		uint32_t sequence = state.sequence;
+		if (!consistent(state)) torn++;
+		if (sequence <= last) backwards++;
+		last = sequence;
+
+		// The writer keeps going, but the value read stays put until the
+		// next refresh()
+		for (int spin = 0; spin < 50; spin++) {
+			if (state.sequence != sequence || !consistent(state)) moved++;
+		}
+	}
+	writer.join();
+
+	TEST_ASSERT_EQUAL_UINT32(0, torn);
+	TEST_ASSERT_EQUAL_UINT32(0, backwards);
+	TEST_ASSERT_EQUAL_UINT32(0, moved);
+	TEST_ASSERT_GREATER_THAN(0, refreshes);
+
+	// Once the writer stops, the reader ends on its last value
+	snapshot.refresh();
+	TEST_ASSERT_EQUAL_UINT32(SNAPSHOT_VALUES, snapshot.current().sequence);
+	TEST_ASSERT_TRUE(consistent(snapshot.current()));
+	TEST_ASSERT_FALSE(snapshot.refresh());
+}
+
+void test_snapshot_refresh_reports_changes_only() {
+	StateSnapshot<Item> snapshot;
+	TEST_ASSERT_FALSE(snapshot.refresh());
+
+	snapshot.publish({1, ~1u});
+	snapshot.publish({2, ~2u});
+	TEST_ASSERT_TRUE(snapshot.refresh());
+	TEST_ASSERT_EQUAL_UINT32(2, snapshot.current().sequence);
+	TEST_ASSERT_FALSE(snapshot.refresh());
+	TEST_ASSERT_EQUAL_UINT32(2, snapshot.current().sequence);
+}
+
+int main(int argc, char** argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_queue_delivers_every_item_in_order);
+	RUN_TEST(test_queue_full_and_empty_at_capacity);
+	RUN_TEST(test_snapshot_is_whole_newest_and_stable);
+	RUN_TEST(test_snapshot_refresh_reports_changes_only);
+	return UNITY_END();
+}
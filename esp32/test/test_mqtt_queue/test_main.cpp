@@ -0,0 +1,70 @@
+#include <unity.h>
+#include <stdio.h>
+#include "../../src/network/MQTTClient.h"
+
+// ==============================================
+// MQTTClient's outgoing queue, offline
+// ==============================================
+// Nothing is connected, so whatever is published stays queued; these check
+// the room a full queue makes, and what it counts as dropped.
+
+static void publishMany(int count, uint8_t qos) {
+	for (int i = 0; i < count; i++) {
+		char topic[32];
+		snprintf(topic, sizeof(topic), "test/%d/%d", qos, i);
+		TEST_ASSERT_TRUE(MQTTClient::publish(topic, "{}", qos));
+	}
+}
+
+void setUp() {
+	MQTTClient::initialize();
+}
+
+void tearDown() {}
+
+void test_full_queue_drops_its_oldest_qos0_message() {
+	uint32_t dropped = MQTTClient::getStats().dropped;
+	publishMany(MQTTClient::QUEUE_DEPTH, 0);
+	TEST_ASSERT_TRUE(MQTTClient::publish("test/new", "{}", 0));
+	TEST_ASSERT_EQUAL(MQTTClient::QUEUE_DEPTH, MQTTClient::getQueued());
+	TEST_ASSERT_EQUAL_UINT32(dropped + 1, MQTTClient::getStats().dropped);
+}
+
+void test_qos0_message_behind_the_head_makes_room() {
+	// The oldest is a completion, which is never evicted; the QoS 0 one
+	// that goes is in the middle of the queue
+	uint32_t dropped = MQTTClient::getStats().dropped;
+	publishMany(1, 1);
+	publishMany(MQTTClient::QUEUE_DEPTH - 1, 0);
+	for (int i = 0; i < 3 * MQTTClient::QUEUE_DEPTH; i++) {
+		TEST_ASSERT_TRUE(MQTTClient::publish("test/new", "{}", 0));
+		TEST_ASSERT_EQUAL(MQTTClient::QUEUE_DEPTH, MQTTClient::getQueued());
+	}
+	TEST_ASSERT_EQUAL_UINT32(dropped + 3 * MQTTClient::QUEUE_DEPTH, MQTTClient::getStats().dropped);
+}
+
+void test_queue_of_qos1_messages_refuses_more() {
+	uint32_t dropped = MQTTClient::getStats().dropped;
+	publishMany(MQTTClient::QUEUE_DEPTH, 1);
+	TEST_ASSERT_FALSE(MQTTClient::publish("test/new", "{}", 0));
+	TEST_ASSERT_FALSE(MQTTClient::publish("test/new", "{}", 1));
+	TEST_ASSERT_EQUAL(MQTTClient::QUEUE_DEPTH, MQTTClient::getQueued());
+	TEST_ASSERT_EQUAL_UINT32(dropped + 2, MQTTClient::getStats().dropped);
+}
+
+void test_oversized_message_is_refused() {
+	char payload[MQTTClient::MAX_PAYLOAD + 1];
+	memset(payload, 'x', sizeof(payload) - 1);
+	payload[sizeof(payload) - 1] = '\0';
+	TEST_ASSERT_FALSE(MQTTClient::publish("test/big", payload, 0));
+	TEST_ASSERT_EQUAL(0, MQTTClient::getQueued());
+}
+
+int main(int argc, char** argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_full_queue_drops_its_oldest_qos0_message);
+	RUN_TEST(test_qos0_message_behind_the_head_makes_room);
+	RUN_TEST(test_queue_of_qos1_messages_refuses_more);
+	RUN_TEST(test_oversized_message_is_refused);
+	return UNITY_END();
+}
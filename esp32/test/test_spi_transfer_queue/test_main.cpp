@@ -0,0 +1,240 @@
+#include <unity.h>
+#include "../../src/hardware/SpiTransferQueue.h"
+
+// ==============================================
+// SpiTransferQueue against a recording backend
+// ==============================================
+// The backend either completes each chunk inside writeChunk(), like
+// PanelSpiBackend, or holds chunks "on the wire" until the test lets them
+// finish, like the DMA backend.
+
+class RecordingBackend : public SpiTransferBackend {
+public:
+	static const int MAX_EVENTS = 64;
+	static const int MAX_PIXELS = 4096;
+
+	enum EventKind { ACQUIRE, RELEASE, WINDOW, CHUNK };
+	struct Event {
+		EventKind kind;
+		uint16_t displayMask;   // WINDOW: mask; CHUNK: pixel count
+		int pending;            // Chunks still on the wire at the time
+	};
+
+	bool blocking = true;
+	int depth = 4;              // Chunks the backend can hold in flight
+	int pending = 0;
+	int finished = 0;           // Completed, not yet reported by poll()
+	bool acquired = false;
+	int droppedChunks = 0;      // Written while the bus was released
+
+	Event events[MAX_EVENTS];
+	int eventCount = 0;
+	uint16_t wire[MAX_PIXELS];
+	int wirePixels = 0;
+
+	bool begin() override { return true; }
+	void acquire() override { acquired = true; record(ACQUIRE, 0); }
+	void release() override { acquired = false; record(RELEASE, 0); }
+
+	void beginWindow(uint16_t displayMask, int16_t, int16_t, int16_t, int16_t) override {
+		record(WINDOW, displayMask);
+	}
+
+	void writeChunk(const uint16_t* pixels, size_t count) override {
+		if (!acquired) droppedChunks++;
+		record(CHUNK, (uint16_t)count);
+		for (size_t i = 0; i < count && wirePixels < MAX_PIXELS; i++) {
+			wire[wirePixels++] = pixels[i];
+		}
+		if (blocking) finished++;
+		else pending++;
+	}
+
+	bool canAccept() override { return pending < depth; }
+
+	int poll() override {
+		int completed = finished;
+		finished = 0;
+		return completed;
+	}
+
+	// DMA backend only: let the oldest chunks finish
+	void complete(int count) {
+		if (count > pending) count = pending;
+		pending -= count;
+		finished += count;
+	}
+
+	int count(EventKind kind) const {
+		int total = 0;
+		for (int i = 0; i < eventCount; i++) {
+			if (events[i].kind == kind) total++;
+		}
+		return total;
+	}
+
+private:
+	void record(EventKind kind, uint16_t value) {
+		if (eventCount < MAX_EVENTS) events[eventCount++] = {kind, value, pending};
+	}
+};
+
+static uint16_t pixels[1200];
+
+void setUp() {
+	for (int i = 0; i < 1200; i++) pixels[i] = (uint16_t)(0x1200 + i);
+}
+
+void tearDown() {}
+
+void test_rectangle_is_split_into_chunks_and_byte_swapped() {
+	RecordingBackend backend;
+	SpiTransferQueue queue;
+	TEST_ASSERT_TRUE(queue.begin(&backend, 4));
+
+	queue.enqueue(0x01, 0, 0, 1200, 1, pixels, 1200);
+
+	TEST_ASSERT_TRUE(queue.isIdle());
+	TEST_ASSERT_EQUAL(1, backend.count(RecordingBackend::WINDOW));
+	TEST_ASSERT_EQUAL(3, backend.count(RecordingBackend::CHUNK));
+	TEST_ASSERT_EQUAL(1200, backend.wirePixels);
+	for (int i = 0; i < 1200; i++) {
+		TEST_ASSERT_EQUAL_HEX16((uint16_t)((pixels[i] << 8) | (pixels[i] >> 8)), backend.wire[i]);
+	}
+
+	SpiQueueStats stats = queue.getStats();
+	TEST_ASSERT_EQUAL_UINT32(1, stats.windows);
+	TEST_ASSERT_EQUAL_UINT32(3, stats.chunks);
+	TEST_ASSERT_EQUAL_UINT32(1200, stats.pixels);
+}
+
+void test_rows_of_a_strided_rectangle_are_packed() {
+	RecordingBackend backend;
+	SpiTransferQueue queue;
+	queue.begin(&backend, 4);
+
+	// 3x2 out of a canvas 10 pixels wide
+	queue.enqueue(0x01, 4, 4, 3, 2, pixels, 10);
+
+	const int expected[] = {0, 1, 2, 10, 11, 12};
+	TEST_ASSERT_EQUAL(6, backend.wirePixels);
+	for (int i = 0; i < 6; i++) {
+		uint16_t source = pixels[expected[i]];
+		TEST_ASSERT_EQUAL_HEX16((uint16_t)((source << 8) | (source >> 8)), backend.wire[i]);
+	}
+}
+
+void test_bus_stays_acquired_for_every_chunk_of_a_window() {
+	// A blocking backend drains each chunk at once; the bus must not be
+	// handed back between the chunks of a window still being filled
+	RecordingBackend backend;
+	SpiTransferQueue queue;
+	queue.begin(&backend, 4);
+
+	queue.enqueue(0x01, 0, 0, 1200, 1, pixels, 1200);
+
+	TEST_ASSERT_EQUAL(0, backend.droppedChunks);
+	TEST_ASSERT_EQUAL(1, backend.count(RecordingBackend::ACQUIRE));
+	TEST_ASSERT_EQUAL(1, backend.count(RecordingBackend::RELEASE));
+	TEST_ASSERT_FALSE(backend.acquired);
+}
+
+void test_chip_select_waits_for_the_previous_display() {
+	RecordingBackend backend;
+	backend.blocking = false;
+	SpiTransferQueue queue;
+	queue.begin(&backend, 8);
+
+	queue.enqueue(0x01, 0, 0, 600, 1, pixels, 600);
+	queue.enqueue(0x02, 0, 0, 100, 1, pixels, 100);
+
+	// Display 0's two chunks are on the wire; display 1 has to wait
+	TEST_ASSERT_EQUAL(1, backend.count(RecordingBackend::WINDOW));
+	TEST_ASSERT_FALSE(queue.isIdle());
+
+	backend.complete(1);
+	queue.pump();
+	TEST_ASSERT_EQUAL(1, backend.count(RecordingBackend::WINDOW));
+
+	backend.complete(1);
+	queue.pump();
+	TEST_ASSERT_EQUAL(2, backend.count(RecordingBackend::WINDOW));
+
+	// Every window went out with nothing in flight
+	for (int i = 0; i < backend.eventCount; i++) {
+		if (backend.events[i].kind == RecordingBackend::WINDOW && backend.events[i].displayMask == 0x02) {
+			TEST_ASSERT_EQUAL(0, backend.events[i].pending);
+		}
+	}
+
+	backend.complete(1);
+	queue.pump();
+	TEST_ASSERT_TRUE(queue.isIdle());
+	TEST_ASSERT_FALSE(backend.acquired);
+	TEST_ASSERT_EQUAL_UINT32(1, queue.getStats().displaySwitches);
+}
+
+void test_same_display_windows_stream_back_to_back() {
+	RecordingBackend backend;
+	backend.blocking = false;
+	SpiTransferQueue queue;
+	queue.begin(&backend, 8);
+
+	queue.enqueue(0x04, 0, 0, 10, 1, pixels, 10);
+	queue.enqueue(0x04, 0, 1, 10, 1, pixels, 10);
+
+	// No chip-select change, so the second window needn't wait
+	TEST_ASSERT_EQUAL(2, backend.count(RecordingBackend::WINDOW));
+	TEST_ASSERT_EQUAL(2, backend.pending);
+	TEST_ASSERT_EQUAL_UINT32(0, queue.getStats().displaySwitches);
+}
+
+void test_enqueue_waits_for_a_free_chunk_when_full() {
+	RecordingBackend backend;
+	SpiTransferQueue queue;
+	queue.begin(&backend, 2);
+
+	queue.enqueue(0x01, 0, 0, 1200, 1, pixels, 1200);
+	queue.enqueue(0x01, 0, 0, 1200, 1, pixels, 1200);
+
+	TEST_ASSERT_EQUAL(2400, backend.wirePixels);
+	TEST_ASSERT_EQUAL_UINT32(6, queue.getStats().chunks);
+	TEST_ASSERT_EQUAL(0, backend.droppedChunks);
+}
+
+void test_broadcast_window_is_sent_once() {
+	RecordingBackend backend;
+	SpiTransferQueue queue;
+	queue.begin(&backend, 4);
+
+	queue.enqueue(0xFF, 0, 0, 100, 1, pixels, 100);
+
+	TEST_ASSERT_EQUAL(1, backend.count(RecordingBackend::WINDOW));
+	TEST_ASSERT_EQUAL(100, backend.wirePixels);
+	TEST_ASSERT_EQUAL_UINT32(1, queue.getStats().broadcastWindows);
+}
+
+void test_empty_rectangles_are_ignored() {
+	RecordingBackend backend;
+	SpiTransferQueue queue;
+	queue.begin(&backend, 4);
+
+	queue.enqueue(0x01, 0, 0, 0, 10, pixels, 10);
+	queue.enqueue(0x01, 0, 0, 10, 0, pixels, 10);
+	queue.enqueue(0x00, 0, 0, 10, 10, pixels, 10);
+
+	TEST_ASSERT_EQUAL(0, backend.eventCount);
+}
+
+int main(int argc, char** argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_rectangle_is_split_into_chunks_and_byte_swapped);
+	RUN_TEST(test_rows_of_a_strided_rectangle_are_packed);
+	RUN_TEST(test_bus_stays_acquired_for_every_chunk_of_a_window);
+	RUN_TEST(test_chip_select_waits_for_the_previous_display);
+	RUN_TEST(test_same_display_windows_stream_back_to_back);
+	RUN_TEST(test_enqueue_waits_for_a_free_chunk_when_full);
+	RUN_TEST(test_broadcast_window_is_sent_once);
+	RUN_TEST(test_empty_rectangles_are_ignored);
+	return UNITY_END();
+}
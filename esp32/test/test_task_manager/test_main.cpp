@@ -0,0 +1,315 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "../../src/core/TaskManager.h"
+
+// ==============================================
+// TaskManager on a simulated clock
+// ==============================================
+// The task clock is set to a fixed Unix time and then driven with
+// advanceTo(), so starts, ends and auto-removal happen exactly when the
+// test says. Every case also checks the TaskEvents the control side sees.
+
+static const uint32_t T0 = 1714586400;   // 2024-05-01T18:00:00Z
+
+static ChoreTask makeTask(const char* id, TaskType type, uint32_t start, uint32_t end, int switchId = 0) {
+	ChoreTask task = {};
+	strncpy(task.id, id, sizeof(task.id) - 1);
+	strncpy(task.title, id, sizeof(task.title) - 1);
+	task.type = type;
+	task.state = TASK_PENDING;
+	task.startTime = start;
+	task.endTime = end;
+	task.switchId = switchId;
+	return task;
+}
+
+static TaskState stateOf(const char* id) {
+	const ChoreTask* task = TaskManager::getTask(TaskManager::findTask(id));
+	TEST_ASSERT_NOT_NULL(task);
+	return task->state;
+}
+
+// Next event; fails when there is none
+static TaskEvent nextEvent() {
+	TaskEvent event;
+	TEST_ASSERT_TRUE(TaskManager::pollEvent(event));
+	return event;
+}
+
+static void expectEvent(TaskState from, TaskState to, uint32_t time) {
+	TaskEvent event = nextEvent();
+	TEST_ASSERT_EQUAL(from, event.from);
+	TEST_ASSERT_EQUAL(to, event.to);
+	TEST_ASSERT_EQUAL_UINT32(time, event.time);
+}
+
+static void expectNoEvent() {
+	TaskEvent event;
+	TEST_ASSERT_FALSE(TaskManager::pollEvent(event));
+}
+
+void setUp() {
+	TaskManager::initialize();
+	TaskManager::setTime(T0);
+	TaskEvent event;
+	while (TaskManager::pollEvent(event)) {}
+}
+
+void tearDown() {}
+
+void test_untimed_task_is_active_at_once() {
+	TEST_ASSERT_GREATER_OR_EQUAL(0, TaskManager::addTask(makeTask("dishes", TASK_UNTIMED, 0, 0)));
+	TEST_ASSERT_EQUAL(TASK_ACTIVE, stateOf("dishes"));
+	expectEvent(TASK_PENDING, TASK_ACTIVE, T0);
+
+	TaskManager::advanceTo(T0 + 86400);
+	TEST_ASSERT_EQUAL(TASK_ACTIVE, stateOf("dishes"));
+	expectNoEvent();
+}
+
+void test_fixed_time_starts_ends_and_frees_its_slot() {
+	TaskManager::addTask(makeTask("school", TASK_FIXED_TIME, T0 + 60, T0 + 120));
+	TEST_ASSERT_EQUAL(TASK_PENDING, stateOf("school"));
+	TEST_ASSERT_EQUAL(1, TaskManager::getTaskCount());
+	expectNoEvent();
+
+	TaskManager::advanceTo(T0 + 59);
+	TEST_ASSERT_EQUAL(TASK_PENDING, stateOf("school"));
+
+	TaskManager::advanceTo(T0 + 60);
+	TEST_ASSERT_EQUAL(TASK_ACTIVE, stateOf("school"));
+	expectEvent(TASK_PENDING, TASK_ACTIVE, T0 + 60);
+
+	uint32_t before = TaskManager::getSequence();
+	TaskManager::advanceTo(T0 + 200);
+	expectEvent(TASK_ACTIVE, TASK_AUTO_REMOVED, T0 + 120);
+	TEST_ASSERT_EQUAL(-1, TaskManager::findTask("school"));
+	TEST_ASSERT_EQUAL(0, TaskManager::getTaskCount());
+
+	// Logged for delta sync like any other removal
+	TEST_ASSERT_GREATER_THAN(before, TaskManager::getSequence());
+	const TaskRemoval* last = nullptr;
+	for (int i = 0; i < TaskManager::REMOVAL_LOG; i++) {
+		if (TaskManager::getRemoval(i)) last = TaskManager::getRemoval(i);
+	}
+	TEST_ASSERT_NOT_NULL(last);
+	TEST_ASSERT_EQUAL_STRING("school", last->id);
+}
+
+void test_auto_removed_tasks_do_not_hold_slots() {
+	// Far more fixed_time tasks over the day than there are slots
+	for (int round = 0; round < 3; round++) {
+		uint32_t start = T0 + round * 1000;
+		for (int i = 0; i < TaskManager::MAX_TASKS; i++) {
+			char id[16];
+			snprintf(id, sizeof(id), "slot-%d-%d", round, i);
+			TEST_ASSERT_GREATER_OR_EQUAL(0, TaskManager::addTask(makeTask(id, TASK_FIXED_TIME, start + 10, start + 20)));
+		}
+		TaskManager::advanceTo(start + 500);
+		TEST_ASSERT_EQUAL(0, TaskManager::getTaskCount());
+	}
+}
+
+void test_fixed_time_already_over_is_not_added() {
+	TEST_ASSERT_EQUAL(-1, TaskManager::addTask(makeTask("yesterday", TASK_FIXED_TIME, T0 - 7200, T0 - 3600)));
+	TEST_ASSERT_EQUAL(0, TaskManager::getTaskCount());
+	expectNoEvent();
+}
+
+void test_timed_with_early_completes_inside_its_window() {
+	int slot = TaskManager::addTask(makeTask("homework", TASK_TIMED_WITH_EARLY, T0 + 10, T0 + 3600, 2));
+	TEST_ASSERT_EQUAL(TASK_PENDING, stateOf("homework"));
+
+	// The switch does nothing before the start
+	TEST_ASSERT_EQUAL(-1, TaskManager::handleSwitch(2));
+
+	TaskManager::advanceTo(T0 + 10);
+	expectEvent(TASK_PENDING, TASK_ACTIVE, T0 + 10);
+
+	TaskManager::advanceTo(T0 + 100);
+	TEST_ASSERT_EQUAL(slot, TaskManager::handleSwitch(2));
+	TEST_ASSERT_EQUAL(TASK_COMPLETED, stateOf("homework"));
+	TEST_ASSERT_EQUAL_UINT32(T0 + 100, TaskManager::getTask(slot)->completedTime);
+	expectEvent(TASK_ACTIVE, TASK_COMPLETED, T0 + 100);
+
+	// No end timer is left to expire it
+	TaskManager::advanceTo(T0 + 7200);
+	TEST_ASSERT_EQUAL(TASK_COMPLETED, stateOf("homework"));
+	expectNoEvent();
+}
+
+void test_timed_with_early_expires_at_its_end() {
+	TaskManager::addTask(makeTask("piano", TASK_TIMED_WITH_EARLY, 0, T0 + 30, 1));
+	expectEvent(TASK_PENDING, TASK_ACTIVE, T0);
+
+	TaskManager::advanceTo(T0 + 30);
+	TEST_ASSERT_EQUAL(TASK_EXPIRED, stateOf("piano"));
+	expectEvent(TASK_ACTIVE, TASK_EXPIRED, T0 + 30);
+
+	TEST_ASSERT_EQUAL(-1, TaskManager::handleSwitch(1));
+	TEST_ASSERT_FALSE(TaskManager::completeTask("piano"));
+}
+
+void test_fixed_time_cannot_be_completed() {
+	TaskManager::addTask(makeTask("dinner", TASK_FIXED_TIME, 0, T0 + 600, 3));
+	TEST_ASSERT_EQUAL(-1, TaskManager::handleSwitch(3));
+	TEST_ASSERT_FALSE(TaskManager::completeTask("dinner"));
+	TEST_ASSERT_EQUAL(TASK_ACTIVE, stateOf("dinner"));
+}
+
+void test_resync_moves_a_pending_start() {
+	TaskManager::addTask(makeTask("walk", TASK_TIMED_WITH_EARLY, T0 + 60, T0 + 600));
+	TaskManager::advanceTo(T0 + 30);
+
+	// The feed pushes the start back; the old start timer must not fire
+	TaskManager::addTask(makeTask("walk", TASK_TIMED_WITH_EARLY, T0 + 300, T0 + 600));
+	TaskManager::advanceTo(T0 + 120);
+	TEST_ASSERT_EQUAL(TASK_PENDING, stateOf("walk"));
+	expectNoEvent();
+
+	TaskManager::advanceTo(T0 + 300);
+	expectEvent(TASK_PENDING, TASK_ACTIVE, T0 + 300);
+}
+
+void test_resync_with_an_end_already_passed_expires_at_once() {
+	TaskManager::addTask(makeTask("bins", TASK_TIMED_WITH_EARLY, 0, T0 + 600));
+	expectEvent(TASK_PENDING, TASK_ACTIVE, T0);
+	TaskManager::advanceTo(T0 + 100);
+
+	TaskManager::addTask(makeTask("bins", TASK_TIMED_WITH_EARLY, 0, T0 + 50));
+	TEST_ASSERT_EQUAL(TASK_EXPIRED, stateOf("bins"));
+	expectEvent(TASK_ACTIVE, TASK_EXPIRED, T0 + 100);
+
+	// Same id, same times: a repeat of the same list changes nothing
+	uint32_t sequence = TaskManager::getSequence();
+	TaskManager::addTask(makeTask("bins", TASK_TIMED_WITH_EARLY, 0, T0 + 50));
+	TEST_ASSERT_EQUAL_UINT32(sequence, TaskManager::getSequence());
+	expectNoEvent();
+}
+
+void test_local_completion_survives_a_resync_until_confirmed() {
+	ChoreTask task = makeTask("teeth", TASK_UNTIMED, 0, 0, 4);
+	int slot = TaskManager::addTask(task);
+	TaskManager::advanceTo(T0 + 20);
+	TEST_ASSERT_EQUAL(slot, TaskManager::handleSwitch(4));
+	expectEvent(TASK_PENDING, TASK_ACTIVE, T0);
+	expectEvent(TASK_ACTIVE, TASK_COMPLETED, T0 + 20);
+
+	// A full list sent before HA heard of the completion
+	TaskManager::addTask(task);
+	TEST_ASSERT_EQUAL(TASK_COMPLETED, stateOf("teeth"));
+	TEST_ASSERT_EQUAL_UINT32(T0 + 20, TaskManager::getTask(slot)->completedTime);
+	expectNoEvent();
+
+	// HA confirms, and later reopens it
+	task.state = TASK_COMPLETED;
+	TaskManager::addTask(task);
+	TEST_ASSERT_EQUAL(TASK_COMPLETED, stateOf("teeth"));
+	task.state = TASK_ACTIVE;
+	TaskManager::addTask(task);
+	TEST_ASSERT_EQUAL(TASK_ACTIVE, stateOf("teeth"));
+	expectEvent(TASK_COMPLETED, TASK_ACTIVE, T0 + 20);
+}
+
+void test_local_completion_gives_way_to_a_new_occurrence() {
+	ChoreTask task = makeTask("feed-cat", TASK_TIMED_WITH_EARLY, T0, T0 + 3600, 5);
+	TaskManager::addTask(task);
+	TaskManager::completeTask("feed-cat");
+
+	// Tomorrow's occurrence under the same id
+	task.startTime += 86400;
+	task.endTime += 86400;
+	TaskManager::addTask(task);
+	TEST_ASSERT_EQUAL(TASK_PENDING, stateOf("feed-cat"));
+
+	TaskManager::advanceTo(T0 + 86400);
+	TEST_ASSERT_EQUAL(TASK_ACTIVE, stateOf("feed-cat"));
+}
+
+void test_removed_task_stops_its_timer() {
+	TaskManager::addTask(makeTask("laundry", TASK_FIXED_TIME, T0 + 10, T0 + 20));
+	TEST_ASSERT_TRUE(TaskManager::removeTask("laundry"));
+	TaskManager::advanceTo(T0 + 100);
+	expectNoEvent();
+	TEST_ASSERT_FALSE(TaskManager::removeTask("laundry"));
+}
+
+void test_setting_the_clock_runs_what_is_due() {
+	TaskManager::addTask(makeTask("early", TASK_FIXED_TIME, T0 + 60, T0 + 7200));
+	TaskManager::addTask(makeTask("late", TASK_FIXED_TIME, T0 + 3600, T0 + 7200));
+
+	// SNTP moves the clock on by half an hour in one step
+	TaskManager::setTime(T0 + 1800);
+	TEST_ASSERT_EQUAL(TASK_ACTIVE, stateOf("early"));
+	TEST_ASSERT_EQUAL(TASK_PENDING, stateOf("late"));
+
+	TaskManager::advanceTo(T0 + 3600);
+	TEST_ASSERT_EQUAL(TASK_ACTIVE, stateOf("late"));
+}
+
+void test_timed_tasks_wait_for_the_clock() {
+	// As at boot: task times are Unix times, the clock is uptime
+	TaskManager::initialize();
+	TEST_ASSERT_FALSE(TaskManager::hasTime());
+	TaskManager::addTask(makeTask("dishes", TASK_UNTIMED, 0, 0));
+	TaskManager::addTask(makeTask("walk-dog", TASK_TIMED_WITH_EARLY, T0 + 60, T0 + 7200));
+	TEST_ASSERT_GREATER_OR_EQUAL(0, TaskManager::addTask(makeTask("bins", TASK_FIXED_TIME, T0 - 7200, T0 - 3600)));
+	TEST_ASSERT_EQUAL(TASK_ACTIVE, stateOf("dishes"));
+	TEST_ASSERT_EQUAL(TASK_PENDING, stateOf("walk-dog"));
+	TEST_ASSERT_EQUAL(TASK_PENDING, stateOf("bins"));
+	TEST_ASSERT_FALSE(TaskManager::completeTask("walk-dog"));
+
+	// However far uptime runs, nothing timed moves
+	TaskManager::advanceTo(T0 + 86400);
+	TEST_ASSERT_EQUAL(TASK_PENDING, stateOf("walk-dog"));
+
+	TaskEvent event;
+	while (TaskManager::pollEvent(event)) {}
+	TaskManager::setTime(T0 + 120);
+	TEST_ASSERT_TRUE(TaskManager::hasTime());
+	TEST_ASSERT_EQUAL(TASK_ACTIVE, stateOf("walk-dog"));
+	TEST_ASSERT_LESS_THAN(0, TaskManager::findTask("bins"));
+	expectEvent(TASK_PENDING, TASK_ACTIVE, T0 + 120);
+	expectEvent(TASK_PENDING, TASK_AUTO_REMOVED, T0 + 120);
+
+	TaskManager::advanceTo(T0 + 7200);
+	TEST_ASSERT_EQUAL(TASK_EXPIRED, stateOf("walk-dog"));
+}
+
+void test_snapshot_shows_each_display_its_task() {
+	TaskManager::addTask(makeTask("first", TASK_UNTIMED, 0, 0, 0));
+	TaskManager::addTask(makeTask("later", TASK_FIXED_TIME, T0 + 60, T0 + 120, 1));
+	TaskManager::refreshSnapshot();
+	TEST_ASSERT_TRUE(TaskManager::readSnapshot().displays[0].present);
+	TEST_ASSERT_EQUAL_STRING("first", TaskManager::readSnapshot().displays[0].title);
+	TEST_ASSERT_FALSE(TaskManager::readSnapshot().displays[1].present);
+
+	TaskManager::advanceTo(T0 + 60);
+	TaskManager::refreshSnapshot();
+	TEST_ASSERT_TRUE(TaskManager::readSnapshot().displays[1].present);
+
+	TaskManager::advanceTo(T0 + 120);
+	TaskManager::refreshSnapshot();
+	TEST_ASSERT_FALSE(TaskManager::readSnapshot().displays[1].present);
+}
+
+int main(int argc, char** argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_untimed_task_is_active_at_once);
+	RUN_TEST(test_fixed_time_starts_ends_and_frees_its_slot);
+	RUN_TEST(test_auto_removed_tasks_do_not_hold_slots);
+	RUN_TEST(test_fixed_time_already_over_is_not_added);
+	RUN_TEST(test_timed_with_early_completes_inside_its_window);
+	RUN_TEST(test_timed_with_early_expires_at_its_end);
+	RUN_TEST(test_fixed_time_cannot_be_completed);
+	RUN_TEST(test_resync_moves_a_pending_start);
+	RUN_TEST(test_resync_with_an_end_already_passed_expires_at_once);
+	RUN_TEST(test_local_completion_survives_a_resync_until_confirmed);
+	RUN_TEST(test_local_completion_gives_way_to_a_new_occurrence);
+	RUN_TEST(test_removed_task_stops_its_timer);
+	RUN_TEST(test_setting_the_clock_runs_what_is_due);
+	RUN_TEST(test_timed_tasks_wait_for_the_clock);
+	RUN_TEST(test_snapshot_shows_each_display_its_task);
+	return UNITY_END();
+}
@@ -0,0 +1,310 @@
+#!/usr/bin/env python3
+"""Load generator for the device's HTTP API (src/network/APIServer.h).
+
+    python3 tools/api_load.py --run-sim .pio/build/native/program
+    python3 tools/api_load.py --device 192.168.1.100
+
+Several workers send a mix of requests from shared/api/choretracker_api.yaml
+as fast as they are answered, while a slow client trickles its headers a
+byte at a time, another connects and says nothing, and a third reads the
+task list a little at a time, so it has to go out over many ticks. It checks every answer:
+the status is one the contract allows, bodies are JSON, /api/tasks has an
+ETag, and sending that tag back gets a 304 or a delta. Then it prints the
+latency per route.
+
+With --run-sim, a NativeSim build runs in real time (SIM_SPEED=1), taking
+its tasks from the Home Assistant stand-in (tools/ha_standin.py). The
+device's own /api/metrics, read before and after the load, shows what
+serving it cost the frame loop: the time the API took per tick
+(api_update) and, on a device, scheduler overruns and the worst tick.
+NativeSim's clock only moves when the firmware waits, so its ticks never
+overrun; api_update is host time. The exit status is 0 when every answer
+was right, no tick overran during the load, and p99 latency is under
+--max-p99-ms.
+"""
+
+import argparse
+import http.client
+import json
+import os
+import random
+import socket
+import subprocess
+import sys
+import threading
+import time
+from http.server import ThreadingHTTPServer
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from ha_standin import TaskStore, make_handler, make_task  # noqa: E402
+
+API_PORT = 80            # Config.h
+
+
+def free_port():
+    with socket.socket() as s:
+        s.bind(("127.0.0.1", 0))
+        return s.getsockname()[1]
+
+
+class Load:
+    def __init__(self, host, port, task_ids):
+        self.host = host
+        self.port = port
+        self.task_ids = task_ids
+        self.lock = threading.Lock()
+        self.latencies = {}          # route -> [seconds]
+        self.problems = []
+        self.tag = None
+
+    def request(self, method, path, body=None, headers=None, route=None):
+        started = time.perf_counter()
+        connection = http.client.HTTPConnection(self.host, self.port, timeout=10)
+        try:
+            connection.request(method, path, body=body, headers=headers or {})
+            response = connection.getresponse()
+            data = response.read()
+        finally:
+            connection.close()
+        elapsed = time.perf_counter() - started
+        with self.lock:
+            self.latencies.setdefault(route or "%s %s" % (method, path), []).append(elapsed)
+        return response, data
+
+    def problem(self, text):
+        with self.lock:
+            if len(self.problems) < 20:
+                self.problems.append(text)
+
+    def expect(self, response, data, allowed, what):
+        if response.status not in allowed:
+            self.problem("%s: status %d %s" % (what, response.status, data[:80]))
+            return None
+        if response.status == 304:
+            return None
+        try:
+            return json.loads(data)
+        except ValueError:
+            self.problem("%s: body is not JSON: %r" % (what, data[:80]))
+            return None
+
+    def step(self, rng):
+        choice = rng.random()
+        if choice < 0.25:
+            response, data = self.request("GET", "/api/status")
+            status = self.expect(response, data, {200}, "status")
+            if status is not None and "uptime" not in status:
+                self.problem("status: no uptime")
+        elif choice < 0.45:
+            response, data = self.request("GET", "/api/tasks", route="GET /api/tasks (full)")
+            if self.expect(response, data, {200}, "tasks") is not None:
+                if not response.getheader("ETag"):
+                    self.problem("tasks: no ETag")
+                self.tag = response.getheader("ETag")
+        elif choice < 0.6 and self.tag:
+            response, data = self.request("GET", "/api/tasks", headers={"If-None-Match": self.tag},
+                                          route="GET /api/tasks (tagged)")
+            self.expect(response, data, {200, 304}, "tasks with tag")
+            if response.status == 200 and response.getheader("X-ChoreTracker-Sync") not in ("delta", "full"):
+                self.problem("tasks with tag: no X-ChoreTracker-Sync")
+        elif choice < 0.72:
+            response, data = self.request("GET", "/api/metrics")
+            self.expect(response, data, {200}, "metrics")
+        elif choice < 0.84:
+            response, data = self.request("GET", "/api/config")
+            self.expect(response, data, {200}, "config")
+        elif choice < 0.9:
+            interval = rng.choice([1, 30000, 60000])
+            body = json.dumps({"update_interval": interval})
+            response, data = self.request("PUT", "/api/config", body, {"Content-Type": "application/json"})
+            # Below the 5 s floor is refused
+            self.expect(response, data, {400} if interval < 5000 else {200}, "config update")
+        elif choice < 0.95 and self.task_ids:
+            task_id = rng.choice(self.task_ids)
+            response, data = self.request("POST", "/api/tasks/%s/complete" % task_id,
+                                          route="POST /api/tasks/{id}/complete")
+            # 409 for a task already completed, or one that has a fixed time
+            self.expect(response, data, {200, 404, 409}, "complete")
+        elif choice < 0.97:
+            response, data = self.request("POST", "/api/tasks", route="POST /api/tasks")
+            self.expect(response, data, {202}, "sync request")
+        else:
+            response, data = self.request("GET", "/api/nothing", route="GET (unknown)")
+            self.expect(response, data, {404}, "unknown path")
+
+    def worker(self, seed, deadline):
+        rng = random.Random(seed)
+        while time.time() < deadline:
+            try:
+                self.step(rng)
+            except (OSError, http.client.HTTPException) as error:
+                self.problem("request failed: %r" % error)
+
+    def slow_client(self, deadline):
+        # Headers a byte at a time; must not hold anyone else up
+        request = b"GET /api/status HTTP/1.1\r\nHost: device\r\n\r\n"
+        while time.time() < deadline:
+            try:
+                with socket.create_connection((self.host, self.port), timeout=10) as s:
+                    for byte in request:
+                        s.sendall(bytes([byte]))
+                        time.sleep(0.05)
+                    s.recv(4096)
+            except OSError:
+                pass
+
+    def slow_reader(self, deadline):
+        # The whole task list, read 256 bytes at a time; the device sends it
+        # as the socket takes it, without waiting in between
+        request = b"GET /api/tasks HTTP/1.1\r\nHost: device\r\n\r\n"
+        while time.time() < deadline:
+            try:
+                with socket.socket() as s:
+                    s.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 1024)
+                    s.settimeout(10)
+                    s.connect((self.host, self.port))
+                    s.sendall(request)
+                    response = b""
+                    while True:
+                        data = s.recv(256)
+                        if not data:
+                            break
+                        response += data
+                        time.sleep(0.01)
+            except OSError as error:
+                self.problem("slow reader: %r" % error)
+                continue
+            head, _, body = response.partition(b"\r\n\r\n")
+            if not head.startswith(b"HTTP/1.1 200"):
+                self.problem("slow reader: %r" % head[:40])
+                continue
+            try:
+                json.loads(body)
+            except ValueError:
+                self.problem("slow reader: task list cut short at %d bytes" % len(body))
+
+    def silent_client(self, deadline):
+        # Connects and says nothing; the device times it out
+        while time.time() < deadline:
+            try:
+                with socket.create_connection((self.host, self.port), timeout=10) as s:
+                    s.recv(1)
+            except OSError:
+                pass
+
+    def run(self, workers, seconds):
+        deadline = time.time() + seconds
+        threads = [threading.Thread(target=self.worker, args=(n, deadline)) for n in range(workers)]
+        threads.append(threading.Thread(target=self.slow_client, args=(deadline,), daemon=True))
+        threads.append(threading.Thread(target=self.silent_client, args=(deadline,), daemon=True))
+        threads.append(threading.Thread(target=self.slow_reader, args=(deadline,), daemon=True))
+        started = time.time()
+        for thread in threads:
+            thread.start()
+        for thread in threads[:workers]:
+            thread.join()
+        return time.time() - started
+
+
+def percentile(values, fraction):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(fraction * len(values)))]
+
+
+def read_metrics(load):
+    response, data = load.request("GET", "/api/metrics", route="metrics (report)")
+    metrics = json.loads(data)
+    sections = {section["name"]: section for section in metrics["sections"]}
+    return metrics["scheduler"], sections
+
+
+def wait_for(host, port, seconds):
+    deadline = time.time() + seconds
+    while time.time() < deadline:
+        try:
+            socket.create_connection((host, port), timeout=1).close()
+            return True
+        except OSError:
+            time.sleep(0.1)
+    return False
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--run-sim", metavar="BINARY", help="run a NativeSim build and load it")
+    parser.add_argument("--device", help="address of a device to load instead")
+    parser.add_argument("--port", type=int, default=API_PORT)
+    parser.add_argument("--workers", type=int, default=8)
+    parser.add_argument("--seconds", type=float, default=10)
+    parser.add_argument("--max-p99-ms", type=float, default=100)
+    args = parser.parse_args()
+    if not args.run_sim and not args.device:
+        parser.error("--run-sim or --device is needed")
+
+    sim = None
+    task_ids = []
+    host, port = args.device, args.port
+    if args.run_sim:
+        rng = random.Random(1)
+        store = TaskStore([make_task(n, rng) for n in range(24)], padding=200)
+        task_ids = sorted(task["id"] for task in store.current())
+        ha = ThreadingHTTPServer(("127.0.0.1", 0), make_handler(store, 0, quiet=True))
+        threading.Thread(target=ha.serve_forever, daemon=True).start()
+
+        host, port = "127.0.0.1", free_port()
+        env = dict(os.environ)
+        env.update({
+            "SIM_NET_HOST": "8123=127.0.0.1:%d,127.0.0.1:1" % ha.server_address[1],
+            "SIM_NET_LISTEN": "%d=%d" % (API_PORT, port),
+            "SIM_SPEED": "1",
+            "SIM_RUN_MS": str(int((args.seconds + 60) * 1000)),
+            "SIM_OUT": "",
+            "SIM_QUIET": "1",
+        })
+        sim = subprocess.Popen([args.run_sim], env=env, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+
+    try:
+        if not wait_for(host, port, 30):
+            print("the device is not listening on %s:%d" % (host, port))
+            return 1
+        load = Load(host, port, task_ids)
+        time.sleep(2)                # Settle, and let the first HA sync land
+        scheduler_before, _ = read_metrics(load)
+        elapsed = load.run(args.workers, args.seconds)
+        scheduler_after, sections = read_metrics(load)
+    finally:
+        if sim:
+            sim.terminate()
+            sim.wait()
+
+    total = sum(len(v) for k, v in load.latencies.items() if k != "metrics (report)")
+    print("%d requests in %.1f s (%.0f/s), %d workers plus slow, silent and slow-reading clients" % (
+        total, elapsed, total / elapsed, args.workers))
+    print("%-34s %7s %9s %9s %9s" % ("route", "count", "p50 ms", "p99 ms", "max ms"))
+    worst_p99 = 0
+    for route in sorted(load.latencies):
+        values = load.latencies[route]
+        p99 = percentile(values, 0.99) * 1000
+        worst_p99 = max(worst_p99, p99)
+        print("%-34s %7d %9.1f %9.1f %9.1f" % (route, len(values), percentile(values, 0.5) * 1000,
+                                               p99, max(values) * 1000))
+
+    overruns = scheduler_after["overruns"] - scheduler_before["overruns"]
+    update = sections.get("api_update", {})
+    print("device: %d ticks overran during the load, worst tick %d us; "
+          "time in the API per tick p99 %.0f us, max %.0f us" % (
+              overruns, scheduler_after["worst_tick_us"], update.get("p99_us", 0), update.get("max_us", 0)))
+
+    problems = list(load.problems)
+    if overruns:
+        problems.append("%d ticks overran while serving" % overruns)
+    if worst_p99 > args.max_p99_ms:
+        problems.append("p99 latency %.1f ms is over %.1f ms" % (worst_p99, args.max_p99_ms))
+    for problem in problems:
+        print(problem)
+    print("ok" if not problems else "FAILED")
+    return 1 if problems else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+"""Compare two bench runs (pio run -e bench output) scenario by scenario.
+
+    python3 tools/bench_compare.py before.json after.json
+
+Prints each metric with its change. Host times are noisy between runs; bus
+bytes, simulated time, allocations and peak heap are deterministic, so any change in
+those is a real change in behaviour.
+"""
+
+import json
+import sys
+
+METRICS = ["host_us", "sim_ms", "bus_bytes", "wire_us", "allocs", "alloc_bytes", "heap_peak_bytes"]
+
+
+def value(scenario, metric):
+    entry = scenario.get(metric, 0)
+    return entry["mean"] if isinstance(entry, dict) else entry
+
+
+def load(path):
+    with open(path) as f:
+        return {s["name"]: s for s in json.load(f)["scenarios"]}
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    before, after = load(sys.argv[1]), load(sys.argv[2])
+
+    print("%-20s %-12s %14s %14s %9s" % ("scenario", "metric", "before", "after", "change"))
+    for name in list(before) + [n for n in after if n not in before]:
+        if name not in before or name not in after:
+            print("%-20s only in %s" % (name, "after" if name in after else "before"))
+            continue
+        for metric in METRICS:
+            old, new = value(before[name], metric), value(after[name], metric)
+            change = "%+8.1f%%" % ((new - old) * 100.0 / old) if old else ("      new" if new else "")
+            print("%-20s %-12s %14.1f %14.1f %9s" % (name, metric, old, new, change))
+
+
+if __name__ == "__main__":
+    main()
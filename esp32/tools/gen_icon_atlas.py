@@ -0,0 +1,398 @@
+#!/usr/bin/env python3
+"""Rasterise the DemoPatterns icons into 2-bpp masks for src/ui/IconAtlasData.h.
+
+Runs as a PlatformIO pre-build script (extra_scripts = pre:tools/gen_icon_atlas.py)
+and standalone (python3 tools/gen_icon_atlas.py). The header is only rewritten
+when its content changes, so normal builds are not disturbed.
+
+The shapes below mirror the runtime fallbacks in DisplayManager.cpp (drawStar,
+drawHeart, ...) using ports of the Adafruit_GFX primitives, so the atlas and
+the fallback produce the same pixels. Keep the two in sync.
+
+Mask pixel values: 0 = transparent, 1 = pattern colour, 2 = black detail.
+"""
+
+import math
+import os
+import struct
+
+SIZES = [15, 20, 25, 30, 40]
+
+PATTERNS = [
+    "STAR", "HEART", "CIRCLE", "SQUARE", "TRIANGLE", "CROSS", "DIAMOND", "FLOWER",
+    "SUN", "CLOUD", "RAIN", "SNOW", "MUSIC", "BOOK", "GAME", "SPORT",
+]
+
+PRIMARY = 1
+BLACK = 2
+PI = 3.1415926535897932384626433832795
+
+
+def cdiv(a, b):
+    """C integer division (truncates toward zero)."""
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
+
+
+def ftrunc(value):
+    """int conversion of a positive on-screen coordinate, with float noise removed.
+
+    cos(PI/2) and friends are not exactly zero in float; snapping keeps the
+    icons symmetric instead of depending on where they are drawn.
+    """
+    nearest = round(value)
+    if abs(value - nearest) < 1e-4:
+        value = nearest
+    return math.floor(value)
+
+
+def f32(value):
+    return struct.unpack("f", struct.pack("f", value))[0]
+
+
+class Raster:
+    """Sparse canvas with the Adafruit_GFX primitives the patterns use."""
+
+    def __init__(self):
+        self.pixels = {}
+
+    def pixel(self, x, y, value):
+        self.pixels[(x, y)] = value
+
+    def vline(self, x, y, h, value):
+        for j in range(h):
+            self.pixel(x, y + j, value)
+
+    def hline(self, x, y, w, value):
+        for i in range(w):
+            self.pixel(x + i, y, value)
+
+    def fill_rect(self, x, y, w, h, value):
+        for j in range(h):
+            self.hline(x, y + j, w, value)
+
+    def line(self, x0, y0, x1, y1, value):
+        if x0 == x1:
+            if y0 > y1:
+                y0, y1 = y1, y0
+            self.vline(x0, y0, y1 - y0 + 1, value)
+            return
+        if y0 == y1:
+            if x0 > x1:
+                x0, x1 = x1, x0
+            self.hline(x0, y0, x1 - x0 + 1, value)
+            return
+
+        steep = abs(y1 - y0) > abs(x1 - x0)
+        if steep:
+            x0, y0 = y0, x0
+            x1, y1 = y1, x1
+        if x0 > x1:
+            x0, x1 = x1, x0
+            y0, y1 = y1, y0
+        dx = x1 - x0
+        dy = abs(y1 - y0)
+        err = dx // 2
+        ystep = 1 if y0 < y1 else -1
+        while x0 <= x1:
+            if steep:
+                self.pixel(y0, x0, value)
+            else:
+                self.pixel(x0, y0, value)
+            err -= dy
+            if err < 0:
+                y0 += ystep
+                err += dx
+            x0 += 1
+
+    def circle(self, x0, y0, r, value):
+        f = 1 - r
+        ddf_x = 1
+        ddf_y = -2 * r
+        x = 0
+        y = r
+        self.pixel(x0, y0 + r, value)
+        self.pixel(x0, y0 - r, value)
+        self.pixel(x0 + r, y0, value)
+        self.pixel(x0 - r, y0, value)
+        while x < y:
+            if f >= 0:
+                y -= 1
+                ddf_y += 2
+                f += ddf_y
+            x += 1
+            ddf_x += 2
+            f += ddf_x
+            for px, py in ((x, y), (-x, y), (x, -y), (-x, -y), (y, x), (-y, x), (y, -x), (-y, -x)):
+                self.pixel(x0 + px, y0 + py, value)
+
+    def fill_circle(self, x0, y0, r, value):
+        self.vline(x0, y0 - r, 2 * r + 1, value)
+        f = 1 - r
+        ddf_x = 1
+        ddf_y = -2 * r
+        x = 0
+        y = r
+        px = x
+        py = y
+        delta = 1
+        while x < y:
+            if f >= 0:
+                y -= 1
+                ddf_y += 2
+                f += ddf_y
+            x += 1
+            ddf_x += 2
+            f += ddf_x
+            if x < y + 1:
+                self.vline(x0 + x, y0 - y, 2 * y + delta, value)
+                self.vline(x0 - x, y0 - y, 2 * y + delta, value)
+            if y != py:
+                self.vline(x0 + py, y0 - px, 2 * px + delta, value)
+                self.vline(x0 - py, y0 - px, 2 * px + delta, value)
+                py = y
+            px = x
+
+    def fill_triangle(self, x0, y0, x1, y1, x2, y2, value):
+        if y0 > y1:
+            y0, y1 = y1, y0
+            x0, x1 = x1, x0
+        if y1 > y2:
+            y2, y1 = y1, y2
+            x2, x1 = x1, x2
+        if y0 > y1:
+            y0, y1 = y1, y0
+            x0, x1 = x1, x0
+
+        if y0 == y2:
+            a = b = x0
+            if x1 < a:
+                a = x1
+            elif x1 > b:
+                b = x1
+            if x2 < a:
+                a = x2
+            elif x2 > b:
+                b = x2
+            self.hline(a, y0, b - a + 1, value)
+            return
+
+        dx01, dy01 = x1 - x0, y1 - y0
+        dx02, dy02 = x2 - x0, y2 - y0
+        dx12, dy12 = x2 - x1, y2 - y1
+        sa = sb = 0
+        last = y1 if y1 == y2 else y1 - 1
+
+        y = y0
+        while y <= last:
+            a = x0 + cdiv(sa, dy01)
+            b = x0 + cdiv(sb, dy02)
+            sa += dx01
+            sb += dx02
+            if a > b:
+                a, b = b, a
+            self.hline(a, y, b - a + 1, value)
+            y += 1
+
+        sa = dx12 * (y - y1)
+        sb = dx02 * (y - y0)
+        while y <= y2:
+            a = x1 + cdiv(sa, dy12)
+            b = x0 + cdiv(sb, dy02)
+            sa += dx12
+            sb += dx02
+            if a > b:
+                a, b = b, a
+            self.hline(a, y, b - a + 1, value)
+            y += 1
+
+
+# ----------------------------------------------
+# Pattern shapes - mirror DisplayManager::drawXxx
+# ----------------------------------------------
+# Drawn around (x, y) = (ORIGIN, ORIGIN) so every coordinate is positive,
+# matching the int conversions the firmware does on screen.
+ORIGIN = 100
+
+
+def draw_star(g, x, y, size):
+    for i in range(5):
+        angle = f32(i * 2 * PI / 5)
+        g.line(x, y, ftrunc(x + math.cos(angle) * size), ftrunc(y + math.sin(angle) * size), PRIMARY)
+
+
+def draw_heart(g, x, y, size):
+    half = size // 2
+    g.fill_circle(x - half // 2, y - half // 2, half // 2, PRIMARY)
+    g.fill_circle(x + half // 2, y - half // 2, half // 2, PRIMARY)
+    g.fill_triangle(x - half, y, x + half, y, x, y + half, PRIMARY)
+
+
+def draw_circle(g, x, y, size):
+    g.fill_circle(x, y, size // 2, PRIMARY)
+
+
+def draw_square(g, x, y, size):
+    g.fill_rect(x - size // 2, y - size // 2, size, size, PRIMARY)
+
+
+def draw_triangle(g, x, y, size):
+    g.fill_triangle(x, y - size // 2, x - size // 2, y + size // 2, x + size // 2, y + size // 2, PRIMARY)
+
+
+def draw_cross(g, x, y, size):
+    half = size // 2
+    g.line(x - half, y, x + half, y, PRIMARY)
+    g.line(x, y - half, x, y + half, PRIMARY)
+
+
+def draw_diamond(g, x, y, size):
+    half = size // 2
+    g.fill_triangle(x, y - half, x - half, y, x + half, y, PRIMARY)
+    g.fill_triangle(x - half, y, x, y + half, x + half, y, PRIMARY)
+
+
+def draw_flower(g, x, y, size):
+    petal = size // 3
+    g.fill_circle(x, y, petal, PRIMARY)
+    for i in range(6):
+        angle = f32(i * PI / 3)
+        px = ftrunc(x + math.cos(angle) * petal)
+        py = ftrunc(y + math.sin(angle) * petal)
+        g.fill_circle(px, py, petal // 2, PRIMARY)
+
+
+def draw_sun(g, x, y, size):
+    g.fill_circle(x, y, size // 3, PRIMARY)
+    for i in range(8):
+        angle = f32(i * PI / 4)
+        x1 = ftrunc(x + math.cos(angle) * size / 2)
+        y1 = ftrunc(y + math.sin(angle) * size / 2)
+        x2 = ftrunc(x + math.cos(angle) * size)
+        y2 = ftrunc(y + math.sin(angle) * size)
+        g.line(x1, y1, x2, y2, PRIMARY)
+
+
+def draw_cloud(g, x, y, size):
+    c = size // 4
+    g.fill_circle(x - c, y, c, PRIMARY)
+    g.fill_circle(x, y - c // 2, c, PRIMARY)
+    g.fill_circle(x + c, y, c, PRIMARY)
+    g.fill_circle(x, y + c // 2, c * 2, PRIMARY)
+
+
+def draw_rain(g, x, y, size):
+    for i in range(5):
+        rx = x + cdiv((i - 2) * size, 4)
+        g.line(rx, y - size // 2, rx, y + size // 2, PRIMARY)
+
+
+def draw_snow(g, x, y, size):
+    half = size // 2
+    g.line(x - half, y, x + half, y, PRIMARY)
+    g.line(x, y - half, x, y + half, PRIMARY)
+    g.line(x - half // 2, y - half // 2, x + half // 2, y + half // 2, PRIMARY)
+    g.line(x - half // 2, y + half // 2, x + half // 2, y - half // 2, PRIMARY)
+
+
+def draw_music(g, x, y, size):
+    g.fill_circle(x, y + size // 3, size // 4, PRIMARY)
+    g.line(x + size // 4, y + size // 3, x + size // 4, y - size // 2, PRIMARY)
+
+
+def draw_book(g, x, y, size):
+    g.fill_rect(x - size // 2, y - size // 3, size, size * 2 // 3, PRIMARY)
+    g.line(x, y - size // 3, x, y + size // 3, BLACK)
+
+
+def draw_game(g, x, y, size):
+    g.fill_rect(x - size // 2, y - size // 4, size, size // 2, PRIMARY)
+    g.fill_circle(x - size // 3, y, size // 6, BLACK)
+    g.fill_circle(x + size // 3, y, size // 6, BLACK)
+
+
+def draw_sport(g, x, y, size):
+    g.fill_circle(x, y, size // 2, PRIMARY)
+    g.circle(x, y, size // 2, BLACK)
+
+
+DRAWERS = [
+    draw_star, draw_heart, draw_circle, draw_square, draw_triangle, draw_cross,
+    draw_diamond, draw_flower, draw_sun, draw_cloud, draw_rain, draw_snow,
+    draw_music, draw_book, draw_game, draw_sport,
+]
+
+
+def rasterise(pattern, size):
+    g = Raster()
+    DRAWERS[pattern](g, ORIGIN, ORIGIN, size)
+    xs = [p[0] for p in g.pixels]
+    ys = [p[1] for p in g.pixels]
+    left, top = min(xs), min(ys)
+    width, height = max(xs) - left + 1, max(ys) - top + 1
+
+    stride = (width + 3) // 4
+    data = bytearray(stride * height)
+    for (px, py), value in g.pixels.items():
+        col, row = px - left, py - top
+        data[row * stride + col // 4] |= value << (6 - 2 * (col % 4))
+    return left - ORIGIN, top - ORIGIN, width, height, bytes(data)
+
+
+def render_header():
+    lines = [
+        "#pragma once",
+        "// Generated by tools/gen_icon_atlas.py - do not edit by hand",
+        '#include "IconAtlas.h"',
+        "",
+        "namespace IconAtlasData {",
+        "",
+        "constexpr int SIZE_COUNT = %d;" % len(SIZES),
+        "constexpr uint8_t SIZES[SIZE_COUNT] = {%s};" % ", ".join(str(s) for s in SIZES),
+        "constexpr int PATTERN_COUNT = %d;" % len(PATTERNS),
+        "",
+    ]
+
+    entries = []
+    total = 0
+    for pattern, name in enumerate(PATTERNS):
+        for size in SIZES:
+            dx, dy, w, h, data = rasterise(pattern, size)
+            symbol = "%s_%d" % (name, size)
+            total += len(data)
+            lines.append("constexpr uint8_t %s[] = {" % symbol)
+            for i in range(0, len(data), 16):
+                lines.append("\t" + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+            lines.append("};")
+            entries.append("\t{%d, %d, %d, %d, %s}," % (dx, dy, w, h, symbol))
+    lines.append("")
+    lines.append("// Indexed by pattern * SIZE_COUNT + size slot (%d bytes of mask data)" % total)
+    lines.append("constexpr IconMask MASKS[PATTERN_COUNT * SIZE_COUNT] = {")
+    lines.extend(entries)
+    lines.append("};")
+    lines.append("")
+    lines.append("}  // namespace IconAtlasData")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def generate(project_dir):
+    path = os.path.join(project_dir, "src", "ui", "IconAtlasData.h")
+    content = render_header()
+    try:
+        with open(path) as existing:
+            if existing.read() == content:
+                return
+    except FileNotFoundError:
+        pass
+    with open(path, "w") as out:
+        out.write(content)
+    print("gen_icon_atlas: wrote %s" % path)
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    generate(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        generate(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -0,0 +1,299 @@
+#!/usr/bin/env python3
+"""Stand-in for the Home Assistant side of task sync, for end-to-end runs.
+
+    python3 tools/ha_standin.py [--port 8123] [--tasks tasks.json] [--churn N]
+    python3 tools/ha_standin.py --run-sim .pio/build/native/program
+
+Serves the task list the way the device expects it from HA_TASKS_PATH
+(src/config/Config.h). It has a change log, so a request with the ETag of
+a list the device already holds in If-None-Match gets one of three answers.
+If nothing has changed it gets 304. If the log still reaches back that
+far it gets only the changes, marked "X-ChoreTracker-Sync: delta". Otherwise
+it gets the whole list. The protocol is described with /api/tasks in
+shared/api/choretracker_api.yaml.
+
+Tasks can be changed while it runs:
+    PUT    /admin/tasks/<id>   Task JSON, added or replaced
+    DELETE /admin/tasks/<id>
+    GET    /admin/tasks        the current list
+With --churn N, N random changes are also made after every task request.
+
+--run-sim starts the server on a free port and runs a NativeSim build
+against it (SIM_NET_HOST) for --sim-ms of simulated time, with churn.
+Then it asks the device for its tasks ("tasks json" on the serial console)
+and checks them against the list the server last sent. The exit status
+is 0 when they match.
+"""
+
+import argparse
+import copy
+import datetime
+import json
+import os
+import random
+import subprocess
+import sys
+import threading
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+TASKS_PATH = "/api/choretracker/tasks"
+SYNC_HEADER = "X-ChoreTracker-Sync"
+LOG_LIMIT = 64           # Changes kept; a tag older than that gets a full list
+SYNC_FIELDS = ["id", "title", "person_id", "type", "start_time", "end_time",
+               "reward", "reward_time", "switch_id"]
+
+
+class TaskStore:
+    """Tasks plus a change log numbered by sequence."""
+
+    def __init__(self, tasks, padding=0, seed=1):
+        self.lock = threading.Lock()
+        self.epoch = "%08x" % random.SystemRandom().getrandbits(32)
+        self.sequence = 0
+        self.horizon = 0             # Oldest sequence a delta can start from
+        self.tasks = {}              # id -> (sequence, task)
+        self.removed = {}            # id -> sequence, for ids not in tasks
+        self.log = []                # Sequences of changes, oldest first
+        self.padding = padding
+        self.random = random.Random(seed)
+        self.stats = {"full": 0, "delta": 0, "unchanged": 0, "bytes_full": 0, "bytes_delta": 0}
+        self.served = {}             # What the last 200 response left the device with
+        for task in tasks:
+            self.put(task)
+
+    def tag(self):
+        return '"%s.%d"' % (self.epoch, self.sequence)
+
+    def _change(self):
+        self.sequence += 1
+        self.log.append(self.sequence)
+        if len(self.log) > LOG_LIMIT:
+            self.horizon = self.log.pop(0)
+        return self.sequence
+
+    def put(self, task):
+        with self.lock:
+            self.removed.pop(task["id"], None)
+            self.tasks[task["id"]] = (self._change(), dict(task))
+
+    def delete(self, task_id):
+        with self.lock:
+            if task_id not in self.tasks:
+                return False
+            del self.tasks[task_id]
+            self.removed[task_id] = self._change()
+            return True
+
+    def current(self):
+        with self.lock:
+            return [copy.deepcopy(task) for _, task in self.tasks.values()]
+
+    def since(self, tag):
+        """Sequence a delta can start from, or None for a full list."""
+        if not tag:
+            return None
+        tag = tag[2:] if tag.startswith("W/") else tag
+        epoch, _, number = tag.strip('"').partition(".")
+        if epoch != self.epoch or not number.isdigit():
+            return None
+        number = int(number)
+        return number if self.horizon <= number <= self.sequence else None
+
+    def respond(self, if_none_match):
+        """(status, headers, body) for a task request."""
+        with self.lock:
+            since = self.since(if_none_match)
+            headers = {"ETag": self.tag()}
+            if since == self.sequence:
+                self.stats["unchanged"] += 1
+                return 304, headers, b""
+
+            # Removals first: an id removed and added again ends up present
+            if since is None:
+                items = [self._wire(task) for _, task in self.tasks.values()]
+                mode = "full"
+            else:
+                items = [{"id": i, "removed": True} for i, seq in self.removed.items() if seq > since]
+                items += [self._wire(task) for seq, task in self.tasks.values() if seq > since]
+                mode = "delta"
+            body = ("[\n" + ",\n".join(json.dumps(item) for item in items) + "\n]\n").encode()
+            headers[SYNC_HEADER] = mode
+            self.stats[mode] += 1
+            self.stats["bytes_" + mode] += len(body)
+            self.served = {task["id"]: copy.deepcopy(task) for _, task in self.tasks.values()}
+            return 200, headers, body
+
+    def _wire(self, task):
+        # HA sends calendar fields the device has to skip
+        item = dict(task)
+        if self.padding:
+            item["description"] = "x" * self.padding
+            item["attendees"] = [{"name": "Parent", "response": "accepted"}]
+        return item
+
+    def churn(self, count):
+        for _ in range(count):
+            with self.lock:
+                ids = sorted(self.tasks)
+            action = self.random.random()
+            if ids and action < 0.2:
+                self.delete(self.random.choice(ids))
+            elif ids and (action < 0.7 or len(ids) >= 24):
+                task = dict(self.tasks[self.random.choice(ids)][1])
+                task["title"] = "Chore %d" % self.random.randrange(1000)
+                self.put(task)
+            else:
+                self.put(make_task(self.random.randrange(10000), self.random))
+
+
+def make_task(number, rng):
+    # Timed tasks are for tomorrow: the device takes its clock from the Date
+    # on these responses, so today's would already have come and gone
+    kind = ["untimed", "fixed_time", "timed_with_early"][number % 3]
+    hour = 6 + number % 12
+    day = (datetime.datetime.now(datetime.timezone.utc) + datetime.timedelta(days=1)).strftime("%Y-%m-%d")
+    return {
+        "id": "task_%04d" % number,
+        "title": "Chore %d" % number,
+        "person_id": "child%d" % (number % 2 + 1),
+        "state": "active",
+        "type": kind,
+        "start_time": None if kind == "untimed" else "%sT%02d:00:00Z" % (day, hour),
+        "end_time": None if kind == "untimed" else "%sT%02d:30:00Z" % (day, hour),
+        "reward": None,
+        "reward_time": None,
+        "switch_id": rng.randrange(1, 9),
+    }
+
+
+def make_handler(store, churn, quiet=False):
+    class Handler(BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.0"
+
+        def _send(self, status, headers=None, body=b""):
+            self.send_response(status)
+            for name, value in (headers or {}).items():
+                self.send_header(name, value)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+
+        def do_GET(self):
+            if self.path == TASKS_PATH:
+                self._send(*store.respond(self.headers.get("If-None-Match")))
+                store.churn(churn)
+            elif self.path == "/admin/tasks":
+                self._send(200, body=json.dumps(store.current(), indent=2).encode())
+            else:
+                self._send(404)
+
+        def do_PUT(self):
+            if not self.path.startswith("/admin/tasks/"):
+                return self._send(404)
+            length = int(self.headers.get("Content-Length", 0))
+            task = json.loads(self.rfile.read(length) or b"{}")
+            task["id"] = self.path.rsplit("/", 1)[1]
+            store.put(task)
+            self._send(200)
+
+        def do_DELETE(self):
+            if not self.path.startswith("/admin/tasks/"):
+                return self._send(404)
+            self._send(200 if store.delete(self.path.rsplit("/", 1)[1]) else 404)
+
+        def log_message(self, fmt, *args):
+            if not quiet:
+                sys.stderr.write("ha_standin: " + fmt % args + "\n")
+
+    return Handler
+
+
+def compare(device, served):
+    """Differences between the device's tasks and the server's, as text."""
+    problems = []
+    device = {task["id"]: task for task in device}
+    for task_id in sorted(set(device) | set(served)):
+        if task_id not in device:
+            problems.append("%s: missing on the device" % task_id)
+        elif task_id not in served:
+            problems.append("%s: still on the device" % task_id)
+        else:
+            for field in SYNC_FIELDS:
+                if device[task_id].get(field) != served[task_id].get(field):
+                    problems.append("%s: %s is %r, expected %r" % (
+                        task_id, field, device[task_id].get(field), served[task_id].get(field)))
+    return problems
+
+
+def run_sim(args, store):
+    server = ThreadingHTTPServer(("127.0.0.1", 0), make_handler(store, args.churn, quiet=True))
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+
+    env = dict(os.environ)
+    env.update({
+        # HA's port to the server; anything else (MQTT) is refused, so the
+        # device stays on polling
+        "SIM_NET_HOST": "8123=127.0.0.1:%d,127.0.0.1:1" % server.server_address[1],
+        "SIM_RUN_MS": str(args.sim_ms),
+        "SIM_SERIAL": "%d:tasks json" % (args.sim_ms - 100),
+        "SIM_OUT": "",
+    })
+    env.pop("SIM_QUIET", None)
+    output = subprocess.run([args.run_sim], env=env, capture_output=True, text=True,
+                            errors="replace").stdout
+    server.shutdown()
+
+    lines = [line for line in output.splitlines() if line.startswith("[")]
+    if not lines:
+        print("no task list from the device")
+        return 1
+    device = json.loads(lines[-1])
+    problems = compare(device, store.served)
+
+    stats = store.stats
+    print("requests: %d full (%d bytes), %d delta (%d bytes), %d unchanged" % (
+        stats["full"], stats["bytes_full"], stats["delta"], stats["bytes_delta"], stats["unchanged"]))
+    if stats["full"] and stats["delta"]:
+        print("mean body: full %.0f bytes, delta %.0f bytes" % (
+            stats["bytes_full"] / stats["full"], stats["bytes_delta"] / stats["delta"]))
+    for problem in problems:
+        print(problem)
+    print("device has %d tasks: %s" % (len(device), "match" if not problems else "MISMATCH"))
+    return 1 if problems else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", type=int, default=8123)
+    parser.add_argument("--tasks", help="JSON array of Task to start with")
+    parser.add_argument("--count", type=int, default=12, help="generated tasks when --tasks is not given")
+    parser.add_argument("--churn", type=int, help="random changes after each task request (default 0, 2 with --run-sim)")
+    parser.add_argument("--padding", type=int, default=400, help="bytes of calendar text per task")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--run-sim", metavar="BINARY", help="run a NativeSim build against the server")
+    parser.add_argument("--sim-ms", type=int, default=600000)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    if args.tasks:
+        with open(args.tasks) as f:
+            tasks = json.load(f)
+    else:
+        tasks = [make_task(n, rng) for n in range(args.count)]
+    store = TaskStore(tasks, args.padding, args.seed)
+
+    if args.run_sim:
+        args.churn = 2 if args.churn is None else args.churn
+        sys.exit(run_sim(args, store))
+
+    server = ThreadingHTTPServer(("", args.port), make_handler(store, args.churn or 0))
+    print("Serving %d tasks on port %d%s" % (len(tasks), args.port, TASKS_PATH))
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
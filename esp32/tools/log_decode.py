@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Turn binary log output (LOG_BINARY_OUTPUT true) back into text.
+
+    python3 tools/log_decode.py [--time] capture.bin
+    python3 tools/log_decode.py < capture.bin
+
+Records only carry a hash of their format string, so the format strings are
+recovered from the LOG_ERROR/WARN/INFO/DEBUG calls under src/. Decode with the
+sources the firmware was built from. Anything between records (boot banners
+and other plain Serial output) is passed through unchanged.
+
+Record layout (see src/utils/Log.h/.cpp), little-endian:
+    0xA5, payload length (u8), then the payload:
+    module << 4 | level (u8), millis (u32), FNV-1a of the format (u32),
+    then per argument a tag: 'i' int32, 'u' uint32, 'f' float,
+    's' length (u8) + bytes.
+"""
+
+import os
+import re
+import struct
+import sys
+
+SYNC = 0xA5
+MODULES = ["SYSTEM", "GPIO", "NAV", "DISPLAY", "DEMO", "SCHED", "NET"]
+
+SRC_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src")
+
+CALL = re.compile(r'\bLOG_(?:ERROR|WARN|INFO|DEBUG)\s*\(\s*MODULE_\w+\s*,\s*((?:"(?:[^"\\]|\\.)*"\s*)+)')
+LITERAL = re.compile(r'"((?:[^"\\]|\\.)*)"')
+SIMPLE_ESCAPES = {"n": b"\n", "t": b"\t", "r": b"\r", "0": b"\0", "\\": b"\\",
+                  '"': b'"', "'": b"'", "?": b"?", "a": b"\a", "b": b"\b",
+                  "f": b"\f", "v": b"\v"}
+SPEC = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l|z)?([diuxXcsfeEgGp%])")
+
+
+def fnv1a(data):
+    value = 2166136261
+    for byte in data:
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def unescape(literal):
+    """Bytes of a C string literal body, as the compiler lays them out (UTF-8)."""
+    out = bytearray()
+    i = 0
+    while i < len(literal):
+        ch = literal[i]
+        if ch != "\\":
+            out += ch.encode("utf-8")
+            i += 1
+            continue
+        nxt = literal[i + 1]
+        if nxt == "x":
+            digits = re.match(r"[0-9a-fA-F]+", literal[i + 2:]).group(0)
+            out.append(int(digits, 16) & 0xFF)
+            i += 2 + len(digits)
+        elif nxt in "01234567":
+            digits = re.match(r"[0-7]{1,3}", literal[i + 1:]).group(0)
+            out.append(int(digits, 8) & 0xFF)
+            i += 1 + len(digits)
+        else:
+            out += SIMPLE_ESCAPES.get(nxt, nxt.encode("utf-8"))
+            i += 2
+    return bytes(out)
+
+
+def load_formats(src_dir):
+    """Format id -> format bytes for every log call in the sources."""
+    formats = {}
+    for root, _, files in os.walk(src_dir):
+        for name in files:
+            if not name.endswith((".cpp", ".h")):
+                continue
+            with open(os.path.join(root, name), encoding="utf-8") as f:
+                source = f.read()
+            for call in CALL.finditer(source):
+                fmt = b"".join(unescape(lit) for lit in LITERAL.findall(call.group(1)))
+                formats[fnv1a(fmt)] = fmt
+    return formats
+
+
+def parse_args(data):
+    """Tagged arguments; None if the bytes are not a whole argument list."""
+    args = []
+    i = 0
+    while i < len(data):
+        tag = chr(data[i])
+        if tag in "iuf":
+            if i + 5 > len(data):
+                return None
+            args.append(struct.unpack_from({"i": "<i", "u": "<I", "f": "<f"}[tag], data, i + 1)[0])
+            i += 5
+        elif tag == "s":
+            if i + 2 > len(data) or i + 2 + data[i + 1] > len(data):
+                return None
+            args.append(data[i + 2:i + 2 + data[i + 1]].decode("utf-8", "replace"))
+            i += 2 + data[i + 1]
+        else:
+            return None
+    return args
+
+
+def render(fmt, args):
+    """printf the way the firmware would, one conversion at a time."""
+    text = fmt.decode("utf-8", "replace")
+    queue = list(args)
+
+    def convert(match):
+        flags, conversion = match.groups()
+        if conversion == "%":
+            return "%"
+        if not queue:
+            return "?"
+        value = queue.pop(0)
+        if conversion == "c":
+            value = chr(value)
+        elif conversion == "p":
+            return "0x%x" % value
+        return ("%" + flags + conversion) % value
+
+    return SPEC.sub(convert, text)
+
+
+def decode(stream, formats, out, show_time):
+    data = stream.read()
+    text = bytearray()
+    i = 0
+    while i < len(data):
+        if data[i] == SYNC and i + 11 <= len(data):
+            length = data[i + 1]
+            payload = data[i + 2:i + 2 + length]
+            if length >= 9 and len(payload) == length:
+                tag, millis, format_id = struct.unpack_from("<BII", payload)
+                args = parse_args(payload[9:])
+                if format_id in formats and args is not None:
+                    out.write(text.decode("utf-8", "replace"))
+                    text.clear()
+                    prefix = ""
+                    if show_time:
+                        prefix = "%10.3f " % (millis / 1000.0)
+                    module, level = tag >> 4, tag & 0x0F
+                    if level <= 2 and module < len(MODULES):
+                        prefix += "[%s] " % MODULES[module]
+                    out.write(prefix + render(formats[format_id], args))
+                    i += 2 + length
+                    continue
+        text.append(data[i])
+        i += 1
+    out.write(text.decode("utf-8", "replace"))
+
+
+def main():
+    show_time = "--time" in sys.argv
+    paths = [a for a in sys.argv[1:] if a != "--time"]
+    formats = load_formats(SRC_DIR)
+    if paths:
+        with open(paths[0], "rb") as f:
+            decode(f, formats, sys.stdout, show_time)
+    else:
+        decode(sys.stdin.buffer, formats, sys.stdout, show_time)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,340 @@
+#!/usr/bin/env python3
+"""Stand-in MQTT broker, playing Home Assistant's part, for end-to-end runs.
+
+    python3 tools/mqtt_standin.py [--port 1883]
+    python3 tools/mqtt_standin.py --run-sim .pio/build/native/program
+
+Just enough MQTT 3.1.1 for the device's client (src/network/MQTTClient.h):
+CONNECT with a will, SUBSCRIBE, PUBLISH at QoS 0 and 1 both ways, retained
+messages and PINGREQ. It also does what the HA automation would: it keeps
+the task list retained on choretracker/tasks and, when a completion
+arrives on choretracker/task/completed/<id>, marks that task completed and
+publishes the list again.
+
+--run-sim starts the broker on a free port and runs a NativeSim build
+against it (SIM_NET_HOST) with scripted switch presses, paced (SIM_SPEED)
+so the broker keeps up. The broker drops the connection once, on a
+completion, before acknowledging it, so the device has to reconnect and
+send it again. Afterwards it checks that every press arrived, that the
+device's tasks ("tasks json") match the retained list, and that the device
+took the retained config. It prints the edge-to-publish latency the device
+measured ("mqtt"). The exit status is 0 when everything checks out.
+"""
+
+import argparse
+import json
+import os
+import socket
+import socketserver
+import subprocess
+import sys
+import threading
+
+PREFIX = "choretracker"
+TASK_SWITCH_PINS = [13, 12, 14, 27, 26, 33, 35, 34]    # TASK_BUTTON_PINS, active LOW
+
+CONNECT, CONNACK, PUBLISH, PUBACK = 1, 2, 3, 4
+SUBSCRIBE, SUBACK, PINGREQ, PINGRESP, DISCONNECT = 8, 9, 12, 13, 14
+
+
+def encode_length(length):
+    out = bytearray()
+    while True:
+        digit, length = length % 128, length // 128
+        out.append(digit | (0x80 if length else 0))
+        if not length:
+            return bytes(out)
+
+
+def encode_string(text):
+    data = text.encode()
+    return len(data).to_bytes(2, "big") + data
+
+
+def matches(pattern, topic):
+    pattern, topic = pattern.split("/"), topic.split("/")
+    for i, part in enumerate(pattern):
+        if part == "#":
+            return True
+        if i >= len(topic) or (part != "+" and part != topic[i]):
+            return False
+    return len(pattern) == len(topic)
+
+
+class Session:
+    def __init__(self, broker, connection):
+        self.broker = broker
+        self.connection = connection
+        self.lock = threading.Lock()
+        self.subscriptions = []
+        self.will = None
+        self.next_id = 1
+
+    def read_exact(self, count):
+        data = b""
+        while len(data) < count:
+            chunk = self.connection.recv(count - len(data))
+            if not chunk:
+                raise ConnectionError("closed")
+            data += chunk
+        return data
+
+    def read_packet(self):
+        header = self.read_exact(1)[0]
+        length, shift = 0, 0
+        while True:
+            digit = self.read_exact(1)[0]
+            length |= (digit & 0x7F) << shift
+            shift += 7
+            if not digit & 0x80:
+                break
+        return header, self.read_exact(length)
+
+    def send(self, header, body=b""):
+        with self.lock:
+            self.connection.sendall(bytes([header]) + encode_length(len(body)) + body)
+
+    def deliver(self, topic, payload, retain=False):
+        # Everything goes out at QoS 1; acknowledgements are not tracked
+        with self.lock:
+            packet_id = self.next_id
+            self.next_id = self.next_id % 65535 + 1
+        body = encode_string(topic) + packet_id.to_bytes(2, "big") + payload
+        self.send(PUBLISH << 4 | 0x02 | (0x01 if retain else 0), body)
+
+    def run(self):
+        try:
+            clean = self.serve()
+        except (ConnectionError, OSError):
+            clean = False
+        self.broker.leave(self, clean)
+
+    def serve(self):
+        header, body = self.read_packet()
+        if header >> 4 != CONNECT or body[:6] != encode_string("MQTT"):
+            return False
+        flags = body[7]
+        offset = 10
+        client_id, offset = self.field(body, offset)
+        if flags & 0x04:
+            will_topic, offset = self.field(body, offset)
+            will_message, offset = self.field(body, offset, raw=True)
+            self.will = (will_topic, will_message, bool(flags & 0x20))
+        self.broker.log("connect %s" % client_id)
+        self.send(CONNACK << 4, b"\x00\x00")
+
+        while True:
+            header, body = self.read_packet()
+            kind = header >> 4
+            if kind == PUBLISH:
+                qos = (header >> 1) & 0x03
+                topic, offset = self.field(body, 0)
+                packet_id = body[offset:offset + 2]
+                offset += 2 if qos else 0
+                if not self.broker.publish(self, topic, body[offset:], bool(header & 0x01), bool(header & 0x08)):
+                    return False
+                if qos == 1:
+                    self.send(PUBACK << 4, packet_id)
+            elif kind == SUBSCRIBE:
+                offset, granted, patterns = 2, b"", []
+                while offset < len(body):
+                    pattern, offset = self.field(body, offset)
+                    offset += 1
+                    patterns.append(pattern)
+                    granted += b"\x01"
+                self.subscriptions += patterns
+                self.send(SUBACK << 4, body[:2] + granted)
+                self.broker.send_retained(self, patterns)
+            elif kind == PINGREQ:
+                self.send(PINGRESP << 4)
+            elif kind == DISCONNECT:
+                return True
+
+    @staticmethod
+    def field(body, offset, raw=False):
+        length = int.from_bytes(body[offset:offset + 2], "big")
+        value = body[offset + 2:offset + 2 + length]
+        return (value if raw else value.decode()), offset + 2 + length
+
+
+class Broker:
+    def __init__(self, tasks, config, drop_on=None, quiet=False):
+        self.lock = threading.Lock()
+        self.sessions = []
+        self.retained = {}
+        self.tasks = {task["id"]: task for task in tasks}
+        self.completions = []            # (task id, payload, dup)
+        self.drop_on = drop_on           # Completion count at which to cut the link once
+        self.dropped = False
+        self.connects = 0
+        self.quiet = quiet
+        self.retained[PREFIX + "/tasks"] = self.task_list()
+        if config:
+            self.retained[PREFIX + "/config/update"] = json.dumps(config).encode()
+
+    def log(self, text):
+        if not self.quiet:
+            sys.stderr.write("mqtt_standin: %s\n" % text)
+
+    def task_list(self):
+        return json.dumps(list(self.tasks.values())).encode()
+
+    def join(self, session):
+        with self.lock:
+            self.sessions.append(session)
+            self.connects += 1
+
+    def leave(self, session, clean):
+        with self.lock:
+            if session in self.sessions:
+                self.sessions.remove(session)
+        session.connection.close()
+        if not clean and session.will:
+            self.log("will %s" % session.will[0])
+            self.publish(None, session.will[0], session.will[1], session.will[2], False)
+
+    def publish(self, sender, topic, payload, retain, dup):
+        """False when the sender's connection is to be cut instead."""
+        if topic.startswith(PREFIX + "/task/completed/"):
+            task_id = topic.rsplit("/", 1)[1]
+            with self.lock:
+                self.completions.append((task_id, json.loads(payload), dup))
+                drop = self.drop_on == len(self.completions) and not self.dropped
+                self.dropped = self.dropped or drop
+            self.log("completed %s%s" % (task_id, " (dup)" if dup else ""))
+            if drop:
+                self.log("dropping the connection before the PUBACK")
+                return False
+            if task_id in self.tasks and self.tasks[task_id]["state"] != "completed":
+                self.tasks[task_id]["state"] = "completed"
+                self.publish(None, PREFIX + "/tasks", self.task_list(), True, False)
+            return True
+
+        if retain:
+            self.retained[topic] = payload
+        with self.lock:
+            sessions = list(self.sessions)
+        for session in sessions:
+            if session is not sender and any(matches(p, topic) for p in session.subscriptions):
+                try:
+                    session.deliver(topic, payload)
+                except OSError:
+                    pass
+        return True
+
+    def send_retained(self, session, patterns):
+        for topic, payload in list(self.retained.items()):
+            if payload and any(matches(p, topic) for p in patterns):
+                session.deliver(topic, payload, retain=True)
+
+
+def serve(broker, port):
+    class Handler(socketserver.BaseRequestHandler):
+        def handle(self):
+            self.request.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+            session = Session(broker, self.request)
+            broker.join(session)
+            session.run()
+
+    server = socketserver.ThreadingTCPServer(("127.0.0.1" if port == 0 else "", port), Handler)
+    server.daemon_threads = True
+    return server
+
+
+def make_tasks(count):
+    return [{
+        "id": "task_%d" % n,
+        "title": "Chore %d" % n,
+        "person_id": "child%d" % (n % 2 + 1),
+        "state": "active",
+        "type": "untimed",
+        "start_time": None,
+        "end_time": None,
+        "reward": None,
+        "reward_time": None,
+        "switch_id": n + 1,
+    } for n in range(count)]
+
+
+def run_sim(args, broker):
+    server = serve(broker, 0)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+
+    # Switches on, one every few seconds once the task list is in; each
+    # completes the task on it
+    presses = ["%d:%d=0" % (5000 + 3000 * n, TASK_SWITCH_PINS[n]) for n in range(args.presses)]
+    env = dict(os.environ)
+    env.update({
+        # The broker's port to the stand-in; anything else (HA) is refused
+        "SIM_NET_HOST": "1883=127.0.0.1:%d,127.0.0.1:1" % server.server_address[1],
+        "SIM_RUN_MS": str(args.sim_ms),
+        "SIM_SPEED": str(args.speed),
+        "SIM_INPUT": ",".join(presses),
+        "SIM_SERIAL": "%d:tasks json;%d:mqtt" % (args.sim_ms - 200, args.sim_ms - 100),
+        "SIM_OUT": "",
+    })
+    env.pop("SIM_QUIET", None)
+    output = subprocess.run([args.run_sim], env=env, capture_output=True, text=True,
+                            errors="replace").stdout
+    server.shutdown()
+
+    problems = []
+    completed = sorted({task_id for task_id, _, _ in broker.completions})
+    expected = ["task_%d" % n for n in range(args.presses)]
+    if completed != expected:
+        problems.append("completions for %s, expected %s" % (completed, expected))
+    if broker.drop_on and not any(dup for _, _, dup in broker.completions):
+        problems.append("the dropped completion was not sent again")
+    for task_id, payload, _ in broker.completions:
+        # HA is out of reach, so the device has no clock to stamp them with
+        if payload.get("id") != task_id or "completed_at" in payload:
+            problems.append("%s: bad payload %r" % (task_id, payload))
+
+    lines = [line for line in output.splitlines() if line.startswith("[")]
+    device = {task["id"]: task for task in json.loads(lines[-1])} if lines else {}
+    for task_id, task in broker.tasks.items():
+        if device.get(task_id, {}).get("state") != task["state"]:
+            problems.append("%s: %s on the device, %s on the broker" % (
+                task_id, device.get(task_id, {}).get("state"), task["state"]))
+    if "Task poll interval now %d ms" % args.interval not in output:
+        problems.append("config/update was not applied")
+
+    print("%d connects, %d completion messages (%d resent)" % (
+        broker.connects, len(broker.completions), sum(1 for c in broker.completions if c[2])))
+    for line in output.splitlines():
+        if line.startswith("MQTT ") or line.startswith("  ") and ("published" in line or "latency" in line):
+            print(line.strip())
+    for problem in problems:
+        print(problem)
+    print("match" if not problems else "MISMATCH")
+    return 1 if problems else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", type=int, default=1883)
+    parser.add_argument("--count", type=int, default=6, help="untimed tasks, one per switch")
+    parser.add_argument("--interval", type=int, default=120000, help="update_interval in the retained config")
+    parser.add_argument("--run-sim", metavar="BINARY", help="run a NativeSim build against the broker")
+    parser.add_argument("--sim-ms", type=int, default=30000)
+    parser.add_argument("--speed", type=float, default=10, help="simulated time per real time")
+    parser.add_argument("--presses", type=int, default=4, help="switches pressed during --run-sim")
+    parser.add_argument("--drop-on", type=int, default=2, help="completion to cut the link on (0 never)")
+    args = parser.parse_args()
+
+    args.presses = min(args.presses, args.count, len(TASK_SWITCH_PINS))
+    broker = Broker(make_tasks(args.count), {"update_interval": args.interval},
+                    args.drop_on or None, quiet=bool(args.run_sim))
+    if args.run_sim:
+        sys.exit(run_sim(args, broker))
+
+    server = serve(broker, args.port)
+    print("Broker on port %d, %d tasks retained on %s/tasks" % (args.port, args.count, PREFIX))
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()